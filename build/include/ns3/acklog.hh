@@ -0,0 +1 @@
+/root/repo/src/internet/model/remy/acklog.hh
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/applications/model/application-packet-probe.h
\ No newline at end of file
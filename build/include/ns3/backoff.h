@@ -0,0 +1 @@
+/root/repo/src/csma/model/backoff.h
\ No newline at end of file
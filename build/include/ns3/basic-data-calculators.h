@@ -0,0 +1 @@
+/root/repo/src/stats/model/basic-data-calculators.h
\ No newline at end of file
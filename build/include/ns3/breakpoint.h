@@ -0,0 +1 @@
+/root/repo/src/core/model/breakpoint.h
\ No newline at end of file
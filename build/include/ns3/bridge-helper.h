@@ -0,0 +1 @@
+/root/repo/src/bridge/helper/bridge-helper.h
\ No newline at end of file
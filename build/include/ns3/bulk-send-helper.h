@@ -0,0 +1 @@
+/root/repo/src/applications/helper/bulk-send-helper.h
\ No newline at end of file
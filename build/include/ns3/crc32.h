@@ -0,0 +1 @@
+/root/repo/src/network/utils/crc32.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/data-collector.h
\ No newline at end of file
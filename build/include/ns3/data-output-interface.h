@@ -0,0 +1 @@
+/root/repo/src/stats/model/data-output-interface.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/data-rate.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/remy/dna.pb.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/double.h
\ No newline at end of file
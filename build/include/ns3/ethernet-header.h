@@ -0,0 +1 @@
+/root/repo/src/network/utils/ethernet-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/flow-id-tag.h
\ No newline at end of file
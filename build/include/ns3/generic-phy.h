@@ -0,0 +1 @@
+/root/repo/src/network/utils/generic-phy.h
\ No newline at end of file
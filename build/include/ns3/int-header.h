@@ -0,0 +1 @@
+/root/repo/src/point-to-point/model/int-header.h
\ No newline at end of file
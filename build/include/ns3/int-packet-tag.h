@@ -0,0 +1 @@
+/root/repo/src/network/model/int-packet-tag.h
\ No newline at end of file
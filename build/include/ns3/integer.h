@@ -0,0 +1 @@
+/root/repo/src/core/model/integer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/ipv4-address-generator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/helper/ipv6-list-routing-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/length.h
\ No newline at end of file
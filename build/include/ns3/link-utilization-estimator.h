@@ -0,0 +1 @@
+/root/repo/src/point-to-point/model/link-utilization-estimator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/list-scheduler.h
\ No newline at end of file
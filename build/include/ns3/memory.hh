@@ -0,0 +1 @@
+/root/repo/src/internet/model/remy/memory.hh
\ No newline at end of file
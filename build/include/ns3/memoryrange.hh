@@ -0,0 +1 @@
+/root/repo/src/internet/model/remy/memoryrange.hh
\ No newline at end of file
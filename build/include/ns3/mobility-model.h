@@ -0,0 +1 @@
+/root/repo/src/mobility/model/mobility-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/helper/net-device-container.h
\ No newline at end of file
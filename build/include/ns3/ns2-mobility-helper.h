@@ -0,0 +1 @@
+/root/repo/src/mobility/helper/ns2-mobility-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/object-ptr-container.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/packet-socket-client.h
\ No newline at end of file
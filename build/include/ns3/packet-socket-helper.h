@@ -0,0 +1 @@
+/root/repo/src/network/helper/packet-socket-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/remy/packet.hh
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/point-to-point-layout/model/point-to-point-star.h
\ No newline at end of file
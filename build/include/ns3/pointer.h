@@ -0,0 +1 @@
+/root/repo/src/core/model/pointer.h
\ No newline at end of file
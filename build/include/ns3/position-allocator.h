@@ -0,0 +1 @@
+/root/repo/src/mobility/model/position-allocator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/queue.h
\ No newline at end of file
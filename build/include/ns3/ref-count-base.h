@@ -0,0 +1 @@
+/root/repo/src/core/model/ref-count-base.h
\ No newline at end of file
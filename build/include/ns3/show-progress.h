@@ -0,0 +1 @@
+/root/repo/src/core/model/show-progress.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/size-class-pool.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/stats.h
\ No newline at end of file
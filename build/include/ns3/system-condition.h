@@ -0,0 +1 @@
+/root/repo/src/core/model/system-condition.h
\ No newline at end of file
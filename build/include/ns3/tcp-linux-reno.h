@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-linux-reno.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/applications/helper/three-gpp-http-helper.h
\ No newline at end of file
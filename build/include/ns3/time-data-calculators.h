@@ -0,0 +1 @@
+/root/repo/src/stats/model/time-data-calculators.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/trace-source-accessor.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/trickle-timer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/type-name.h
\ No newline at end of file
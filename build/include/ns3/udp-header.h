@@ -0,0 +1 @@
+/root/repo/src/internet/model/udp-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/valgrind.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/windowed-filter.h
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/acklog.hh"
+
+using namespace ns3;
+
+// Replays a RemyTCP decision log (ns3::TcpRemy::AckLogFile) through Memory and a whisker tree.
+// With the tree the log was recorded with, every decision must match; with another tree the
+// mismatches show how often its decisions differ on the same input (open loop).
+int main (int argc, char *argv[]){
+    CommandLine cmd (__FILE__);
+    std::string input = "";
+    std::string whiskerfile = "";
+    uint32_t repeat = 1;
+    cmd.AddValue ("input", "Decision log file", input);
+    cmd.AddValue ("whiskerfile", "Whiskers to replay the log with", whiskerfile);
+    cmd.AddValue ("repeat", "Number of times to replay the log (for profiling)", repeat);
+    cmd.Parse (argc, argv);
+
+    AckLogReader reader(input);
+    if (!reader.is_open())
+    {
+      std::cerr << "Could not open decision log " << input << std::endl;
+      return -1;
+    }
+    std::shared_ptr<const WhiskerTree> whiskers = RemyWhiskerRegistry::Get(whiskerfile);
+
+    // Load the log first so the timing covers the decision path only
+    std::vector<AckRecord> records = reader.read_all();
+    AckReplay replay(*whiskers);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < repeat; i++)
+    {
+      replay.clear();
+      for (const AckRecord& record : records)
+      {
+        replay.check(record);
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "Records: " << replay.records() << std::endl;
+    std::cout << "Mismatched decisions: " << replay.mismatches() << std::endl;
+    std::cout << "Records/s: " << records.size() * (double) repeat / elapsed << std::endl;
+    return replay.mismatches() == 0 ? 0 : 1;
+}
@@ -3,6 +3,8 @@
 #include <string>
 #include <fstream>
 #include <cmath>
+#include <memory>
+#include <sstream>
 
 #include "ns3/core-module.h"
 #include "ns3/network-module.h"
@@ -16,39 +18,96 @@
 #include "../utils/topology-setup.hh"
 #include "../utils/parameter-range.hh"
 #include "../utils/network-config.hh"
+#include "../utils/parallel-runner.hh"
+#include "../utils/trace-sink.hh"
+#include "../utils/network-template.hh"
+#include "../utils/branching.hh"
+#include "../utils/convergence-monitor.hh"
  
 using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE ("SingleLinkSimUtilVer");
 
+// Socket attributes are set on the TcpL4Protocol of every node, which applies them to each socket
+// it creates (accepted sockets copy their listening socket)
+void setSocketTemplates(bool enableInt)
+{
+  for (NodeList::Iterator it = NodeList::Begin (); it != NodeList::End (); ++it)
+  {
+    Ptr<TcpL4Protocol> tcp = (*it)->GetObject<TcpL4Protocol> ();
+    if (tcp == NULL)
+    {
+      continue;
+    }
+    tcp->SetSocketAttribute ("Timestamp", BooleanValue (true));
+    tcp->SetSocketAttribute ("TimestampForRtt", BooleanValue (true));
+    if (enableInt)
+    {
+      tcp->SetSocketAttribute ("EnableInt", BooleanValue (true));
+    }
+    tcp->SetSocketAttribute ("Sack", BooleanValue (true));
+    tcp->SetSocketAttribute ("SndBufSize", UintegerValue (6000 * 512));
+    tcp->SetSocketAttribute ("RcvBufSize", UintegerValue (6000 * 512));
+    tcp->SetSocketAttribute ("DelAckCount", UintegerValue (1));
+    tcp->SetSocketAttribute ("ClockGranularity", TimeValue (Time("1ns")));
+  }
+}
+
 void setSocketParams()
 {
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/Timestamp", BooleanValue (true));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/TimestampForRtt", BooleanValue (true));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/Sack", BooleanValue (true));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/SndBufSize", UintegerValue (6000 * 512));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/RcvBufSize", UintegerValue (6000 * 512));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/DelAckCount", UintegerValue (1));
-  Config::Set("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/ClockGranularity", TimeValue (Time("1ns")));
-  return;
+  setSocketTemplates(false);
 }
 
-void setSocketParamsWithInt() // TODO: Do this with arbitrary arguments instead
+void setSocketParamsWithInt()
 {
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/Timestamp", BooleanValue (true));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/TimestampForRtt", BooleanValue (true));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/EnableInt", BooleanValue (true));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/Sack", BooleanValue (true));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/SndBufSize", UintegerValue (6000 * 512));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/RcvBufSize", UintegerValue (6000 * 512));
-  Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/DelAckCount", UintegerValue (1));
-  Config::Set("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/ClockGranularity", TimeValue (Time("1ns")));
-  return;
+  setSocketTemplates(true);
+}
+
+// Candidate whiskers evaluated from a shared warm-up (see --branchwhiskers)
+struct Branches
+{
+  double at; // ms
+  std::vector<std::string> whiskerFiles;
+  unsigned int workers;
+};
+
+// Early stop once the score terms are precise enough (see --precision)
+struct Convergence
+{
+  double precision;
+  double batch; // ms
+  uint32_t minBatches;
+  double warmup; // ms
+};
+
+// Starts a monitor of scorer if convergence is set; the monitor must outlive the run
+std::unique_ptr<Utils::ConvergenceMonitor> monitorConvergence(Utils::AllScoreTracker& scorer, const Convergence* convergence)
+{
+  std::unique_ptr<Utils::ConvergenceMonitor> monitor;
+  if (convergence != NULL)
+  {
+    monitor.reset(new Utils::ConvergenceMonitor(&scorer, MilliSeconds (convergence->batch), convergence->precision,
+                                                convergence->minBatches, MilliSeconds (convergence->warmup)));
+    monitor->start();
+  }
+  return monitor;
+}
+
+// Scores a run that may have been stopped early by monitor
+double scoreRun(Utils::AllScoreTracker& scorer, const Utils::ConvergenceMonitor* monitor, double endTime, int delayCoef, int tputCoef)
+{
+  if (monitor != NULL)
+  {
+    std::cout << monitor->toString() << std::endl;
+    std::cout << "Simulated time: " << endTime << std::endl;
+  }
+  return scorer.score(endTime, true, delayCoef, tputCoef);
 }
 
 double simulate (int num_senders, double onMean, double onBound, double offMean, double offBound, double linkRate, 
                   double linkDelay, double errorRate, int bufferLen, bool intEnabled, bool linkIntUtil, int byteCollectionInterval, int delayCoef, int tputCoef, 
-                  bool byteSwitched, double simTime)
+                  bool byteSwitched, double simTime, bool tracing, bool idealHostLinks, const Convergence* convergence = NULL,
+                  const Branches* branches = NULL)
 {
   // Setup score tracing
   Utils::AllScoreTracker scorer = Utils::AllScoreTracker(linkRate, num_senders);
@@ -57,6 +116,7 @@ double simulate (int num_senders, double onMean, double onBound, double offMean,
   Utils::DumbbellTopologyParameter* topo_desc = (Utils::DumbbellTopologyParameter*) Utils::TopologyParameterFactory::CreateTopologyParameter(Utils::TopologyType::Dumbbell, num_senders);
   // Utils::DumbbellTopologyConfig* config = (Utils::DumbbellTopologyConfig*) Utils::TopologyConfigFactory::CreateTopologyConfig(Utils::TopologyType::Dumbbell, linkDelay, bufferLen);
   Utils::DumbbellTopologyConfig config = Utils::DumbbellTopologyConfig(linkRate / pow(10, 9), linkDelay, bufferLen);
+  config.idealHostLinks = idealHostLinks;
   Utils::DumbbellTopology* topo = (Utils::DumbbellTopology*) Utils::TopologyFactory::CreateTopology(Utils::TopologyType::Dumbbell, &config);
   topo->GenerateTopology(topo_desc);
 
@@ -75,18 +135,63 @@ double simulate (int num_senders, double onMean, double onBound, double offMean,
   std::vector<uint64_t> rates = {(uint64_t) linkRate};
   if (intEnabled)
   {
-    topologySetup(topo, "ns3::DropTailQueue", "", appPatterns, rates, errorRate, simTime, intEnabled, linkIntUtil, byteCollectionInterval, false, false, byteSwitched, &scorer, &setSocketParamsWithInt);
+    topologySetup(topo, "ns3::DropTailQueue", "", appPatterns, rates, errorRate, simTime, intEnabled, linkIntUtil, byteCollectionInterval, tracing, tracing, byteSwitched, &scorer, &setSocketParamsWithInt);
   }
   else
   {
-    topologySetup(topo, "ns3::DropTailQueue", "", appPatterns, rates, errorRate, simTime, intEnabled, linkIntUtil, byteCollectionInterval, false, false, byteSwitched, &scorer, &setSocketParams);
+    topologySetup(topo, "ns3::DropTailQueue", "", appPatterns, rates, errorRate, simTime, intEnabled, linkIntUtil, byteCollectionInterval, tracing, tracing, byteSwitched, &scorer, &setSocketParams);
+  }
+
+  if (branches != NULL)
+  {
+    // Score is the mean over the branches
+    std::vector<double> scores = Utils::branchSimulation(MilliSeconds (branches->at), branches->whiskerFiles.size(), branches->workers, [&](uint32_t branch)
+    {
+      Utils::setRemyWhiskers(branches->whiskerFiles.at(branch));
+      // Each branch converges on its own, measured from the branch point
+      std::unique_ptr<Utils::ConvergenceMonitor> monitor = monitorConvergence(scorer, convergence);
+      Simulator::Stop (MilliSeconds ((int)simTime) - Simulator::Now ());
+      Simulator::Run ();
+      double score = scoreRun(scorer, monitor.get(), Simulator::Now ().GetSeconds (), delayCoef, tputCoef);
+      std::cout << "Branch " << branches->whiskerFiles.at(branch) << " score: " << score << std::endl;
+      return score;
+    });
+    Simulator::Destroy ();
+    double total = 0;
+    for (double score : scores)
+    {
+      total += score;
+    }
+    return total / scores.size();
   }
 
+  std::unique_ptr<Utils::ConvergenceMonitor> monitor = monitorConvergence(scorer, convergence);
   Simulator::Stop (MilliSeconds ((int)simTime)); // Give time for applications to actually stop for accounting purposes
   Simulator::Run ();
+  double endTime = Simulator::Now ().GetSeconds ();
   Simulator::Destroy ();
   
-  return scorer.score(simTime/1000.0, true, delayCoef, tputCoef);
+  return scoreRun(scorer, monitor.get(), endTime, delayCoef, tputCoef);
+}
+
+// Runs one sample on a network built beforehand (see --reuse)
+double simulateOnTemplate (Utils::DumbbellTemplate& network, double onMean, double offMean, double linkRate, double linkDelay,
+                           double errorRate, int bufferLen, int delayCoef, int tputCoef, bool destroy,
+                           const Convergence* convergence = NULL)
+{
+  const Utils::DumbbellTemplate::Shape& shape = network.getShape();
+  network.apply(onMean, offMean, linkRate, linkDelay, errorRate, bufferLen);
+
+  std::unique_ptr<Utils::ConvergenceMonitor> monitor = monitorConvergence(network.getScorer(), convergence);
+  Simulator::Stop (MilliSeconds ((int)shape.simTime));
+  Simulator::Run ();
+  double score = scoreRun(network.getScorer(), monitor.get(), Simulator::Now ().GetSeconds (), delayCoef, tputCoef);
+  // The job's process exits right after, so tear down only if socket destructors have work to do
+  if (destroy)
+  {
+    Simulator::Destroy ();
+  }
+  return score;
 }
 
 int main (int argc, char *argv[]){
@@ -105,6 +210,19 @@ int main (int argc, char *argv[]){
     bool byteSwitched = false;
     double simTime = 11.0;
     bool saveWhiskerStats = false;
+    unsigned int workers = 1;
+    std::string tracefile = "";
+    std::string acklog = "";
+    bool reuse = false;
+    std::string branchWhiskers = "";
+    double branchAt = 0;
+    unsigned int branchWorkers = 1;
+    double precision = 0;
+    double batchInterval = 1000;
+    uint32_t minBatches = 10;
+    double warmup = 0;
+    bool crn = false;
+    bool idealHostLinks = false;
     cmd.AddValue ("cca", "cca", cca);
     cmd.AddValue ("netfile", "Network configuration file", netfile);
     cmd.AddValue ("samplesize", "number of network configurations", samplesize);
@@ -118,19 +236,33 @@ int main (int argc, char *argv[]){
     cmd.AddValue ("tputcoef", "Coefficient on tput in the score", tputCoef);
     cmd.AddValue ("byteswitched", "Whether the senders are byteswitched or not", byteSwitched);
     cmd.AddValue ("simtime", "Simulation time", simTime);
-    cmd.AddValue ("savewhiskerstats", "Set to true to save whisker usage stats", saveWhiskerStats);
+    cmd.AddValue ("savewhiskerstats", "Set to true to save whisker usage stats of each run to whisker-usage.<run>", saveWhiskerStats);
+    cmd.AddValue ("workers", "Number of simulations run in parallel (0 uses all cores)", workers);
+    cmd.AddValue ("tracefile", "If set, write device and host traces of each run to <tracefile>.<run> in binary", tracefile);
+    cmd.AddValue ("reuse", "Build the network once per number of senders and only reconfigure it for each run (no tracing)", reuse);
+    cmd.AddValue ("branchwhiskers", "Comma-separated whisker files; each run is simulated with whiskerfile until branchat, then continued once per file", branchWhiskers);
+    cmd.AddValue ("branchat", "Time (ms) at which runs branch into the whiskers of branchwhiskers", branchAt);
+    cmd.AddValue ("branchworkers", "Number of branches of a run simulated in parallel (0 uses all cores)", branchWorkers);
+    cmd.AddValue ("acklog", "If set, log the RemyTCP decisions of each run to <acklog>.<run> for remy-replay", acklog);
+    cmd.AddValue ("precision", "If set, stop a run early once the 95% confidence half-widths of its log2 throughput and delay terms are at most this", precision);
+    cmd.AddValue ("batchinterval", "Length (ms) of the batches over which precision is estimated", batchInterval);
+    cmd.AddValue ("minbatches", "Minimum number of batches before a run can stop early", minBatches);
+    cmd.AddValue ("warmup", "Time (ms) excluded from the precision estimate at the start of a run", warmup);
+    cmd.AddValue ("crn", "Common random numbers: every flow's on/off times, losses and picks depend only on seed, configuration, run and flow", crn);
+    cmd.AddValue ("idealhostlinks", "Host links deliver packets after their delay only, without queueing or serialization events", idealHostLinks);
     // cmd.AddValue ("reversewhisker", "Reversepath whisker file", revwhiskerfile);
     cmd.Parse (argc, argv);
 
     // Set CCA Parameters
-    setenv("WHISKERS", whiskerfile.c_str(), 1);
+    Config::SetDefault ("ns3::TcpRemy::WhiskerFile", StringValue (whiskerfile));
     int dims = intenabled ? 9 : 7;
-    setenv("NUMDIMS", std::to_string(dims).c_str(), 1);
-    setenv("SAVEWHISKERS", std::to_string((int)saveWhiskerStats).c_str(), 1);
+    Config::SetDefault ("ns3::TcpRemy::SignalDimensions", UintegerValue (dims));
     Config::SetDefault ("ns3::TcpL4Protocol::SocketType", StringValue (cca));
 
     Config::SetDefault("ns3::FifoQueueDisc::MarkEcnThreshold", DoubleValue(7));
 
+    Utils::SetCommonRandomNumbers(crn);
+
     std::cout << "Parsed input" << std::endl;
 
     Time::SetResolution (Time::NS);
@@ -153,7 +285,8 @@ int main (int argc, char *argv[]){
 
     std::default_random_engine prng(seed);
 
-    ns3::RngSeedManager::SetSeed(prng());
+    uint32_t masterSeed = prng();
+    ns3::RngSeedManager::SetSeed(masterSeed);
 
     std::ifstream file;
     file.open( netfile );
@@ -172,18 +305,100 @@ int main (int argc, char *argv[]){
 
     std::vector<NetworkConfig> netConfigs =  NetworkRange::generateNetworks(configrange, &prng, samplesize, intenabled); // TODO: Move necessary stuff to utils 
 
+    // Parse the whiskers once so every worker shares them copy-on-write
+    if (whiskerfile != "")
+    {
+      RemyWhiskerRegistry::Get(whiskerfile);
+    }
+
+    Branches branches = {branchAt, {}, branchWorkers};
+    std::stringstream branchList(branchWhiskers);
+    std::string branchFile;
+    while (std::getline(branchList, branchFile, ','))
+    {
+      if (branchFile != "")
+      {
+        RemyWhiskerRegistry::Get(branchFile);
+        branches.whiskerFiles.push_back(branchFile);
+      }
+    }
+
+    Convergence convergence = {precision, batchInterval, minBatches, warmup};
+
+    // With --reuse, the parent keeps the network of the next job built and every job runs on its own copy
+    std::unique_ptr<Utils::DumbbellTemplate> network;
+    reuse = reuse && tracefile == "" && branches.whiskerFiles.empty();
+    auto prepare = [&](uint32_t job)
+    {
+      NetworkConfig cfg = netConfigs.at(job / configruns);
+      Utils::DumbbellTemplate::Shape shape = {cfg.n_src, intenabled, linkIntUtil, linkInterval, byteSwitched, simTime,
+                                              intenabled ? &setSocketParamsWithInt : &setSocketParams, idealHostLinks};
+      if (network == NULL || !(network->getShape() == shape))
+      {
+        network.reset();
+        network.reset(new Utils::DumbbellTemplate(shape));
+      }
+    };
+
+    // One job per (configuration, run) pair
+    Utils::ParallelRunner runner(workers, masterSeed);
+    std::vector<double> scores = runner.run(netConfigs.size() * configruns, [&](uint32_t job)
+    {
+      NetworkConfig cfg = netConfigs.at(job / configruns);
+      std::cout << "Simulating... " << std::endl;
+      std::unique_ptr<Utils::BinaryTraceSink> sink;
+      if (tracefile != "")
+      {
+        sink.reset(new Utils::BinaryTraceSink(tracefile + "." + std::to_string(job)));
+        Utils::SetTraceSink(sink.get());
+      }
+      if (saveWhiskerStats)
+      {
+        Config::SetDefault ("ns3::TcpRemy::UsageStatsFile", StringValue ("whisker-usage." + std::to_string(job)));
+        Config::SetDefault ("ns3::TcpRemy::UsageStatsPerFlow", BooleanValue (true));
+      }
+      if (acklog != "")
+      {
+        Config::SetDefault ("ns3::TcpRemy::AckLogFile", StringValue (acklog + "." + std::to_string(job)));
+      }
+      double score;
+      if (reuse)
+      {
+        score = simulateOnTemplate(*network, cfg.on_mean, cfg.off_mean, cfg.link_rate, cfg.rtt/2, cfg.error_rate,
+                                   cfg.buffer_size, delayCoef, tputCoef, saveWhiskerStats,
+                                   precision > 0 ? &convergence : NULL);
+      }
+      else
+      {
+        score = simulate(cfg.n_src, cfg.on_mean, 0.0, cfg.off_mean, 0.0, cfg.link_rate, 
+                         cfg.rtt/2, cfg.error_rate, cfg.buffer_size, intenabled, linkIntUtil, linkInterval, delayCoef, 
+                         tputCoef, byteSwitched, simTime, tracefile != "", idealHostLinks,
+                         precision > 0 ? &convergence : NULL,
+                         branches.whiskerFiles.empty() ? NULL : &branches);
+      }
+      Utils::SetTraceSink(NULL);
+      // Workers leave through _exit, so write the usage counts and decision log here
+      RemyWhiskerUsage::Write();
+      RemyAckLog::Close();
+      std::cout << cfg.toString();
+      std::cout << "Score: " << score << std::endl;
+      return score;
+    }, reuse ? Utils::ParallelRunner::Prepare(prepare) : Utils::ParallelRunner::Prepare());
+    network.reset();
+
     double total_score = 0;
-    for (NetworkConfig cfg : netConfigs)
+    int completed = 0;
+    for (double score : scores)
     {
-      for (int i = 0; i < configruns; i++)
+      if (!std::isnan(score))
       {
-        std::cout << "Simulating... " << std::endl;
-        double score = simulate(cfg.n_src, cfg.on_mean, 0.0, cfg.off_mean, 0.0, cfg.link_rate, 
-                                cfg.rtt/2, cfg.error_rate, cfg.buffer_size, intenabled, linkIntUtil, linkInterval, delayCoef, 
-                                tputCoef, byteSwitched, simTime);
         total_score += score;
-        std::cout << cfg.toString();
-        std::cout << "Score: " << score << std::endl;
+        completed++;
       }
     }
-}
+    std::cout << "Completed runs: " << completed << "/" << scores.size() << std::endl;
+    if (completed > 0)
+    {
+      std::cout << "Mean score: " << total_score / completed << std::endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+
+#include "ns3/core-module.h"
+
+#include "../utils/trace-sink.hh"
+
+using namespace ns3;
+
+// Converts a binary trace written by Utils::BinaryTraceSink to the CSV format of the text traces
+int main (int argc, char *argv[]){
+    CommandLine cmd (__FILE__);
+    std::string input = "";
+    std::string output = "";
+    cmd.AddValue ("input", "Binary trace file", input);
+    cmd.AddValue ("output", "CSV file to write. If none, writes to stdout.", output);
+    cmd.Parse (argc, argv);
+
+    Time::SetResolution (Time::NS);
+
+    Utils::BinaryTraceReader reader(input);
+    if (!reader.isOpen())
+    {
+      std::cerr << "Could not open trace file " << input << std::endl;
+      return -1;
+    }
+
+    std::ofstream file;
+    if (output != "")
+    {
+      file.open(output);
+      if (!file.is_open())
+      {
+        std::cerr << "Could not open file " << output << std::endl;
+        return -1;
+      }
+    }
+    std::ostream& os = output != "" ? file : std::cout;
+
+    Utils::TraceRecord record;
+    uint64_t records = 0;
+    while (reader.next(record))
+    {
+      Utils::TraceSink::formatEvent(os, record.ns / 1e9, reader.getContext(record.context), record.event, record.value);
+      records++;
+    }
+    os.flush();
+    std::cerr << "Converted " << records << " records" << std::endl;
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+
+#include "branching.hh"
+
+using namespace ns3;
+
+std::vector<double> Utils::branchSimulation(Time at, uint32_t branches, unsigned int workers, ParallelRunner::Job branch)
+{
+  if (at > Simulator::Now())
+  {
+    Simulator::Stop(at - Simulator::Now());
+    Simulator::Run();
+  }
+
+  ParallelRunner runner(workers, 0, false);
+  return runner.run(branches, branch);
+}
+
+void Utils::setRemyWhiskers(const std::string& filename)
+{
+  Config::SetDefault("ns3::TcpRemy::WhiskerFile", StringValue(filename));
+
+  // Sockets that already exist, including listening sockets that fork the accepted ones
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node)
+  {
+    Ptr<TcpL4Protocol> tcp = (*node)->GetObject<TcpL4Protocol>();
+    if (tcp == NULL)
+    {
+      continue;
+    }
+    ObjectVectorValue sockets;
+    tcp->GetAttribute("SocketList", sockets);
+    for (ObjectVectorValue::Iterator it = sockets.Begin(); it != sockets.End(); ++it)
+    {
+      PointerValue congestionOps;
+      it->second->GetAttribute("CongestionOps", congestionOps);
+      Ptr<TcpRemy> remy = DynamicCast<TcpRemy>(congestionOps.Get<TcpCongestionOps>());
+      if (remy != NULL)
+      {
+        remy->SetWhiskerFile(filename);
+      }
+    }
+  }
+}
@@ -0,0 +1,33 @@
+#ifndef BRANCHING_H
+#define BRANCHING_H
+
+#include <string>
+#include <vector>
+
+#include "ns3/core-module.h"
+
+#include "parallel-runner.hh"
+
+using namespace ns3;
+
+namespace Utils
+{
+
+/*
+ * Runs the current simulation until `at`, then continues it in one forked child per branch.
+ *
+ * Every branch inherits the paused simulation copy-on-write, with the same pending events and
+ * random variable streams, so all branches share one warm-up and see the same random numbers
+ * until they diverge. branch(i) changes what branch i should differ in (e.g. setRemyWhiskers),
+ * runs the rest of the simulation and returns its score. Branch output is printed in branch order.
+ *
+ * The calling process is left paused at `at`.
+ */
+std::vector<double> branchSimulation(Time at, uint32_t branches, unsigned int workers, ParallelRunner::Job branch);
+
+// Makes every TcpRemy, existing or created later, use the whiskers in filename
+void setRemyWhiskers(const std::string& filename);
+
+}
+
+#endif /* BRANCHING_H */
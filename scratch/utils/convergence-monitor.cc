@@ -0,0 +1,131 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include "convergence-monitor.hh"
+
+// Two-sided 95% quantiles of Student's t for 1..30 degrees of freedom
+static const double T_QUANTILES[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                     2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                     2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+static double tQuantile(uint32_t dof)
+{
+  return dof <= 30 ? T_QUANTILES[dof - 1] : 1.96;
+}
+
+Utils::ConvergenceMonitor::ConvergenceMonitor(AllScoreTracker* scorer, Time batch, double precision, uint32_t minBatches,
+                                              Time warmup, bool remyShare)
+  : scorer(scorer),
+    batch(batch),
+    precision(precision),
+    minBatches(std::max(minBatches, 2u)),
+    warmup(warmup),
+    remyShare(remyShare),
+    batches(0),
+    tputMean(0),
+    tputM2(0),
+    delayMean(0),
+    delayM2(0),
+    converged(false)
+{
+}
+
+void Utils::ConvergenceMonitor::start(void)
+{
+  Simulator::Schedule(warmup, [this]()
+  {
+    snapshot(Simulator::Now().GetSeconds());
+    Simulator::Schedule(batch, &ConvergenceMonitor::endBatch, this);
+  });
+}
+
+void Utils::ConvergenceMonitor::snapshot(double now)
+{
+  last.resize(scorer->flowTrackers.size());
+  for (uint32_t slot = 0; slot < last.size(); slot++)
+  {
+    const FlowScoreTracker& flow = scorer->flowTrackers[slot];
+    last[slot] = {flow.total_packets, flow.total_delay, scorer->flowShare(slot, now)};
+  }
+}
+
+void Utils::ConvergenceMonitor::endBatch(void)
+{
+  double now = Simulator::Now().GetSeconds();
+  double tput = 0;
+  double delay = 0;
+  uint32_t flows = 0;
+  for (uint32_t slot = 0; slot < scorer->flowTrackers.size(); slot++)
+  {
+    const FlowScoreTracker& flow = scorer->flowTrackers[slot];
+    FlowSample start = slot < last.size() ? last[slot] : FlowSample {0, 0, 0};
+    uint64_t packets = flow.total_packets - start.packets;
+    double share = scorer->flowShare(slot, now) - start.share;
+    if (remyShare)
+    {
+      share = (share / scorer->bandwidth) * 1000000.0;
+    }
+    if (packets == 0 || share <= 0)
+    {
+      continue;
+    }
+    tput += log2(packets / share);
+    delay += log2(((flow.total_delay - start.delay) / packets) / 100.0);
+    flows++;
+  }
+  snapshot(now);
+
+  // A batch in which no flow got anything through says nothing about the score terms
+  if (flows != 0)
+  {
+    tput /= flows;
+    delay /= flows;
+    batches++;
+    double tputDelta = tput - tputMean;
+    tputMean += tputDelta / batches;
+    tputM2 += tputDelta * (tput - tputMean);
+    double delayDelta = delay - delayMean;
+    delayMean += delayDelta / batches;
+    delayM2 += delayDelta * (delay - delayMean);
+  }
+
+  if (batches >= minBatches && throughput().halfWidth <= precision && this->delay().halfWidth <= precision)
+  {
+    converged = true;
+    Simulator::Stop();
+    return;
+  }
+  Simulator::Schedule(batch, &ConvergenceMonitor::endBatch, this);
+}
+
+Utils::ConvergenceMonitor::Estimate Utils::ConvergenceMonitor::estimate(double mean, double m2) const
+{
+  if (batches < 2)
+  {
+    return {mean, std::numeric_limits<double>::infinity()};
+  }
+  double stdev = std::sqrt(m2 / (batches - 1));
+  return {mean, tQuantile(batches - 1) * stdev / std::sqrt(batches)};
+}
+
+Utils::ConvergenceMonitor::Estimate Utils::ConvergenceMonitor::throughput(void) const
+{
+  return estimate(tputMean, tputM2);
+}
+
+Utils::ConvergenceMonitor::Estimate Utils::ConvergenceMonitor::delay(void) const
+{
+  return estimate(delayMean, delayM2);
+}
+
+std::string Utils::ConvergenceMonitor::toString(void) const
+{
+  std::ostringstream oss;
+  Estimate tput = throughput();
+  Estimate delay = this->delay();
+  oss << "Precision: throughput utility " << tput.mean << " +- " << tput.halfWidth
+      << "; delay penalty " << delay.mean << " +- " << delay.halfWidth
+      << "; " << batches << " batches; " << (converged ? "converged" : "not converged");
+  return oss.str();
+}
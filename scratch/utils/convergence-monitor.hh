@@ -0,0 +1,81 @@
+#ifndef CONVERGENCE_MONITOR_H
+#define CONVERGENCE_MONITOR_H
+
+#include <string>
+#include <vector>
+
+#include "ns3/core-module.h"
+
+#include "tracing-utils.hh"
+
+using namespace ns3;
+
+namespace Utils
+{
+
+/*
+ * Stops a simulation once the score terms of an AllScoreTracker are known to a given precision.
+ *
+ * After the warm-up, the run is cut into batches of equal length. For every batch, the monitor
+ * computes the log2 throughput utility and log2 delay penalty of each flow that received packets
+ * during it (as FlowScoreTracker::score does over the whole run) and averages them over the
+ * flows. The batch means give a running estimate of each term and a 95% confidence interval
+ * (Student t). Once both half-widths are at most `precision` (in log2 units, so 0.05 is about
+ * +-3.5%) after at least minBatches batches, the monitor calls Simulator::Stop; otherwise the
+ * run ends at its own stop time.
+ *
+ * Score the run with Simulator::Now () as the end time, since it may stop early.
+ */
+class ConvergenceMonitor
+{
+  public:
+    struct Estimate
+    {
+        double mean;
+        double halfWidth; // of the 95% confidence interval; infinite with fewer than 2 batches
+    };
+
+    ConvergenceMonitor(AllScoreTracker* scorer, Time batch, double precision, uint32_t minBatches = 10,
+                       Time warmup = Seconds(0), bool remyShare = true);
+
+    // Schedule the first sample; call before Simulator::Run
+    void start(void);
+
+    bool isConverged(void) const { return converged; }
+    uint32_t getBatches(void) const { return batches; }
+    Estimate throughput(void) const;
+    Estimate delay(void) const;
+
+    std::string toString(void) const;
+
+  private:
+    // Counters of a flow at the start of the current batch
+    struct FlowSample
+    {
+        uint64_t packets;
+        double delay;
+        double share;
+    };
+
+    AllScoreTracker* scorer;
+    Time batch;
+    double precision;
+    uint32_t minBatches;
+    Time warmup;
+    bool remyShare;
+
+    std::vector<FlowSample> last;
+    uint32_t batches;
+    // Running means and sums of squared deviations of the batch means (Welford)
+    double tputMean, tputM2;
+    double delayMean, delayM2;
+    bool converged;
+
+    void snapshot(double now);
+    void endBatch(void);
+    Estimate estimate(double mean, double m2) const;
+};
+
+}
+
+#endif /* CONVERGENCE_MONITOR_H */
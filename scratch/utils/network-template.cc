@@ -0,0 +1,78 @@
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/applications-module.h"
+
+#include "network-template.hh"
+
+using namespace ns3;
+
+bool Utils::DumbbellTemplate::Shape::operator==(const Shape& other) const
+{
+  return numSenders == other.numSenders && intEnabled == other.intEnabled && linkIntUtil == other.linkIntUtil &&
+         byteCounterInterval == other.byteCounterInterval && byteSwitched == other.byteSwitched &&
+         simTime == other.simTime && socketFunc == other.socketFunc && idealHostLinks == other.idealHostLinks;
+}
+
+Utils::DumbbellTemplate::DumbbellTemplate(const Shape& shape)
+  : shape(shape),
+    config(),
+    topology(&config),
+    scorer(0, shape.numSenders)
+{
+  config.idealHostLinks = shape.idealHostLinks;
+  DumbbellTopologyParameter desc(shape.numSenders);
+  topology.GenerateTopology(&desc);
+
+  // Placeholder parameters; every run sets its own with apply()
+  std::vector<ApplicationPattern> appPatterns = {ApplicationPattern(1, 0, 1, 0)};
+  std::vector<uint64_t> rates = {(uint64_t) 1e9};
+  topologySetup(&topology, "ns3::DropTailQueue", "", appPatterns, rates, 0, shape.simTime, shape.intEnabled,
+                shape.linkIntUtil, shape.byteCounterInterval, false, false, shape.byteSwitched, &scorer,
+                shape.socketFunc, &handles);
+}
+
+Utils::DumbbellTemplate::~DumbbellTemplate()
+{
+  Simulator::Destroy();
+}
+
+void Utils::DumbbellTemplate::apply(double onMean, double offMean, double linkRate, double linkDelay, double errorRate, int bufferLen)
+{
+  // Same link parameters as a DumbbellTopologyConfig(linkRate / 1e9, linkDelay, bufferLen) topology
+  config.bottleneckRate = linkRate / pow(10, 9);
+  config.bottleneckDelay = linkDelay;
+  config.bottleneckBufferLen = bufferLen;
+  topology.updateLinkParameters();
+
+  for (size_t i = 0; i < handles.links.size(); i++)
+  {
+    const Link& link = topology.links.at(i);
+    TopologyHandles::LinkHandles& linkHandles = handles.links.at(i);
+    for (uint32_t j = 0; j < linkHandles.devices.GetN(); j++)
+    {
+      Ptr<PointToPointNetDevice> device = DynamicCast<PointToPointNetDevice>(linkHandles.devices.Get(j));
+      device->SetAttribute("DataRate", StringValue(link.linkRate));
+      device->GetQueue()->SetMaxSize(QueueSize(link.bufferLen));
+    }
+    linkHandles.devices.Get(0)->GetChannel()->SetAttribute("Delay", StringValue(link.delay));
+    linkHandles.errorModel->SetRate(errorRate);
+  }
+
+  for (TopologyHandles::FlowHandles& flow : handles.flows)
+  {
+    flow.sender->SetAttribute("DataRate", DataRateValue(DataRate((uint64_t) linkRate)));
+    if (!shape.byteSwitched)
+    {
+      flow.onTime->SetAttribute("Mean", DoubleValue(onMean));
+    }
+    flow.offTime->SetAttribute("Mean", DoubleValue(offMean));
+    if (flow.maxBytes != NULL)
+    {
+      flow.sender->SetAttribute("MaxBytes", UintegerValue(onMean * 512));
+      flow.maxBytes->SetAttribute("Mean", DoubleValue(onMean * 512));
+    }
+  }
+
+  scorer.bandwidth = linkRate;
+}
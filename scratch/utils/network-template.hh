@@ -0,0 +1,68 @@
+#ifndef NETWORK_TEMPLATE_H
+#define NETWORK_TEMPLATE_H
+
+#include "ns3/core-module.h"
+
+#include "sim-topology.hh"
+#include "topology-setup.hh"
+#include "tracing-utils.hh"
+
+using namespace ns3;
+
+namespace Utils {
+
+/*
+ * A dumbbell network built once and reconfigured for every run of the same shape.
+ *
+ * Build it in the parent of the ParallelRunner workers (see ParallelRunner::run's prepare hook):
+ * each forked job inherits a copy in which the simulator clock is still at zero and only the
+ * setup events are queued, applies its link and application parameters with apply() and runs.
+ * Jobs thus skip building the nodes, stacks, devices and routes, and the dynamic state of one
+ * job never reaches another. ParallelRunner restarts the random variable streams of the copy
+ * from the job's run number.
+ *
+ * Tracing hooks bind their sink when they are connected, so templates are built without tracing.
+ */
+class DumbbellTemplate
+{
+  public:
+    // Parameters that require rebuilding the network
+    struct Shape
+    {
+        int numSenders;
+        bool intEnabled;
+        bool linkIntUtil;
+        int byteCounterInterval;
+        bool byteSwitched;
+        double simTime;
+        void (*socketFunc) (void);
+        bool idealHostLinks;
+
+        bool operator==(const Shape& other) const;
+    };
+
+    DumbbellTemplate(const Shape& shape);
+    // Destroys the simulation holding the network
+    ~DumbbellTemplate();
+
+    DumbbellTemplate(const DumbbellTemplate&) = delete;
+    DumbbellTemplate& operator=(const DumbbellTemplate&) = delete;
+
+    const Shape& getShape(void) const { return shape; }
+
+    // Set the parameters of the next run; call before Simulator::Run
+    void apply(double onMean, double offMean, double linkRate, double linkDelay, double errorRate, int bufferLen);
+
+    AllScoreTracker& getScorer(void) { return scorer; }
+
+  private:
+    Shape shape;
+    DumbbellTopologyConfig config;
+    DumbbellTopology topology;
+    AllScoreTracker scorer;
+    TopologyHandles handles;
+};
+
+}
+
+#endif /* NETWORK_TEMPLATE_H */
@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <thread>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ns3/core-module.h"
+
+#include "parallel-runner.hh"
+
+using namespace ns3;
+
+Utils::ParallelRunner::ParallelRunner(unsigned int workers, uint32_t masterSeed, bool seedJobs)
+  : workers(workers),
+    masterSeed(masterSeed),
+    seedJobs(seedJobs)
+{
+  if (this->workers == 0)
+  {
+    this->workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+}
+
+void Utils::ParallelRunner::seedJob(uint32_t job)
+{
+  // Same seed, independent run number per job: the standard ns-3 way to get independent replications
+  RngSeedManager::SetSeed(masterSeed);
+  RngSeedManager::SetRun(job + 1);
+  // Streams inherited from the parent restart from the job's run as well
+  RandomVariableStream::ResetAll();
+  srand(masterSeed + job);
+}
+
+std::vector<double> Utils::ParallelRunner::run(uint32_t numJobs, Job job, Prepare prepare)
+{
+  if (numJobs == 0)
+  {
+    return std::vector<double>();
+  }
+
+  // Children report their score through a shared anonymous mapping indexed by job
+  double* results = (double*) mmap(NULL, numJobs * sizeof(double), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (results == MAP_FAILED)
+  {
+    NS_FATAL_ERROR("Could not map result buffer: " << strerror(errno));
+  }
+  std::fill_n(results, numJobs, std::numeric_limits<double>::quiet_NaN());
+
+  std::vector<FILE*> logs(numJobs, NULL);
+  std::vector<bool> finished(numJobs, false);
+  std::map<pid_t, uint32_t> running;
+  uint32_t next = 0;
+  uint32_t printed = 0;
+
+  std::cout.flush();
+  fflush(stdout);
+
+  while (next < numJobs || !running.empty())
+  {
+    while (next < numJobs && running.size() < workers)
+    {
+      if (prepare)
+      {
+        prepare(next);
+        std::cout.flush();
+        fflush(stdout);
+      }
+
+      FILE* log = tmpfile();
+      if (log == NULL)
+      {
+        NS_FATAL_ERROR("Could not create log for job " << next << ": " << strerror(errno));
+      }
+
+      pid_t pid = fork();
+      if (pid < 0)
+      {
+        NS_FATAL_ERROR("Could not fork job " << next << ": " << strerror(errno));
+      }
+      if (pid == 0)
+      {
+        dup2(fileno(log), STDOUT_FILENO);
+        dup2(fileno(log), STDERR_FILENO);
+        if (seedJobs)
+        {
+          seedJob(next);
+        }
+        results[next] = job(next);
+        std::cout.flush();
+        fflush(stdout);
+        _exit(0);
+      }
+
+      logs[next] = log;
+      running[pid] = next;
+      next++;
+    }
+
+    int status;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      NS_FATAL_ERROR("waitpid failed: " << strerror(errno));
+    }
+    auto it = running.find(pid);
+    if (it == running.end())
+    {
+      continue;
+    }
+    uint32_t done = it->second;
+    running.erase(it);
+    finished[done] = true;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+      results[done] = std::numeric_limits<double>::quiet_NaN();
+      std::cerr << "Job " << done << " failed (status " << status << ")" << std::endl;
+    }
+
+    // Replay job output in job order
+    while (printed < numJobs && finished[printed])
+    {
+      char buf[65536];
+      size_t len;
+      rewind(logs[printed]);
+      while ((len = fread(buf, 1, sizeof(buf), logs[printed])) > 0)
+      {
+        fwrite(buf, 1, len, stdout);
+      }
+      fflush(stdout);
+      fclose(logs[printed]);
+      logs[printed] = NULL;
+      printed++;
+    }
+  }
+
+  std::vector<double> scores(results, results + numJobs);
+  munmap(results, numJobs * sizeof(double));
+  return scores;
+}
@@ -0,0 +1,56 @@
+#ifndef PARALLEL_RUNNER_H
+#define PARALLEL_RUNNER_H
+
+#include <functional>
+#include <vector>
+#include <stdint.h>
+
+namespace Utils
+{
+
+/**
+ * Runs independent simulation jobs in a pool of forked worker processes.
+ *
+ * Each job runs in its own child, so the process-global simulator never
+ * sees two jobs at once. Jobs are seeded from the master seed and their
+ * index only, so a job's score does not depend on the number of workers
+ * or on the order in which jobs finish. Anything a job prints is
+ * replayed on stdout in job order.
+ */
+class ParallelRunner
+{
+public:
+    typedef std::function<double (uint32_t job)> Job;
+    typedef std::function<void (uint32_t job)> Prepare;
+
+    /**
+     * \param workers maximum number of concurrent child processes (0 uses all cores)
+     * \param masterSeed seed from which every job's seeds are derived
+     * \param seedJobs if false, jobs keep the random state of the parent instead
+     *        (so that forked copies of a running simulation draw the same numbers)
+     */
+    ParallelRunner(unsigned int workers, uint32_t masterSeed, bool seedJobs = true);
+
+    /**
+     * Run jobs 0..numJobs-1 and collect their scores.
+     * \param numJobs number of jobs
+     * \param job function run in the child for each job index
+     * \param prepare if set, run in the parent just before each job is forked, e.g. to
+     *        build state the job inherits (such as a DumbbellTemplate)
+     * \return the score of each job, in job order (NaN if the child failed)
+     */
+    std::vector<double> run(uint32_t numJobs, Job job, Prepare prepare = Prepare());
+
+    unsigned int getWorkers(void) const { return workers; }
+
+private:
+    unsigned int workers;
+    uint32_t masterSeed;
+    bool seedJobs;
+
+    void seedJob(uint32_t job);
+};
+
+}
+
+#endif /* PARALLEL_RUNNER_H */
@@ -52,13 +52,14 @@ Link::Link(Utils::TopologyNode *n1, Utils::TopologyNode *n2, std::string rate, s
   bufferLen = qLen;
   addresses = addr;
   mask = "255.255.255.0";
+  ideal = false;
 }
 
 std::string Link::toString(void)
 {
   std::stringstream ss;
   ss << "Link from node " << node1->id << " to node " << node2->id << 
-  " (rate= " << linkRate << "; delay= " << delay << "; bufferLen= " << bufferLen << "; address= " << addresses << " " << mask << ")";
+  " (rate= " << linkRate << "; delay= " << delay << "; bufferLen= " << bufferLen << "; address= " << addresses << " " << mask << (ideal ? "; ideal" : "") << ")";
   return ss.str();
 }
 
@@ -520,10 +521,17 @@ void DumbbellTopology::addLink(Utils::TopologyNode *n1, Utils::TopologyNode *n2)
   n1->addNeighbor(n2->id, n2->isEndHost);
   n2->addNeighbor(n1->id, n1->isEndHost);
   
+  links.push_back(Link(n1, n2, "", "", "", getNewSubnet()));
+  setLinkParameters(links.back());
+}
+
+void DumbbellTopology::setLinkParameters(Link& link)
+{
   double rate;
   double linkDelay;
   int bufferLen;
-  if (n1->isEndHost || n2->isEndHost)
+  bool isHostLink = link.node1->isEndHost || link.node2->isEndHost;
+  if (isHostLink)
   {
     rate = config->hostLinkRate;
     linkDelay = 0.0;
@@ -536,11 +544,18 @@ void DumbbellTopology::addLink(Utils::TopologyNode *n1, Utils::TopologyNode *n2)
     bufferLen = config->bottleneckBufferLen;
   }
   
-  std::string r = std::to_string(rate) + "Gbps"; 
-  std::string d = std::to_string(linkDelay) + "us";
-  std::string q = std::to_string(bufferLen) + "p"; 
-  
-  links.push_back(Link(n1, n2, r, d, q, getNewSubnet()));
+  link.linkRate = std::to_string(rate) + "Gbps"; 
+  link.delay = std::to_string(linkDelay) + "us";
+  link.bufferLen = std::to_string(bufferLen) + "p"; 
+  link.ideal = isHostLink && config->idealHostLinks;
+}
+
+void DumbbellTopology::updateLinkParameters(void)
+{
+  for (Link& link : links)
+  {
+    setLinkParameters(link);
+  }
 }
 
 std::vector<std::vector<int>> DumbbellTopology::getTrafficMatrix(void) 
@@ -757,6 +772,7 @@ void LineTopology::addLink(Utils::TopologyNode *n1, Utils::TopologyNode *n2)
   std::string q = std::to_string(bufferLen) + "p";
   
   links.push_back(Link(n1, n2, r, d, q, getNewSubnet()));
+  links.back().ideal = (n1->isEndHost || n2->isEndHost) && config->idealHostLinks;
 }
 
 std::vector<std::vector<int>> LineTopology::getTrafficMatrix(void) 
@@ -40,6 +40,7 @@ public:
     std::string bufferLen;
     std::string addresses;
     std::string mask;
+    bool ideal; // no queueing or serialization, only the delay (PointToPointNetDevice::Ideal)
 
     Link(TopologyNode *n1, TopologyNode *n2, std::string rate, std::string propDelay, std::string qLen, std::string addr);
     std::string toString(void);
@@ -196,6 +197,7 @@ public:
     int bottleneckBufferLen = 100;
     int hostBufferLen = 10000;
     double hostLinkRate = 1000000;
+    bool idealHostLinks = false; // host links only add their delay to the path
 
     DumbbellTopologyConfig(double btlRate=0, double btlDelay=0, int btlBuf=0, int hostBuf=0, double hostLinkRate=0);
 
@@ -221,11 +223,14 @@ public:
     std::vector<TopologyNode*> getHosts();
     void GenerateTopology (DumbbellTopologyParameter* params);
     std::vector<std::vector<int>> getTrafficMatrix();
+    // Recompute the rate, delay and buffer of every link after config changed
+    void updateLinkParameters(void);
 
 private:
     int _n;
 
     void addLink(TopologyNode *n1, TopologyNode *n2);
+    void setLinkParameters(Link& link);
 };
 
 class LineTopologyParameter: public TopologyParameter
@@ -249,6 +254,7 @@ public:
     int bufferLen = 100;
     int hostBufferLen = 10000;
     double hostLinkRate = 1000000;
+    bool idealHostLinks = false; // host links only add their delay to the path
 
     LineTopologyConfig(double maxDelay=0, double btlRate=0, int buf=0, int hostBuf=0, double hostRate=0);
 
@@ -14,6 +14,42 @@ std::string Utils::ApplicationPattern::toString(void)
     return ss.str();
 };
 
+static bool g_commonRandomNumbers = false;
+
+void Utils::SetCommonRandomNumbers(bool enabled)
+{
+    g_commonRandomNumbers = enabled;
+}
+
+bool Utils::GetCommonRandomNumbers(void)
+{
+    return g_commonRandomNumbers;
+}
+
+int64_t Utils::CrnStream(RandomPurpose purpose, uint32_t index)
+{
+    // Above the small stream numbers helpers' AssignStreams usually start from
+    return (INT64_C(1) << 32) + (int64_t)index * RANDOM_PURPOSES + purpose;
+}
+
+// Creates a random variable of topologySetup, on its fixed stream in common random numbers mode
+template <typename T>
+static Ptr<T> createRandomVariable(Utils::RandomPurpose purpose, uint32_t index)
+{
+    Ptr<T> variable = CreateObject<T>();
+    if (Utils::GetCommonRandomNumbers())
+    {
+        variable->SetStream(Utils::CrnStream(purpose, index));
+    }
+    return variable;
+}
+
+// Picks an index below size
+static uint32_t pickIndex(size_t size, Utils::RandomPurpose purpose, uint32_t index)
+{
+    return createRandomVariable<UniformRandomVariable>(purpose, index)->GetInteger(0, size - 1);
+}
+
 std::pair<std::string, std::string> Utils::splitBufferLen(QueueSize bufferLen, double deviceFraction)
 {
     int totalLen = bufferLen.GetValue();
@@ -27,7 +63,8 @@ std::pair<std::string, std::string> Utils::splitBufferLen(QueueSize bufferLen, d
 
 void Utils::topologySetup(Topology* topo, std::string queueType, std::string routeTableFile, std::vector<ApplicationPattern> appPatterns, 
                             std::vector<uint64_t> sendingRates, double errorRate, double simTime, bool intEnabled, bool linkIntUtil, int byteCounterInterval,
-                            bool traceNetDevices, bool traceHosts, bool isByteSwitched, AllScoreTracker* scoreTracker, void (*socketFunc) (void))
+                            bool traceNetDevices, bool traceHosts, bool isByteSwitched, AllScoreTracker* scoreTracker, void (*socketFunc) (void),
+                            TopologyHandles* handles)
 {
     // Create nodes
     std::vector<TopologyNode*> allNodes = topo->getAllNodes();
@@ -71,6 +108,7 @@ void Utils::topologySetup(Topology* topo, std::string queueType, std::string rou
         pointToPoint.SetDeviceAttribute("IntEnabled", BooleanValue(intEnabled));
         pointToPoint.SetDeviceAttribute("LinkMetricUtil", BooleanValue(linkIntUtil));
         pointToPoint.SetDeviceAttribute("ByteCounterInterval", TimeValue(MicroSeconds(byteCounterInterval)));
+        pointToPoint.SetDeviceAttribute("Ideal", BooleanValue(link.ideal));
 
         linkDevices = pointToPoint.Install (nodes.Get(link.node1->id), nodes.Get(link.node2->id));
 
@@ -81,7 +119,15 @@ void Utils::topologySetup(Topology* topo, std::string queueType, std::string rou
         Ptr<RateErrorModel> errorModel = CreateObject<RateErrorModel>();
         errorModel->SetUnit (ns3::RateErrorModel::ERROR_UNIT_PACKET);
         errorModel->SetRate (errorRate);
+        if (GetCommonRandomNumbers())
+        {
+            errorModel->AssignStreams (CrnStream(RANDOM_LINK_ERROR, i));
+        }
         linkDevices.Get(1)->SetAttribute ("ReceiveErrorModel", PointerValue(errorModel));
+        if (handles != NULL)
+        {
+            handles->links.push_back({linkDevices, errorModel});
+        }
         
         int node1Interface = linkDevices.Get(0)->GetIfIndex();
         int node2Interface = linkDevices.Get(1)->GetIfIndex();
@@ -124,6 +170,7 @@ void Utils::topologySetup(Topology* topo, std::string queueType, std::string rou
 
     // Create application flows
     double startTime = 1.0;
+    uint32_t flow = 0;
     std::vector<std::vector<int>> matrix = topo->getTrafficMatrix();
     for (int i = 0; i < (int) matrix.size(); i++)
     {
@@ -149,12 +196,12 @@ void Utils::topologySetup(Topology* topo, std::string queueType, std::string rou
         applicationHelper.SetAttribute("MaxBytes", UintegerValue(0));
         // applicationHelper.SetAttribute("PacketSize", UintegerValue(1000));
 
-        uint64_t rate = sendingRates.at(rand() % sendingRates.size());
+        uint64_t rate = sendingRates.at(pickIndex(sendingRates.size(), RANDOM_SENDING_RATE, flow));
         DataRate dataRate = DataRate(rate);
         applicationHelper.SetAttribute("DataRate", DataRateValue(dataRate));
 
-        Ptr<ExponentialRandomVariable> onDist = CreateObject<ExponentialRandomVariable>();
-        Utils::ApplicationPattern appPattern = appPatterns.at(rand() % appPatterns.size());
+        Ptr<ExponentialRandomVariable> onDist = createRandomVariable<ExponentialRandomVariable>(RANDOM_ON_TIME, flow);
+        Utils::ApplicationPattern appPattern = appPatterns.at(pickIndex(appPatterns.size(), RANDOM_APP_PATTERN, flow));
         if (!isByteSwitched) {
             onDist->SetAttribute("Mean", DoubleValue( appPattern.onMean ));
             onDist->SetAttribute("Bound", DoubleValue(appPattern.onBound));
@@ -163,15 +210,16 @@ void Utils::topologySetup(Topology* topo, std::string queueType, std::string rou
             onDist->SetAttribute("Mean", DoubleValue(100000) ); //((appPattern.onMean * 512 * 8) / rate) * 1000 )
             onDist->SetAttribute("Bound", DoubleValue(0));
         }
-        Ptr<ExponentialRandomVariable> offDist = CreateObject<ExponentialRandomVariable>();
+        Ptr<ExponentialRandomVariable> offDist = createRandomVariable<ExponentialRandomVariable>(RANDOM_OFF_TIME, flow);
         offDist->SetAttribute("Mean", DoubleValue( appPattern.offMean));
         offDist->SetAttribute("Bound", DoubleValue(appPattern.offBound));
         applicationHelper.SetAttribute("OnTime", PointerValue(onDist));
         applicationHelper.SetAttribute("OffTime", PointerValue(offDist));
 
+        Ptr<ExponentialRandomVariable> bytesDist;
         if (isByteSwitched) {
             applicationHelper.SetAttribute("MaxBytes", UintegerValue(appPattern.onMean * 512));
-            Ptr<ExponentialRandomVariable> bytesDist = CreateObject<ExponentialRandomVariable>();
+            bytesDist = createRandomVariable<ExponentialRandomVariable>(RANDOM_MAX_BYTES, flow);
             bytesDist->SetAttribute("Mean", DoubleValue( appPattern.onMean * 512));
             applicationHelper.SetAttribute("MaxBytesDistribution", PointerValue(bytesDist));
         }
@@ -180,6 +228,10 @@ void Utils::topologySetup(Topology* topo, std::string queueType, std::string rou
         applicationHelper.SetAttribute("FlowId", UintegerValue(Utils::GenerateFlowId(node->GetId(), remoteNode->GetId())));
 
         ApplicationContainer serverApps = applicationHelper.Install (node);
+        if (handles != NULL)
+        {
+            handles->flows.push_back({serverApps.Get(0), onDist, offDist, bytesDist});
+        }
         serverApps.Start (MilliSeconds (startTime));
         serverApps.Stop (MilliSeconds (simTime));
 
@@ -196,15 +248,17 @@ void Utils::topologySetup(Topology* topo, std::string queueType, std::string rou
         }
         if (scoreTracker != NULL  && !(hosts.at(i)->isUntracedHost))
         {
-            scoreTracker->setupAppScoreTrace(serverApps, node->GetId(), remoteNode->GetId());
-            Simulator::Schedule(NanoSeconds(startTime * 1000000 + 10), &Utils::AllScoreTracker::setupScoreTrace, scoreTracker, serverApps, node->GetId(), remoteNode->GetId());
+            uint32_t slot = scoreTracker->setupAppScoreTrace(serverApps, node->GetId());
+            Simulator::Schedule(NanoSeconds(startTime * 1000000 + 10), &Utils::AllScoreTracker::setupScoreTrace, scoreTracker, serverApps, slot);
         }
+        flow++;
         }
     }
 
+    // Runs before any socket exists, so it can set up the socket templates of TcpL4Protocol
     if (socketFunc != NULL)
     {
-        Simulator::Schedule(NanoSeconds(startTime * 1000000 + 20), socketFunc);
+        socketFunc();
     }
 
     // Install routing tables
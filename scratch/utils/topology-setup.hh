@@ -32,13 +32,60 @@ class ApplicationPattern
   std::string toString(void);
 };
 
+// Objects created by topologySetup whose parameters change between runs of the same network
+struct TopologyHandles
+{
+    struct LinkHandles
+    {
+        NetDeviceContainer devices;
+        Ptr<RateErrorModel> errorModel;
+    };
+    struct FlowHandles
+    {
+        Ptr<Application> sender;
+        Ptr<ExponentialRandomVariable> onTime;
+        Ptr<ExponentialRandomVariable> offTime;
+        Ptr<ExponentialRandomVariable> maxBytes; // NULL unless byte switched
+    };
+
+    std::vector<LinkHandles> links; // in the order of Topology::links
+    std::vector<FlowHandles> flows; // in the order the flows were created
+};
+
+// What a random variable created by topologySetup is drawn for
+enum RandomPurpose
+{
+    RANDOM_SENDING_RATE = 0, // pick among sendingRates
+    RANDOM_APP_PATTERN,      // pick among appPatterns
+    RANDOM_ON_TIME,
+    RANDOM_OFF_TIME,
+    RANDOM_MAX_BYTES,
+    RANDOM_LINK_ERROR,
+    RANDOM_PURPOSES
+};
+
+/*
+ * Common random numbers mode, for paired comparisons of CCAs.
+ *
+ * When enabled, every random variable topologySetup creates draws from the fixed stream
+ * CrnStream(purpose, index), where index is the flow (in creation order) or, for link errors,
+ * the link. The substream is the run number (RngSeedManager::SetRun), which ParallelRunner
+ * derives from the job, so a flow's on/off times, losses and picks are the same in every
+ * simulation of the same seed and job, whatever the CCA and whatever else draws random numbers.
+ * Otherwise the variables take the next automatically assigned streams.
+ */
+void SetCommonRandomNumbers(bool enabled);
+bool GetCommonRandomNumbers(void);
+int64_t CrnStream(RandomPurpose purpose, uint32_t index);
+
 std::pair<std::string, std::string> splitBufferLen(QueueSize bufferLen, double deviceFraction = 0.9);
 
 void topologySetup(Topology* topo, std::string queueType, std::string routeTableFile, std::vector<ApplicationPattern> appPatterns, 
                     std::vector<uint64_t> sendingRates, double errorRate, double simTime = 10, bool intEnabled = false, bool linkIntUil = false, 
                     int byteCounterInterval = 10,
                     bool traceNetDevices = true, bool traceHosts = true, 
-                    bool isByteSwitched = false, AllScoreTracker* scoreTracker = NULL, void (*socketFunc) (void) = NULL );
+                    bool isByteSwitched = false, AllScoreTracker* scoreTracker = NULL, void (*socketFunc) (void) = NULL,
+                    TopologyHandles* handles = NULL );
 
 }
 
@@ -0,0 +1,254 @@
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+
+#include "trace-sink.hh"
+#include "tracing-utils.hh"
+
+using namespace ns3;
+
+const char Utils::BinaryTraceSink::MAGIC[8] = {'N', 'S', '3', 'T', 'R', 'C', '1', '\0'};
+
+static Utils::TraceSink* g_traceSink = NULL;
+
+void Utils::SetTraceSink(TraceSink* sink)
+{
+  g_traceSink = sink;
+}
+
+Utils::TraceSink* Utils::GetTraceSink(void)
+{
+  if (g_traceSink == NULL)
+  {
+    static TextTraceSink stdoutSink(std::cout);
+    g_traceSink = &stdoutSink;
+  }
+  return g_traceSink;
+}
+
+uint32_t Utils::TraceSink::intern(const std::string& context)
+{
+  contexts.push_back(context);
+  return contexts.size() - 1;
+}
+
+void Utils::TraceSink::formatEvent(std::ostream& os, double seconds, const std::string& context, TraceEvent event, double value)
+{
+  os << seconds << "," << context << ",";
+  switch (event)
+  {
+    case TRACE_BOOL:
+      os << (bool) value;
+      break;
+    case TRACE_UINT:
+    case TRACE_PACKET_SIZE:
+      os << (uint32_t) value;
+      break;
+    case TRACE_CONG_STATE:
+      os << "CS," << (uint32_t) value;
+      break;
+    case TRACE_DATA_RATE:
+      os << "RATE," << DataRate((uint64_t) value);
+      break;
+    case TRACE_RTT:
+      os << "RTT," << TimeStep((uint64_t) value);
+      break;
+    case TRACE_ACK:
+      os << "ACK," << (uint32_t) value;
+      break;
+    case TRACE_DROP:
+    {
+      FlowId flow = DeserializeFlowId((uint32_t) value);
+      os << "DROP," << flow.sourceId << "." << flow.destinationId;
+      break;
+    }
+  }
+  os << '\n';
+}
+
+Utils::TextTraceSink::TextTraceSink(std::ostream& os)
+  : os(os) {}
+
+void Utils::TextTraceSink::write(uint32_t context, TraceEvent event, double value)
+{
+  formatEvent(os, Simulator::Now ().GetSeconds(), contexts[context], event, value);
+}
+
+void Utils::TextTraceSink::flush(void)
+{
+  os.flush();
+}
+
+Utils::BinaryTraceSink::BinaryTraceSink(const std::string& filename)
+  : fileBuffer(1 << 22)
+{
+  file = fopen(filename.c_str(), "wb");
+  if (file == NULL)
+  {
+    NS_FATAL_ERROR("Could not open trace file " << filename << ": " << strerror(errno));
+  }
+  setvbuf(file, fileBuffer.data(), _IOFBF, fileBuffer.size());
+  fwrite(MAGIC, 1, sizeof(MAGIC), file);
+
+  times.reserve(BLOCK_RECORDS);
+  contextIds.reserve(BLOCK_RECORDS);
+  events.reserve(BLOCK_RECORDS);
+  values.reserve(BLOCK_RECORDS);
+}
+
+Utils::BinaryTraceSink::~BinaryTraceSink()
+{
+  close();
+}
+
+uint32_t Utils::BinaryTraceSink::intern(const std::string& context)
+{
+  // Definitions must precede the records that use them
+  writeBlock();
+  uint32_t id = TraceSink::intern(context);
+  uint32_t length = context.size();
+  fputc('C', file);
+  fwrite(&id, sizeof(id), 1, file);
+  fwrite(&length, sizeof(length), 1, file);
+  fwrite(context.data(), 1, length, file);
+  return id;
+}
+
+void Utils::BinaryTraceSink::write(uint32_t context, TraceEvent event, double value)
+{
+  times.push_back(Simulator::Now ().GetNanoSeconds());
+  contextIds.push_back(context);
+  events.push_back(event);
+  values.push_back(value);
+  if (times.size() == BLOCK_RECORDS)
+  {
+    writeBlock();
+  }
+}
+
+void Utils::BinaryTraceSink::writeBlock(void)
+{
+  uint32_t count = times.size();
+  if (count == 0 || file == NULL)
+  {
+    return;
+  }
+  fputc('R', file);
+  fwrite(&count, sizeof(count), 1, file);
+  fwrite(times.data(), sizeof(int64_t), count, file);
+  fwrite(contextIds.data(), sizeof(uint32_t), count, file);
+  fwrite(events.data(), sizeof(uint8_t), count, file);
+  fwrite(values.data(), sizeof(double), count, file);
+  times.clear();
+  contextIds.clear();
+  events.clear();
+  values.clear();
+}
+
+void Utils::BinaryTraceSink::flush(void)
+{
+  writeBlock();
+  if (file != NULL)
+  {
+    fflush(file);
+  }
+}
+
+void Utils::BinaryTraceSink::close(void)
+{
+  if (file == NULL)
+  {
+    return;
+  }
+  writeBlock();
+  fclose(file);
+  file = NULL;
+}
+
+Utils::BinaryTraceReader::BinaryTraceReader(const std::string& filename)
+  : position(0)
+{
+  file = fopen(filename.c_str(), "rb");
+  char magic[sizeof(BinaryTraceSink::MAGIC)];
+  if (file != NULL && (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+                       memcmp(magic, BinaryTraceSink::MAGIC, sizeof(magic)) != 0))
+  {
+    fclose(file);
+    file = NULL;
+  }
+}
+
+Utils::BinaryTraceReader::~BinaryTraceReader()
+{
+  if (file != NULL)
+  {
+    fclose(file);
+  }
+}
+
+bool Utils::BinaryTraceReader::readBlock(void)
+{
+  int tag;
+  while ((tag = fgetc(file)) == 'C')
+  {
+    uint32_t id, length;
+    if (fread(&id, sizeof(id), 1, file) != 1 || fread(&length, sizeof(length), 1, file) != 1)
+    {
+      return false;
+    }
+    std::string context(length, '\0');
+    if (fread(&context[0], 1, length, file) != length)
+    {
+      return false;
+    }
+    if (contexts.size() <= id)
+    {
+      contexts.resize(id + 1);
+    }
+    contexts[id] = context;
+  }
+  if (tag != 'R')
+  {
+    return false;
+  }
+
+  uint32_t count;
+  if (fread(&count, sizeof(count), 1, file) != 1)
+  {
+    return false;
+  }
+  times.resize(count);
+  contextIds.resize(count);
+  events.resize(count);
+  values.resize(count);
+  position = 0;
+  return fread(times.data(), sizeof(int64_t), count, file) == count &&
+         fread(contextIds.data(), sizeof(uint32_t), count, file) == count &&
+         fread(events.data(), sizeof(uint8_t), count, file) == count &&
+         fread(values.data(), sizeof(double), count, file) == count;
+}
+
+bool Utils::BinaryTraceReader::next(TraceRecord& record)
+{
+  if (file == NULL)
+  {
+    return false;
+  }
+  while (position >= times.size())
+  {
+    if (!readBlock())
+    {
+      return false;
+    }
+  }
+  record.ns = times[position];
+  record.context = contextIds[position];
+  record.event = (TraceEvent) events[position];
+  record.value = values[position];
+  position++;
+  return true;
+}
@@ -0,0 +1,130 @@
+#ifndef TRACE_SINK_H
+#define TRACE_SINK_H
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace Utils
+{
+
+enum TraceEvent : uint8_t
+{
+    TRACE_BOOL,
+    TRACE_UINT,
+    TRACE_CONG_STATE,
+    TRACE_DATA_RATE,
+    TRACE_RTT,
+    TRACE_ACK,
+    TRACE_PACKET_SIZE,
+    TRACE_DROP
+};
+
+// Destination of the Utils trace hooks. Contexts are interned once when a hook is connected,
+// so each event carries only a context ID, an event type and a value.
+class TraceSink
+{
+    public:
+        virtual ~TraceSink() {};
+
+        virtual uint32_t intern(const std::string& context);
+        virtual void write(uint32_t context, TraceEvent event, double value) = 0;
+        virtual void flush(void) {};
+
+        const std::string& getContext(uint32_t context) const { return contexts.at(context); }
+
+        // Writes one event in the CSV format of the original std::cout traces
+        static void formatEvent(std::ostream& os, double seconds, const std::string& context, TraceEvent event, double value);
+
+    protected:
+        std::vector<std::string> contexts;
+};
+
+// Writes the CSV trace to a stream without flushing per event
+class TextTraceSink: public TraceSink
+{
+    public:
+        TextTraceSink(std::ostream& os);
+
+        void write(uint32_t context, TraceEvent event, double value);
+        void flush(void);
+
+    private:
+        std::ostream& os;
+};
+
+/*
+ * Writes a block-columnar binary trace:
+ *   file    := MAGIC block*
+ *   block   := 'C' u32 id, u32 length, char[length]                      (context definition)
+ *            | 'R' u32 count, i64 ns[count], u32 context[count], u8 event[count], f64 value[count]
+ * All fields are written in host byte order (little-endian on x86 and most ARM hosts), so a trace
+ * is only portable to hosts of the same endianness. Every value is stored as an f64, whatever
+ * its event type: integer values (rates in bit/s, RTTs in time steps, sizes, flow IDs) are exact
+ * up to 2^53 and lose precision above it. Records are buffered and written one block at a time.
+ */
+class BinaryTraceSink: public TraceSink
+{
+    public:
+        static const uint32_t BLOCK_RECORDS = 65536;
+        static const char MAGIC[8];
+
+        BinaryTraceSink(const std::string& filename);
+        ~BinaryTraceSink();
+
+        uint32_t intern(const std::string& context);
+        void write(uint32_t context, TraceEvent event, double value);
+        void flush(void);
+        void close(void);
+
+    private:
+        FILE* file;
+        std::vector<char> fileBuffer;
+        std::vector<int64_t> times;
+        std::vector<uint32_t> contextIds;
+        std::vector<uint8_t> events;
+        std::vector<double> values;
+
+        void writeBlock(void);
+};
+
+struct TraceRecord
+{
+    int64_t ns;
+    uint32_t context;
+    TraceEvent event;
+    double value;
+};
+
+// Reads a file written by BinaryTraceSink one record at a time
+class BinaryTraceReader
+{
+    public:
+        BinaryTraceReader(const std::string& filename);
+        ~BinaryTraceReader();
+
+        bool isOpen(void) const { return file != NULL; }
+        bool next(TraceRecord& record);
+        const std::string& getContext(uint32_t context) const { return contexts.at(context); }
+
+    private:
+        FILE* file;
+        std::vector<std::string> contexts;
+        std::vector<int64_t> times;
+        std::vector<uint32_t> contextIds;
+        std::vector<uint8_t> events;
+        std::vector<double> values;
+        uint32_t position;
+
+        bool readBlock(void);
+};
+
+// Sink used by the trace hooks in tracing-utils (defaults to CSV on std::cout)
+void SetTraceSink(TraceSink* sink);
+TraceSink* GetTraceSink(void);
+
+}
+
+#endif /* TRACE_SINK_H */
@@ -59,62 +59,113 @@ void Utils::PacketDropTrace (std::string context, Ptr<QueueDiscItem const> item)
   std::cout << Simulator::Now ().GetSeconds() << "," << context << ",DROP," << flow.sourceId << "." << flow.destinationId << std::endl;
 }
 
+// Sink-backed trace callbacks: the context is interned when the hook is connected and bound by ID
+static void SinkBoolTrace (Utils::TraceSink* sink, uint32_t context, bool oldValue, bool newValue)
+{
+  sink->write(context, Utils::TRACE_BOOL, newValue);
+}
+
+static void SinkUintTrace (Utils::TraceSink* sink, uint32_t context, uint32_t oldValue, uint32_t newValue)
+{
+  sink->write(context, Utils::TRACE_UINT, newValue);
+}
+
+static void SinkCongStateTrace (Utils::TraceSink* sink, uint32_t context, TcpSocketState::TcpCongState_t oldValue, TcpSocketState::TcpCongState_t newValue)
+{
+  sink->write(context, Utils::TRACE_CONG_STATE, newValue);
+}
+
+static void SinkDataRateTrace (Utils::TraceSink* sink, uint32_t context, DataRate oldValue, DataRate newValue)
+{
+  sink->write(context, Utils::TRACE_DATA_RATE, newValue.GetBitRate());
+}
+
+static void SinkTimeTrace (Utils::TraceSink* sink, uint32_t context, ns3::Time oldValue, ns3::Time newValue)
+{
+  sink->write(context, Utils::TRACE_RTT, newValue.GetTimeStep());
+}
+
+static void SinkAckTrace (Utils::TraceSink* sink, uint32_t context, ns3::SequenceNumber32 oldValue, ns3::SequenceNumber32 newValue)
+{
+  sink->write(context, Utils::TRACE_ACK, newValue.GetValue());
+}
+
+static void SinkPacketSizeTrace (Utils::TraceSink* sink, uint32_t context, Ptr<Packet const> pkt)
+{
+  sink->write(context, Utils::TRACE_PACKET_SIZE, pkt->GetSize());
+}
+
+static void SinkPacketDropTrace (Utils::TraceSink* sink, uint32_t context, Ptr<QueueDiscItem const> item)
+{
+  FlowIdTag flowId;
+  item->GetPacket()->PeekPacketTag(flowId);
+  sink->write(context, Utils::TRACE_DROP, flowId.GetFlowId());
+}
+
 void Utils::TcpTracing (ApplicationContainer serverApps, int nodeId, int socketId) // Note: this is not actually the socket ID
 {
+  TraceSink* sink = GetTraceSink();
   std::ostringstream oss;
   Ptr<Socket> socket = StaticCast<OnOffApplication>(serverApps.Get(0))->GetSocket();
   oss << "N/" << nodeId << "/S/" << socketId; //socket->GetBoundNetDevice()->GetIfIndex();
-  StaticCast<TcpSocket>(socket)->TraceConnect("CongState", oss.str(), MakeCallback(&Utils::CongStateTrace));
-  StaticCast<TcpSocket>(socket)->TraceConnect("RTT", oss.str(), MakeCallback(&Utils::TimeTrace));
-  StaticCast<TcpSocket>(socket)->TraceConnect("HighestRxAck", oss.str(), MakeCallback(&Utils::AckTrace));
-  StaticCast<TcpSocket>(socket)->TraceConnect("PacingRate", oss.str(), MakeCallback(&Utils::DataRateTrace));
+  uint32_t context = sink->intern(oss.str());
+  StaticCast<TcpSocket>(socket)->TraceConnectWithoutContext("CongState", MakeBoundCallback(&SinkCongStateTrace, sink, context));
+  StaticCast<TcpSocket>(socket)->TraceConnectWithoutContext("RTT", MakeBoundCallback(&SinkTimeTrace, sink, context));
+  StaticCast<TcpSocket>(socket)->TraceConnectWithoutContext("HighestRxAck", MakeBoundCallback(&SinkAckTrace, sink, context));
+  StaticCast<TcpSocket>(socket)->TraceConnectWithoutContext("PacingRate", MakeBoundCallback(&SinkDataRateTrace, sink, context));
   oss << ",CWND";
-  StaticCast<TcpSocket>(socket)->TraceConnect("CongestionWindow", oss.str(), MakeCallback(&Utils::UintTrace));
+  StaticCast<TcpSocket>(socket)->TraceConnectWithoutContext("CongestionWindow", MakeBoundCallback(&SinkUintTrace, sink, sink->intern(oss.str())));
 }
 
 void Utils::ApplicationTrace(Ptr<Node> node, int appIndex)
 {
+  TraceSink* sink = GetTraceSink();
   std::ostringstream oss1;
   oss1 << "N/" << node->GetId () << "/A/" << appIndex << "/" << "$OnOff,TX";
   Ptr<Application> app = node->GetApplication(appIndex);
-  app->TraceConnect("Tx", oss1.str(), MakeCallback(&Utils::PacketSizeTrace));
+  app->TraceConnectWithoutContext("Tx", MakeBoundCallback(&SinkPacketSizeTrace, sink, sink->intern(oss1.str())));
 }
 
 
 void Utils::ApplicationOnOffTrace(ApplicationContainer serverApps, int nodeId, int remoteId)
 {
+  TraceSink* sink = GetTraceSink();
   std::ostringstream oss1;
   oss1 << "N/" << nodeId << "/S/" << remoteId << "/A" << ",On";
   Ptr<Application> app = serverApps.Get(0);
-  StaticCast<OnOffApplication>(app)->TraceConnect("OnOff", oss1.str(), MakeCallback(&Utils::BoolTrace));
+  StaticCast<OnOffApplication>(app)->TraceConnectWithoutContext("OnOff", MakeBoundCallback(&SinkBoolTrace, sink, sink->intern(oss1.str())));
 }
 
 void Utils::setupBwTrace(Ptr<Node> node, NetDeviceContainer linkDevices, int deviceIndex, std::string source)
 {
+  TraceSink* sink = GetTraceSink();
+
   // Utilization tracing
   std::ostringstream oss1;
   oss1 << "N/" << node->GetId () << "/D/" << linkDevices.Get(deviceIndex)->GetIfIndex() << "/" << "ND" << "/" << source;
   Ptr<PointToPointNetDevice> netDevice = StaticCast<PointToPointNetDevice> (linkDevices.Get (deviceIndex));
   Ptr<DropTailQueue<Packet>> queue = StaticCast<DropTailQueue<Packet>> (netDevice->GetQueue());
-  netDevice->TraceConnect(source, oss1.str(), MakeCallback(&Utils::PacketSizeTrace));
+  netDevice->TraceConnectWithoutContext(source, MakeBoundCallback(&SinkPacketSizeTrace, sink, sink->intern(oss1.str())));
   std::ostringstream oss2;
   oss2 << "N/" << node->GetId () << "/D/" << linkDevices.Get(deviceIndex)->GetIfIndex() << "/" << "ND" << "/Q/" << "ENQ";
-  queue->TraceConnect("Enqueue", oss2.str(), MakeCallback(&Utils::PacketSizeTrace));
+  queue->TraceConnectWithoutContext("Enqueue", MakeBoundCallback(&SinkPacketSizeTrace, sink, sink->intern(oss2.str())));
 }
 
 void Utils::setupNodeTrace(Ptr<Node> node, NetDeviceContainer linkDevices, int deviceIndex, Link link, Ptr<QueueDisc> queueDisc)
 {
+  TraceSink* sink = GetTraceSink();
+
   // Queue length tracing
   std::ostringstream oss;
   oss << "N/" << node->GetId () << "/D/" << linkDevices.Get(deviceIndex)->GetIfIndex() << ",TXQ";
   Ptr<Queue<Packet> > queue = StaticCast<PointToPointNetDevice> (linkDevices.Get (deviceIndex))->GetQueue ();
-  queue->TraceConnect ("PacketsInQueue", oss.str(), MakeCallback(&Utils::UintTrace));
+  queue->TraceConnectWithoutContext ("PacketsInQueue", MakeBoundCallback(&SinkUintTrace, sink, sink->intern(oss.str())));
 
   // Utilization tracing
   std::ostringstream oss2;
   oss2 << "N/" << node->GetId () << "/D/" << linkDevices.Get(deviceIndex)->GetIfIndex() << ",MRX";
   Ptr<PointToPointNetDevice> netDevice = StaticCast<PointToPointNetDevice> (linkDevices.Get (deviceIndex));
-  netDevice->TraceConnect("MacRx", oss2.str(), MakeCallback(&Utils::PacketSizeTrace));
+  netDevice->TraceConnectWithoutContext("MacRx", MakeBoundCallback(&SinkPacketSizeTrace, sink, sink->intern(oss2.str())));
   oss2 << ": rate:" << link.linkRate << "; qlen:" << link.bufferLen << std::endl;
   printf(oss2.str().c_str());
 
@@ -122,7 +173,7 @@ void Utils::setupNodeTrace(Ptr<Node> node, NetDeviceContainer linkDevices, int d
   // Queue drop tracing
   std::ostringstream oss1;
   oss1 << "N/" << node->GetId () << "/D/" << linkDevices.Get(deviceIndex)->GetIfIndex();
-  queueDisc->TraceConnect ("Drop", oss1.str(), MakeCallback(&Utils::PacketDropTrace));
+  queueDisc->TraceConnectWithoutContext ("Drop", MakeBoundCallback(&SinkPacketDropTrace, sink, sink->intern(oss1.str())));
 }
 
 
@@ -135,6 +186,10 @@ Utils::FlowScoreTracker::FlowScoreTracker(int name)
   worst_delay = 0;
   total_packets = 0;
   is_on = false;
+  share_snapshot = 0;
+  time_snapshot = 0;
+  initial_seq = 0;
+  ack_diff = 0;
   id = name;
 }
 
@@ -144,8 +199,11 @@ Utils::FlowScoreTracker::FlowScoreTracker()
   total_bytes = 0;
   total_share = 0;
   total_time = 0;
+  worst_delay = 0;
   total_packets = 0;
   is_on = false;
+  share_snapshot = 0;
+  time_snapshot = 0;
   initial_seq = 0;
   ack_diff = 0;
   id = 0;
@@ -205,6 +263,8 @@ Utils::AllScoreTracker::AllScoreTracker(uint64_t btlbw, int flows)
   bandwidth = btlbw;
   flowTrackers.reserve(flows);
   total_flows = flows;
+  share_accumulator = 0;
+  time_accumulator = 0;
 }
 
 double Utils::AllScoreTracker::calculateFairness(std::vector<double> throughputs)
@@ -222,56 +282,43 @@ double Utils::AllScoreTracker::score(double endTime, bool remyShare, int delayCo
   updateShareFinal(endTime);
   double total_score = 0;
   std::vector<double> throughputs = std::vector<double>();
-  for (auto it = flowTrackers.begin(); it != flowTrackers.end(); ++it)
+  for (FlowScoreTracker& flow : flowTrackers)
   {
     if (remyShare)
     {
-      it->second.total_share = (it->second.total_share / bandwidth) * 1000000.0; //remove bandwidth normalization and convert to us 
+      flow.total_share = (flow.total_share / bandwidth) * 1000000.0; //remove bandwidth normalization and convert to us 
     }
-    std::cout << "Flow: " << it->second.id << std::endl;
-    total_score += it->second.score(remyShare, delayCoef, tputCoef);
-    throughputs.push_back(it->second.getShareRatio());
+    std::cout << "Flow: " << flow.id << std::endl;
+    total_score += flow.score(remyShare, delayCoef, tputCoef);
+    throughputs.push_back(flow.getShareRatio());
   }
   std::cout << "Fairness: " << calculateFairness(throughputs) << std::endl;
   return total_score / total_flows;
 }
 
-void Utils::AllScoreTracker::updateBytes(std::string context, ns3::SequenceNumber32 oldValue, ns3::SequenceNumber32 newValue) // TODO: Deprecate this since change packet size anyway
+void Utils::AllScoreTracker::updateBytes(uint32_t slot, ns3::SequenceNumber32 oldValue, ns3::SequenceNumber32 newValue) // TODO: Deprecate this since change packet size anyway
 {
-  double flowId = std::stod(context);
-  if (flowTrackers.count(flowId) > 0)
+  FlowScoreTracker& flow = flowTrackers[slot];
+  if (flow.initial_seq == 0)
   {
-    auto it = flowTrackers.find(flowId);  
-    uint64_t bytes = it->second.total_bytes;
-    if (it->second.initial_seq == 0)
-    {
-      it->second.initial_seq = newValue.GetValue();
-    }
-    uint64_t new_bytes = newValue - oldValue;
-    it->second.total_bytes = bytes + new_bytes; 
-    it->second.ack_diff = newValue.GetValue() - it->second.initial_seq;
+    flow.initial_seq = newValue.GetValue();
   }
+  flow.total_bytes += newValue - oldValue;
+  flow.ack_diff = newValue.GetValue() - flow.initial_seq;
 } 
 
-void Utils::AllScoreTracker::updatePacketsAndDelay(std::string context, const Ptr<const Packet> packet, const TcpHeader& header,
+void Utils::AllScoreTracker::updatePacketsAndDelay(uint32_t slot, const Ptr<const Packet> packet, const TcpHeader& header,
                                             const Ptr<const TcpSocketBase> socket)
 {
-  double flowId = std::stod(context);
-  if (flowTrackers.count(flowId) > 0)
-  {
-    auto it = flowTrackers.find(flowId);
-
-    // Update packet count
-    uint64_t packets = it->second.total_packets;
-    it->second.total_packets = packets + 1;
-
-    // Update delay total (need an estimate for every packet, not just when it changes)
-    double delay = it->second.total_delay;
-    double new_delay = socket->GetSocketState()->m_lastTimestampRtt.GetMicroSeconds();
-    
-    it->second.total_delay = delay + new_delay;
-    it->second.worst_delay = std::max(it->second.worst_delay, new_delay);
-  }
+  FlowScoreTracker& flow = flowTrackers[slot];
+
+  // Update packet count
+  flow.total_packets += 1;
+
+  // Update delay total (need an estimate for every packet, not just when it changes)
+  double new_delay = socket->GetSocketState()->m_lastTimestampRtt.GetMicroSeconds();
+  flow.total_delay += new_delay;
+  flow.worst_delay = std::max(flow.worst_delay, new_delay);
 }
 
 void Utils::AllScoreTracker::trackTX(std::string context, const Ptr<const Packet> packet, const TcpHeader& header,
@@ -282,29 +329,34 @@ void Utils::AllScoreTracker::trackTX(std::string context, const Ptr<const Packet
   std::cout << context << ": " << Simulator::Now().GetSeconds() << ": Packet Sent with UID: " << header.GetSequenceNumber() << " and TS value: " << ts->GetEcho() << std::endl;
 }
 
-void Utils::AllScoreTracker::updateShare(std::string context, bool oldValue, bool newValue)
+// Every flow that is on earns the same share, so accumulate it once globally and let each
+// flow take the difference between its on and off snapshots
+void Utils::AllScoreTracker::advanceShare(double now)
 {
-  double flowId = std::stod(context);
-  
-  if (num_flows != 0 )
+  if (num_flows != 0)
   {
-    double share = ((double)bandwidth / num_flows) * (Simulator::Now ().GetSeconds() - last_flow_change);
-    for (auto it = flowTrackers.begin(); it != flowTrackers.end(); ++it)
-    {
-      if (it->second.is_on)
-      {
-        uint64_t current_share = it->second.total_share;
-        it->second.total_share = current_share + (uint64_t) share;
-        double current_time = it->second.total_time;
-        it->second.total_time = current_time + (double) (Simulator::Now ().GetSeconds() - last_flow_change);
-      }
-    }
+    share_accumulator += ((double)bandwidth / num_flows) * (now - last_flow_change);
+    time_accumulator += now - last_flow_change;
   }
+  last_flow_change = now;
+}
 
-  last_flow_change = Simulator::Now ().GetSeconds();
+void Utils::AllScoreTracker::updateShare(uint32_t slot, bool oldValue, bool newValue)
+{
+  advanceShare(Simulator::Now ().GetSeconds());
 
-  auto flow = flowTrackers.find(flowId);
-  flow->second.is_on = newValue;
+  FlowScoreTracker& flow = flowTrackers[slot];
+  if (newValue && !flow.is_on)
+  {
+    flow.share_snapshot = share_accumulator;
+    flow.time_snapshot = time_accumulator;
+  }
+  else if (!newValue && flow.is_on)
+  {
+    flow.total_share += share_accumulator - flow.share_snapshot;
+    flow.total_time += time_accumulator - flow.time_snapshot;
+  }
+  flow.is_on = newValue;
 
   if (newValue)
   {
@@ -318,38 +370,61 @@ void Utils::AllScoreTracker::updateShare(std::string context, bool oldValue, boo
 
 void Utils::AllScoreTracker::updateShareFinal(double endTime)
 {
-  if (num_flows != 0 )
+  advanceShare(endTime);
+  for (FlowScoreTracker& flow : flowTrackers)
   {
-    double share = ((double)bandwidth / num_flows) * (endTime - last_flow_change);
-    for (auto it = flowTrackers.begin(); it != flowTrackers.end(); ++it)
+    if (flow.is_on)
     {
-      if (it->second.is_on)
-      {
-        uint64_t current_share = it->second.total_share;
-        it->second.total_share = current_share + (uint64_t) share;
-      }
+      flow.total_share += share_accumulator - flow.share_snapshot;
+      flow.share_snapshot = share_accumulator;
     }
   }
 }
 
-void Utils::AllScoreTracker::setupAppScoreTrace(ApplicationContainer serverApps, int nodeId, int socketId)
+double Utils::AllScoreTracker::flowShare(uint32_t slot, double now) const
 {
-  std::ostringstream oss;
-  Ptr<Socket> socket = StaticCast<OnOffApplication>(serverApps.Get(0))->GetSocket();
-  oss << nodeId << "." << socketId; 
-  Ptr<Application> app = serverApps.Get(0);
-  StaticCast<OnOffApplication>(app)->TraceConnect("OnOff", oss.str(), MakeCallback(&Utils::AllScoreTracker::updateShare, this));
+  const FlowScoreTracker& flow = flowTrackers[slot];
+  if (!flow.is_on)
+  {
+    return flow.total_share;
+  }
+  double accumulator = share_accumulator;
+  if (num_flows != 0)
+  {
+    accumulator += ((double)bandwidth / num_flows) * (now - last_flow_change);
+  }
+  return flow.total_share + accumulator - flow.share_snapshot;
+}
 
-  double flowId = std::stod(oss.str());
-  flowTrackers[flowId] = FlowScoreTracker(nodeId);
+static void ScoreShareTrace(Utils::AllScoreTracker* scorer, uint32_t slot, bool oldValue, bool newValue)
+{
+  scorer->updateShare(slot, oldValue, newValue);
 }
 
-void Utils::AllScoreTracker::setupScoreTrace(AllScoreTracker* scorer, ApplicationContainer serverApps, int nodeId, int socketId)
+static void ScoreBytesTrace(Utils::AllScoreTracker* scorer, uint32_t slot, ns3::SequenceNumber32 oldValue, ns3::SequenceNumber32 newValue)
 {
-  std::ostringstream oss;
-  Ptr<Socket> socket = StaticCast<OnOffApplication>(serverApps.Get(0))->GetSocket();
-  oss << nodeId << "." << socketId;  
+  scorer->updateBytes(slot, oldValue, newValue);
+}
+
+static void ScoreRxTrace(Utils::AllScoreTracker* scorer, uint32_t slot, const Ptr<const Packet> packet, const TcpHeader& header,
+                         const Ptr<const TcpSocketBase> socket)
+{
+  scorer->updatePacketsAndDelay(slot, packet, header, socket);
+}
+
+uint32_t Utils::AllScoreTracker::setupAppScoreTrace(ApplicationContainer serverApps, int nodeId)
+{
+  uint32_t slot = flowTrackers.size();
+  flowTrackers.push_back(FlowScoreTracker(nodeId));
+
+  Ptr<Application> app = serverApps.Get(0);
+  StaticCast<OnOffApplication>(app)->TraceConnectWithoutContext("OnOff", MakeBoundCallback(&ScoreShareTrace, this, slot));
+  return slot;
+}
 
-  StaticCast<TcpSocket>(socket)->TraceConnect("HighestRxAck", oss.str(), MakeCallback(&Utils::AllScoreTracker::updateBytes, scorer));
-  StaticCast<TcpSocket>(socket)->TraceConnect("Rx", oss.str(), MakeCallback(&Utils::AllScoreTracker::updatePacketsAndDelay, scorer));
+void Utils::AllScoreTracker::setupScoreTrace(AllScoreTracker* scorer, ApplicationContainer serverApps, uint32_t slot)
+{
+  Ptr<Socket> socket = StaticCast<OnOffApplication>(serverApps.Get(0))->GetSocket();
+  StaticCast<TcpSocket>(socket)->TraceConnectWithoutContext("HighestRxAck", MakeBoundCallback(&ScoreBytesTrace, scorer, slot));
+  StaticCast<TcpSocket>(socket)->TraceConnectWithoutContext("Rx", MakeBoundCallback(&ScoreRxTrace, scorer, slot));
 }
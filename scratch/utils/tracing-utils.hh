@@ -16,6 +16,7 @@
 #include "ns3/tcp-option.h"
 
 #include "sim-topology.hh"
+#include "trace-sink.hh"
 
 using namespace ns3;
 
@@ -41,6 +42,8 @@ class FlowScoreTracker
         double total_time;
         uint64_t total_packets;
         bool is_on;
+        double share_snapshot; // AllScoreTracker::share_accumulator when the flow last turned on
+        double time_snapshot; // AllScoreTracker::time_accumulator when the flow last turned on
         uint64_t initial_seq;
         uint64_t ack_diff;
         int id;
@@ -54,31 +57,39 @@ class FlowScoreTracker
         std::string toString();
 };
 
+// Flows are scored in dense slots; each flow's trace callbacks are bound to its slot index
 class AllScoreTracker
 {
     public:
-        std::unordered_map<double, FlowScoreTracker> flowTrackers;
+        std::vector<FlowScoreTracker> flowTrackers;
         int num_flows;
         double last_flow_change;
         uint64_t bandwidth;
         int total_flows;
+        double share_accumulator; // share earned so far by a flow that has been on the whole time
+        double time_accumulator; // time so far during which at least one flow was on
 
         AllScoreTracker(uint64_t btlbw, int flows);
 
-        void updateBytes(std::string context, ns3::SequenceNumber32 oldValue, ns3::SequenceNumber32 newValue);
-        void updatePacketsAndDelay(std::string context, const Ptr<const Packet> packet, const TcpHeader& header,
+        void updateBytes(uint32_t slot, ns3::SequenceNumber32 oldValue, ns3::SequenceNumber32 newValue);
+        void updatePacketsAndDelay(uint32_t slot, const Ptr<const Packet> packet, const TcpHeader& header,
                            const Ptr<const TcpSocketBase> socket);
         void trackTX(std::string context, const Ptr<const Packet> packet, const TcpHeader& header,
                            const Ptr<const TcpSocketBase> socket);
-        void updateShare(std::string context, bool oldValue, bool newValue);
+        void updateShare(uint32_t slot, bool oldValue, bool newValue);
         void updateShareFinal(double endTime);
-        void setupAppScoreTrace(ApplicationContainer serverApps, int nodeId, int socketId);
+        // Share earned by the flow in slot up to now, including its current on period
+        double flowShare(uint32_t slot, double now) const;
+        uint32_t setupAppScoreTrace(ApplicationContainer serverApps, int nodeId);
 
         double calculateFairness(std::vector<double> throughputs);
 
         double score(double endTime, bool remyShare = false, int delayCoef = 1, int tputCoef = 1);
 
-        static void setupScoreTrace(AllScoreTracker* scorer, ApplicationContainer serverApps, int nodeId, int socketId);
+        static void setupScoreTrace(AllScoreTracker* scorer, ApplicationContainer serverApps, uint32_t slot);
+
+    private:
+        void advanceShare(double now);
 };
 
 void BoolTrace (std::string context, bool oldValue, bool newValue);
@@ -89,6 +100,7 @@ void TimeTrace (std::string context, ns3::Time oldValue, ns3::Time newValue);
 void AckTrace (std::string context, ns3::SequenceNumber32 oldValue, ns3::SequenceNumber32 newValue);
 void PacketSizeTrace (std::string context, Ptr<Packet const> pkt);
 void PacketDropTrace (std::string context, Ptr<QueueDiscItem const> item);
+// The hooks below write to GetTraceSink() (CSV on std::cout unless another sink is set)
 void TcpTracing (ApplicationContainer serverApps, int nodeId, int socketId); // Note: this is not actually the socket ID
 void ApplicationTrace(Ptr<Node> node, int appIndex);
 void ApplicationOnOffTrace(ApplicationContainer serverApps, int nodeId, int remoteId);
@@ -24,8 +24,11 @@
 #include "scheduler.h"
 #include "assert.h"
 #include "log.h"
+#include "double.h"
+#include "uinteger.h"
 
 #include <cmath>
+#include <vector>
 
 
 /**
@@ -50,6 +53,42 @@ DefaultSimulatorImpl::GetTypeId (void)
     .SetParent<SimulatorImpl> ()
     .SetGroupName ("Core")
     .AddConstructor<DefaultSimulatorImpl> ()
+    .AddAttribute ("PurgeRatio",
+                   "Ratio of cancelled to live events in the event queue "
+                   "above which the cancelled events are purged.",
+                   DoubleValue (1.0),
+                   MakeDoubleAccessor (&DefaultSimulatorImpl::m_purgeRatio),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("PurgeMinimum",
+                   "Number of cancelled events in the event queue "
+                   "below which the queue is never purged.",
+                   UintegerValue (4096),
+                   MakeUintegerAccessor (&DefaultSimulatorImpl::m_purgeMinimum),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("QueuedEvents",
+                   "Number of events in the event queue, cancelled ones included.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&DefaultSimulatorImpl::GetQueuedEvents),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("CancelledEvents",
+                   "Number of cancelled events in the event queue.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&DefaultSimulatorImpl::GetCancelledEvents),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("PurgedEvents",
+                   "Number of cancelled events dropped from the event queue by a purge.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&DefaultSimulatorImpl::GetPurgedEvents),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("Purges",
+                   "Number of purges of the event queue.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&DefaultSimulatorImpl::GetPurges),
+                   MakeUintegerChecker<uint64_t> ())
   ;
   return tid;
 }
@@ -63,6 +102,11 @@ DefaultSimulatorImpl::DefaultSimulatorImpl ()
   m_currentTs = 0;
   m_currentContext = Simulator::NO_CONTEXT;
   m_unscheduledEvents = 0;
+  m_cancelledEvents = 0;
+  m_purgedEvents = 0;
+  m_purges = 0;
+  m_purgeRatio = 1.0;
+  m_purgeMinimum = 4096;
   m_eventCount = 0;
   m_eventsWithContextEmpty = true;
   m_main = SystemThread::Self ();
@@ -138,6 +182,10 @@ DefaultSimulatorImpl::ProcessOneEvent (void)
   NS_ASSERT (next.key.m_ts >= m_currentTs);
   m_unscheduledEvents--;
   m_eventCount++;
+  if (next.impl->IsCancelled () && m_cancelledEvents > 0)
+    {
+      m_cancelledEvents--;
+    }
 
   NS_LOG_LOGIC ("handle " << next.key.m_ts);
   m_currentTs = next.key.m_ts;
@@ -351,7 +399,49 @@ DefaultSimulatorImpl::Cancel (const EventId &id)
   if (!IsExpired (id))
     {
       id.PeekEventImpl ()->Cancel ();
+      if (id.GetUid () != EventId::UID::DESTROY)
+        {
+          m_cancelledEvents++;
+          uint64_t live = GetQueuedEvents () - m_cancelledEvents;
+          if (m_cancelledEvents >= m_purgeMinimum
+              && m_cancelledEvents > m_purgeRatio * live)
+            {
+              PurgeCancelledEvents ();
+            }
+        }
+    }
+}
+
+void
+DefaultSimulatorImpl::PurgeCancelledEvents (void)
+{
+  NS_LOG_FUNCTION (this << m_unscheduledEvents << m_cancelledEvents);
+  // Draining in order and reinserting keeps every key, so the live
+  // events run in the same order as without the purge.
+  std::vector<Scheduler::Event> live;
+  live.reserve (m_unscheduledEvents - m_cancelledEvents);
+  uint64_t purged = 0;
+  while (!m_events->IsEmpty ())
+    {
+      Scheduler::Event next = m_events->RemoveNext ();
+      if (next.impl->IsCancelled ())
+        {
+          next.impl->Unref ();
+          purged++;
+        }
+      else
+        {
+          live.push_back (next);
+        }
     }
+  for (std::vector<Scheduler::Event>::const_iterator i = live.begin (); i != live.end (); i++)
+    {
+      m_events->Insert (*i);
+    }
+  m_unscheduledEvents -= purged;
+  m_cancelledEvents = 0;
+  m_purgedEvents += purged;
+  m_purges++;
 }
 
 bool
@@ -405,4 +495,28 @@ DefaultSimulatorImpl::GetEventCount (void) const
   return m_eventCount;
 }
 
+uint64_t
+DefaultSimulatorImpl::GetQueuedEvents (void) const
+{
+  return m_unscheduledEvents;
+}
+
+uint64_t
+DefaultSimulatorImpl::GetCancelledEvents (void) const
+{
+  return m_cancelledEvents;
+}
+
+uint64_t
+DefaultSimulatorImpl::GetPurgedEvents (void) const
+{
+  return m_purgedEvents;
+}
+
+uint64_t
+DefaultSimulatorImpl::GetPurges (void) const
+{
+  return m_purges;
+}
+
 } // namespace ns3
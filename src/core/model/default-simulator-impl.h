@@ -78,11 +78,51 @@ public:
   virtual uint32_t GetContext (void) const;
   virtual uint64_t GetEventCount (void) const;
 
+  /**
+   * Get the number of events in the event queue, including the
+   * cancelled events which have not been purged yet.
+   *
+   * \returns The number of queued events.
+   */
+  uint64_t GetQueuedEvents (void) const;
+  /**
+   * Get the number of cancelled events still in the event queue.
+   *
+   * \returns The number of cancelled events not purged yet.
+   */
+  uint64_t GetCancelledEvents (void) const;
+  /**
+   * Get the number of cancelled events removed from the event queue
+   * by a purge.
+   *
+   * \returns The number of purged events.
+   */
+  uint64_t GetPurgedEvents (void) const;
+  /**
+   * Get the number of purges of the event queue.
+   *
+   * \returns The number of purges.
+   */
+  uint64_t GetPurges (void) const;
+
 private:
   virtual void DoDispose (void);
 
   /** Process the next event. */
   void ProcessOneEvent (void);
+  /**
+   * Drop the cancelled events from the event queue.
+   *
+   * Cancelling an event only marks it, so cancelled events stay in
+   * the event queue until their time stamp is reached.  Workloads
+   * which rearm timers much more often than they expire, such as
+   * TCP retransmission timers, fill the queue with dead events which
+   * every insertion and removal then pays for.  Once the cancelled
+   * events outnumber the live ones by the \c PurgeRatio attribute,
+   * the queue is drained and the live events reinserted, which
+   * amortizes to a constant cost per cancelled event.
+   */
+  void PurgeCancelledEvents (void);
   /** Move events from a different context into the main event queue. */
   void ProcessEventsWithContext (void);
 
@@ -132,6 +172,16 @@ private:
    *  not counting the Destroy events; this is used for validation
    */
   int m_unscheduledEvents;
+  /** Number of cancelled events still in the event queue. */
+  uint64_t m_cancelledEvents;
+  /** Number of cancelled events dropped by PurgeCancelledEvents(). */
+  uint64_t m_purgedEvents;
+  /** Number of calls to PurgeCancelledEvents(). */
+  uint64_t m_purges;
+  /** Ratio of cancelled to live events above which the queue is purged. */
+  double m_purgeRatio;
+  /** Number of cancelled events below which the queue is never purged. */
+  uint32_t m_purgeMinimum;
 
   /** Main execution thread. */
   SystemThread::ThreadId m_main;
@@ -31,6 +31,44 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EventImpl");
 
+namespace {
+
+/**
+ * Get the pool events are allocated from.
+ *
+ * It is never destroyed, since events may be freed during the
+ * destruction of static objects.
+ *
+ * \returns The event pool.
+ */
+SizeClassPool &
+GetEventPool (void)
+{
+  static SizeClassPool *pool = new SizeClassPool ();
+  return *pool;
+}
+
+} // unnamed namespace
+
+void *
+EventImpl::operator new (std::size_t size)
+{
+  return GetEventPool ().Allocate (size);
+}
+
+void
+EventImpl::operator delete (void *p, std::size_t size)
+{
+  GetEventPool ().Deallocate (p, size);
+}
+
+EventImpl::PoolStats
+EventImpl::GetPoolStats (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  return GetEventPool ().GetStats ();
+}
+
 EventImpl::~EventImpl ()
 {
   NS_LOG_FUNCTION (this);
@@ -21,7 +21,9 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
 #include "simple-ref-count.h"
+#include "size-class-pool.h"
 
 /**
  * \file
@@ -40,10 +42,42 @@ namespace ns3 {
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * Events are allocated from a SizeClassPool: the memory of an event
+ * goes back to the free list of its size class when its last reference
+ * is dropped, so steady-state scheduling does not call malloc/free.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
 public:
+  /** Statistics of the event allocator, summed over all threads. */
+  typedef SizeClassPool::Stats PoolStats;
+
+  /**
+   * Get the statistics of the event allocator.
+   *
+   * The counters of other threads are read while they may be updated, so
+   * the result is only exact when no other thread schedules events.
+   *
+   * \returns The allocator statistics.
+   */
+  static PoolStats GetPoolStats (void);
+
+  /**
+   * Allocate an event from the free list of its size class.
+   *
+   * \param [in] size The size of the event object.
+   * \returns The memory for the event.
+   */
+  static void * operator new (std::size_t size);
+  /**
+   * Return the memory of an event to the free list of its size class.
+   *
+   * \param [in] p The memory of the event.
+   * \param [in] size The size of the event object.
+   */
+  static void operator delete (void *p, std::size_t size);
+
   /** Default constructor. */
   EventImpl ();
   /** Destructor. */
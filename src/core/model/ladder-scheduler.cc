@@ -0,0 +1,315 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ladder-scheduler.h"
+#include "event-impl.h"
+#include "uinteger.h"
+#include <algorithm>
+#include "assert.h"
+#include "log.h"
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (LadderScheduler);
+
+TypeId
+LadderScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LadderScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<LadderScheduler> ()
+    .AddAttribute ("BucketThreshold",
+                   "Number of events above which a bucket is spread on a finer rung "
+                   "instead of being sorted",
+                   UintegerValue (50),
+                   MakeUintegerAccessor (&LadderScheduler::m_threshold),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxRungs",
+                   "Maximum number of rungs of the ladder",
+                   UintegerValue (8),
+                   MakeUintegerAccessor (&LadderScheduler::m_maxRungs),
+                   MakeUintegerChecker<uint32_t> (1))
+  ;
+  return tid;
+}
+
+LadderScheduler::LadderScheduler ()
+  : m_topMin (0),
+    m_topMax (0),
+    m_topStart (0),
+    m_threshold (50),
+    m_maxRungs (8)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LadderScheduler::~LadderScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+LadderScheduler::AddRung (uint64_t start, uint64_t end, Bucket &events)
+{
+  NS_LOG_FUNCTION (this << start << end << events.size ());
+  NS_ASSERT (end > start);
+  uint64_t span = end - start;
+  uint64_t n = std::max<uint64_t> (std::min<uint64_t> (events.size (), span), 1);
+
+  Rung rung;
+  rung.start = start;
+  rung.width = (span + n - 1) / n;
+  rung.current = 0;
+  rung.count = events.size ();
+  rung.buckets.resize ((span + rung.width - 1) / rung.width);
+  for (Bucket::const_iterator i = events.begin (); i != events.end (); i++)
+    {
+      NS_ASSERT (i->key.m_ts >= start && i->key.m_ts < end);
+      rung.buckets[(i->key.m_ts - start) / rung.width].push_back (*i);
+    }
+  events.clear ();
+  NS_LOG_LOGIC ("rung " << m_rungs.size () << ": " << rung.buckets.size () <<
+                " buckets of width " << rung.width << " from " << start);
+  m_rungs.push_back (std::move (rung));
+}
+
+uint32_t
+LadderScheduler::FindRung (uint64_t ts) const
+{
+  // Each rung spans one bucket of the rung above it, so the first rung
+  // whose current bucket does not start later than ts holds it.
+  uint32_t i = 0;
+  for (; i < m_rungs.size (); i++)
+    {
+      if (ts >= m_rungs[i].CurrentStart ())
+        {
+          break;
+        }
+    }
+  return i;
+}
+
+void
+LadderScheduler::InsertBottom (const Scheduler::Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  // New events tend to be later than the ones already there
+  std::list<Scheduler::Event>::iterator i = m_bottom.end ();
+  while (i != m_bottom.begin ())
+    {
+      std::list<Scheduler::Event>::iterator prev = std::prev (i);
+      if (prev->key < ev.key)
+        {
+          break;
+        }
+      i = prev;
+    }
+  m_bottom.insert (i, ev);
+
+  if (m_bottom.size () > m_threshold && m_rungs.size () < m_maxRungs
+      && m_bottom.front ().key.m_ts != m_bottom.back ().key.m_ts)
+    {
+      // The bottom spans up to the current bucket of the lowest rung
+      uint64_t end = m_rungs.empty () ? m_topStart : m_rungs.back ().CurrentStart ();
+      Bucket events (m_bottom.begin (), m_bottom.end ());
+      m_bottom.clear ();
+      AddRung (events.front ().key.m_ts, end, events);
+    }
+}
+
+void
+LadderScheduler::Refill (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (m_bottom.empty ())
+    {
+      if (m_rungs.empty ())
+        {
+          if (m_top.empty ())
+            {
+              return;
+            }
+          m_topStart = m_topMax + 1;
+          AddRung (m_topMin, m_topStart, m_top);
+        }
+
+      Rung &rung = m_rungs.back ();
+      if (rung.count == 0)
+        {
+          m_rungs.pop_back ();
+          continue;
+        }
+      while (rung.buckets[rung.current].empty ())
+        {
+          rung.current++;
+        }
+      uint64_t bucketStart = rung.CurrentStart ();
+      uint64_t width = rung.width;
+      Bucket &bucket = rung.buckets[rung.current];
+      rung.current++;
+      rung.count -= bucket.size ();
+
+      if (bucket.size () > m_threshold && width > 1 && m_rungs.size () < m_maxRungs)
+        {
+          Bucket events;
+          events.swap (bucket);
+          AddRung (bucketStart, bucketStart + width, events);
+        }
+      else
+        {
+          std::sort (bucket.begin (), bucket.end (),
+                     [] (const Scheduler::Event &a, const Scheduler::Event &b) -> bool
+                     {
+                       return a.key < b.key;
+                     });
+          m_bottom.assign (bucket.begin (), bucket.end ());
+          bucket.clear ();
+        }
+    }
+}
+
+void
+LadderScheduler::Insert (const Scheduler::Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  uint64_t ts = ev.key.m_ts;
+  if (ts >= m_topStart)
+    {
+      if (m_top.empty ())
+        {
+          m_topMin = ts;
+          m_topMax = ts;
+        }
+      else
+        {
+          m_topMin = std::min (m_topMin, ts);
+          m_topMax = std::max (m_topMax, ts);
+        }
+      m_top.push_back (ev);
+    }
+  else
+    {
+      uint32_t r = FindRung (ts);
+      if (r < m_rungs.size ())
+        {
+          Rung &rung = m_rungs[r];
+          rung.buckets[(ts - rung.start) / rung.width].push_back (ev);
+          rung.count++;
+        }
+      else
+        {
+          InsertBottom (ev);
+        }
+    }
+  Refill ();
+}
+
+bool
+LadderScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_bottom.empty ();
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  return m_bottom.front ();
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  Scheduler::Event ev = m_bottom.front ();
+  m_bottom.pop_front ();
+  Refill ();
+  NS_LOG_LOGIC ("remove ts=" << ev.key.m_ts << ", key=" << ev.key.m_uid);
+  return ev;
+}
+
+void
+LadderScheduler::Remove (const Scheduler::Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  NS_ASSERT (!IsEmpty ());
+  uint64_t ts = ev.key.m_ts;
+  bool found = false;
+  if (ts >= m_topStart)
+    {
+      Bucket::iterator i = std::find_if (m_top.begin (), m_top.end (),
+                                         [&ev] (const Scheduler::Event &e) -> bool
+                                         {
+                                           return e.key == ev.key;
+                                         });
+      if (i != m_top.end ())
+        {
+          *i = m_top.back ();
+          m_top.pop_back ();
+          found = true;
+        }
+    }
+  else
+    {
+      uint32_t r = FindRung (ts);
+      if (r < m_rungs.size ())
+        {
+          Rung &rung = m_rungs[r];
+          Bucket &bucket = rung.buckets[(ts - rung.start) / rung.width];
+          Bucket::iterator i = std::find_if (bucket.begin (), bucket.end (),
+                                             [&ev] (const Scheduler::Event &e) -> bool
+                                             {
+                                               return e.key == ev.key;
+                                             });
+          if (i != bucket.end ())
+            {
+              *i = bucket.back ();
+              bucket.pop_back ();
+              rung.count--;
+              found = true;
+            }
+        }
+      else
+        {
+          for (std::list<Scheduler::Event>::iterator i = m_bottom.begin (); i != m_bottom.end (); i++)
+            {
+              if (i->key == ev.key)
+                {
+                  m_bottom.erase (i);
+                  found = true;
+                  break;
+                }
+            }
+        }
+    }
+  NS_ASSERT_MSG (found, "Event " << ev.key.m_uid << " not in the scheduler");
+  (void) found;
+  Refill ();
+}
+
+} // namespace ns3
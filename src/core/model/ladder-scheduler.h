@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <list>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class declaration.
+ */
+
+namespace ns3 {
+
+class EventImpl;
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the ladder queue of
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation" by Tang, Goh and Thng][Tang].
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103324 "Tang"
+ *
+ * Events live in one of three tiers:
+ *
+ * - *Top*: an unsorted vector of the events later than every event
+ *   already spread on the ladder.  Inserting there is a `push_back`.
+ * - *Ladder*: a stack of rungs, each an array of unsorted buckets of
+ *   uniform width.  Each rung covers the time span of a single bucket
+ *   of the rung above it, so the bucket width adapts to the local
+ *   density of events: a bucket holding more than `BucketThreshold`
+ *   events when it is reached is spread on a new, finer rung instead
+ *   of being sorted.
+ * - *Bottom*: a short sorted list holding the earliest events, from
+ *   which events are dequeued.
+ *
+ * When the bottom runs empty, the next non-empty bucket of the lowest
+ * rung is sorted into it; when the ladder runs empty, the top is spread
+ * on a new first rung, whose width is the span of the top events divided
+ * by their number.  Events are only ever sorted in small groups, which
+ * suits workloads with many timers at a few typical delays (pacing,
+ * transmission and propagation delays) where a calendar queue keeps
+ * resizing and a heap pays a logarithmic cost.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | Append to the top or a bucket; short sorted insert in the bottom
+ * IsEmpty()    | Constant        | The bottom is empty only if all tiers are
+ * PeekNext()   | Constant        | Front of the bottom
+ * Remove()     | ~Constant       | Search within a bucket or the bottom; linear in the top
+ * RemoveNext() | ~Constant       | Pop the bottom; refill from the ladder
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | ~`MaxRungs` x `sizeof (Rung)`    | Rung stack
+ * Per Event | `sizeof (Event)` + bucket slack  | `std::vector` buckets
+ */
+class LadderScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  LadderScheduler ();
+  /** Destructor. */
+  virtual ~LadderScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /** Ladder bucket type: an unsorted vector of Events. */
+  typedef std::vector<Scheduler::Event> Bucket;
+
+  /** A rung of the ladder. */
+  struct Rung
+  {
+    uint64_t start;               //!< Time stamp at the start of the first bucket
+    uint64_t width;               //!< Duration of a bucket, in dimensionless time units
+    uint32_t current;             //!< Index of the first bucket not yet dequeued
+    uint32_t count;               //!< Number of events in the buckets
+    std::vector<Bucket> buckets;  //!< The buckets
+    /**
+     * Get the start of the current bucket; events of this rung are not
+     * earlier than this.
+     * \return The time stamp at the start of the current bucket.
+     */
+    uint64_t CurrentStart (void) const
+    {
+      return start + current * width;
+    }
+  };
+
+  /**
+   * Spread events on a new rung below the existing ones.
+   *
+   * \param [in] start The start of the time span of the new rung.
+   * \param [in] end The end (exclusive) of the time span of the new rung.
+   * \param [in,out] events The events, all in [start, end); emptied.
+   */
+  void AddRung (uint64_t start, uint64_t end, Bucket &events);
+  /**
+   * Get the rung an event at a time stamp belongs to.
+   *
+   * \param [in] ts The time stamp, earlier than \c m_topStart.
+   * \returns The index of the rung, or the number of rungs if the
+   * event belongs to the bottom.
+   */
+  uint32_t FindRung (uint64_t ts) const;
+  /**
+   * Insert an event into the bottom, keeping it sorted.
+   *
+   * \param [in] ev The event.
+   */
+  void InsertBottom (const Scheduler::Event &ev);
+  /** Move the next events to the bottom, if the bottom is empty. */
+  void Refill (void);
+
+  /** Events later than the ladder, unsorted. */
+  Bucket m_top;
+  /** Smallest time stamp in the top. */
+  uint64_t m_topMin;
+  /** Largest time stamp in the top. */
+  uint64_t m_topMax;
+  /** Events at or after this time stamp go to the top. */
+  uint64_t m_topStart;
+  /** Rungs, from the coarsest to the finest. */
+  std::vector<Rung> m_rungs;
+  /** Earliest events, sorted. */
+  std::list<Scheduler::Event> m_bottom;
+  /** Bucket size above which a bucket is spread on a new rung. */
+  uint32_t m_threshold;
+  /** Maximum number of rungs. */
+  uint32_t m_maxRungs;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
@@ -72,17 +72,55 @@ RandomVariableStream::GetTypeId (void)
   return tid;
 }
 
+RandomVariableStream *RandomVariableStream::g_first = 0;
+
 RandomVariableStream::RandomVariableStream ()
-  : m_rng (0)
+  : m_rng (0),
+    m_streamIndex (0),
+    m_prev (0),
+    m_next (g_first)
 {
   NS_LOG_FUNCTION (this);
+  if (g_first != 0)
+    {
+      g_first->m_prev = this;
+    }
+  g_first = this;
 }
 RandomVariableStream::~RandomVariableStream ()
 {
   NS_LOG_FUNCTION (this);
+  if (m_prev != 0)
+    {
+      m_prev->m_next = m_next;
+    }
+  else
+    {
+      g_first = m_next;
+    }
+  if (m_next != 0)
+    {
+      m_next->m_prev = m_prev;
+    }
   delete m_rng;
 }
 
+void
+RandomVariableStream::ResetAll (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  for (RandomVariableStream *stream = g_first; stream != 0; stream = stream->m_next)
+    {
+      if (stream->m_rng != 0)
+        {
+          delete stream->m_rng;
+          stream->m_rng = new RngStream (RngSeedManager::GetSeed (),
+                                         stream->m_streamIndex,
+                                         RngSeedManager::GetRun ());
+        }
+    }
+}
+
 void
 RandomVariableStream::SetAntithetic (bool isAntithetic)
 {
@@ -108,6 +146,7 @@ RandomVariableStream::SetStream (int64_t stream)
       // number assignment.
       uint64_t nextStream = RngSeedManager::GetNextStreamIndex ();
       NS_ASSERT (nextStream <= ((1ULL) << 63));
+      m_streamIndex = nextStream;
       m_rng = new RngStream (RngSeedManager::GetSeed (),
                              nextStream,
                              RngSeedManager::GetRun ());
@@ -118,6 +157,7 @@ RandomVariableStream::SetStream (int64_t stream)
       // number assignment.
       uint64_t base = ((1ULL) << 63);
       uint64_t target = base + stream;
+      m_streamIndex = target;
       m_rng = new RngStream (RngSeedManager::GetSeed (),
                              target,
                              RngSeedManager::GetRun ());
@@ -149,6 +149,18 @@ public:
    */
   virtual uint32_t GetInteger (void) = 0;
 
+  /**
+   * \brief Restart every existing stream from the current seed and run.
+   *
+   * Each stream keeps its stream number (automatically allocated or not)
+   * and continues as if it had been created with the seed and run number
+   * currently set in RngSeedManager. This lets a process that built a
+   * scenario once (for example before forking) start independent
+   * replications of it by changing the run number.  Values a distribution
+   * caches between calls, such as the second normal deviate, are kept.
+   */
+  static void ResetAll (void);
+
 protected:
   /**
    * \brief Get the pointer to the underlying RngStream.
@@ -187,6 +199,15 @@ private:
   /** The stream number for the RngStream. */
   int64_t m_stream;
 
+  /** The stream index passed to the RngStream, for ResetAll. */
+  uint64_t m_streamIndex;
+
+  /** Previous and next stream in the list of existing streams, for ResetAll. */
+  RandomVariableStream *m_prev, *m_next;
+
+  /** First stream in the list of existing streams. */
+  static RandomVariableStream *g_first;
+
 };  // class RandomVariableStream
 
 
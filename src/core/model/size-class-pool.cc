@@ -0,0 +1,280 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "size-class-pool.h"
+#include "abort.h"
+#include "system-mutex.h"
+#include <atomic>
+#include <new>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::SizeClassPool implementation.
+ */
+
+namespace ns3 {
+
+namespace {
+
+/** Size classes are multiples of this, in bytes. */
+const std::size_t GRANULE = 16;
+/** Number of size classes; larger blocks use the global allocator. */
+const std::size_t N_CLASSES = 16;
+/** Size of the chunks blocks are carved from, in bytes. */
+const std::size_t CHUNK_BYTES = 64 * 1024;
+/** Free blocks a thread keeps per size class. */
+const uint32_t LOCAL_LIMIT = 8192;
+/** Free blocks moved to or from the shared lists at once. */
+const uint32_t BATCH = 4096;
+/** Maximum number of pools. */
+const uint32_t MAX_POOLS = 8;
+
+/** A free block, linked in a free list. */
+struct FreeBlock
+{
+  FreeBlock *next;  //!< Next free block of the same class
+};
+
+/** A linked list of free blocks of the same class. */
+struct FreeList
+{
+  FreeBlock *head;  //!< First block
+  uint32_t count;   //!< Number of blocks
+};
+
+/**
+ * Increment a counter only written by the current thread.
+ * \param [in,out] counter The counter.
+ */
+inline void
+Increment (std::atomic<uint64_t> &counter)
+{
+  counter.store (counter.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/** Number of pools created so far. */
+std::atomic<uint32_t> g_nPools (0);
+
+} // unnamed namespace
+
+/**
+ * The allocator state of a thread for one pool.
+ *
+ * Only the owning thread writes the counters; they are atomic so that
+ * GetStats can read them from another thread.
+ */
+struct SizeClassPool::ThreadPool
+{
+  SizeClassPool::Shared *shared;    //!< The state shared with the other threads
+  FreeList free[N_CLASSES];         //!< Free lists, by size class
+  char *chunk;                      //!< Start of the unused tail of the current chunk
+  std::size_t chunkLeft;            //!< Size of the unused tail of the current chunk
+  std::atomic<uint64_t> allocs;     //!< Blocks allocated by this thread
+  std::atomic<uint64_t> frees;      //!< Blocks freed by this thread
+  std::atomic<uint64_t> hits;       //!< Allocations served from a free list
+  std::atomic<uint64_t> misses;     //!< Allocations that needed fresh memory
+};
+
+/** The state of a pool shared by the threads. */
+struct SizeClassPool::Shared
+{
+  SystemMutex mutex;                        //!< Protects the members below
+  std::vector<FreeList> batches[N_CLASSES]; //!< Free lists handed over by threads
+  std::vector<ThreadPool *> threads;        //!< The states of all threads, for the statistics
+  uint64_t bytes;                           //!< Memory held in chunks
+};
+
+namespace {
+
+/** The state of the current thread, by pool index. */
+thread_local SizeClassPool::ThreadPool *t_pools[MAX_POOLS];
+
+/**
+ * Hands the free lists of a thread to the shared lists of their pools
+ * when the thread exits.  The ThreadPools themselves stay registered
+ * for the statistics.
+ */
+struct ThreadPoolReleaser
+{
+  ~ThreadPoolReleaser ()
+  {
+    for (uint32_t index = 0; index < MAX_POOLS; index++)
+      {
+        SizeClassPool::ThreadPool *pool = t_pools[index];
+        if (pool == 0)
+          {
+            continue;
+          }
+        CriticalSection lock (pool->shared->mutex);
+        for (std::size_t cls = 0; cls < N_CLASSES; cls++)
+          {
+            if (pool->free[cls].count != 0)
+              {
+                pool->shared->batches[cls].push_back (pool->free[cls]);
+                pool->free[cls].head = 0;
+                pool->free[cls].count = 0;
+              }
+          }
+        // A later allocation in this thread, e.g. from a static destructor, gets a new state
+        t_pools[index] = 0;
+      }
+  }
+};
+
+/** Releases the state of the current thread when it exits. */
+thread_local ThreadPoolReleaser t_releaser;
+
+} // unnamed namespace
+
+SizeClassPool::SizeClassPool ()
+  : m_index (g_nPools++),
+    m_shared (new Shared ())
+{
+  NS_ABORT_MSG_IF (m_index >= MAX_POOLS, "Too many SizeClassPools");
+  m_shared->bytes = 0;
+}
+
+SizeClassPool::ThreadPool *
+SizeClassPool::GetThreadPool (void)
+{
+  ThreadPool *pool = t_pools[m_index];
+  if (pool == 0)
+    {
+      pool = new ThreadPool ();
+      pool->shared = m_shared;
+      for (std::size_t cls = 0; cls < N_CLASSES; cls++)
+        {
+          pool->free[cls].head = 0;
+          pool->free[cls].count = 0;
+        }
+      pool->chunk = 0;
+      pool->chunkLeft = 0;
+      pool->allocs = 0;
+      pool->frees = 0;
+      pool->hits = 0;
+      pool->misses = 0;
+      {
+        CriticalSection lock (m_shared->mutex);
+        m_shared->threads.push_back (pool);
+      }
+      t_pools[m_index] = pool;
+      (void) &t_releaser;
+    }
+  return pool;
+}
+
+void *
+SizeClassPool::Allocate (std::size_t size)
+{
+  std::size_t cls = (size + GRANULE - 1) / GRANULE - 1;
+  ThreadPool *pool = GetThreadPool ();
+  Increment (pool->allocs);
+  if (cls >= N_CLASSES)
+    {
+      Increment (pool->misses);
+      return ::operator new (size);
+    }
+
+  FreeList &list = pool->free[cls];
+  if (list.head == 0)
+    {
+      CriticalSection lock (m_shared->mutex);
+      if (!m_shared->batches[cls].empty ())
+        {
+          list = m_shared->batches[cls].back ();
+          m_shared->batches[cls].pop_back ();
+        }
+    }
+  if (list.head != 0)
+    {
+      Increment (pool->hits);
+      FreeBlock *block = list.head;
+      list.head = block->next;
+      list.count--;
+      return block;
+    }
+
+  Increment (pool->misses);
+  std::size_t blockSize = (cls + 1) * GRANULE;
+  if (pool->chunkLeft < blockSize)
+    {
+      pool->chunk = static_cast<char *> (::operator new (CHUNK_BYTES));
+      pool->chunkLeft = CHUNK_BYTES;
+      CriticalSection lock (m_shared->mutex);
+      m_shared->bytes += CHUNK_BYTES;
+    }
+  void *block = pool->chunk;
+  pool->chunk += blockSize;
+  pool->chunkLeft -= blockSize;
+  return block;
+}
+
+void
+SizeClassPool::Deallocate (void *p, std::size_t size)
+{
+  std::size_t cls = (size + GRANULE - 1) / GRANULE - 1;
+  ThreadPool *pool = GetThreadPool ();
+  Increment (pool->frees);
+  if (cls >= N_CLASSES)
+    {
+      ::operator delete (p);
+      return;
+    }
+
+  FreeList &list = pool->free[cls];
+  FreeBlock *block = static_cast<FreeBlock *> (p);
+  block->next = list.head;
+  list.head = block;
+  list.count++;
+  if (list.count > LOCAL_LIMIT)
+    {
+      // Hand the most recently freed blocks over, keep the rest
+      FreeList batch = list;
+      FreeBlock *last = list.head;
+      for (uint32_t i = 1; i < BATCH; i++)
+        {
+          last = last->next;
+        }
+      list.head = last->next;
+      list.count -= BATCH;
+      last->next = 0;
+      batch.count = BATCH;
+      CriticalSection lock (m_shared->mutex);
+      m_shared->batches[cls].push_back (batch);
+    }
+}
+
+SizeClassPool::Stats
+SizeClassPool::GetStats (void) const
+{
+  CriticalSection lock (m_shared->mutex);
+  int64_t live = 0;
+  Stats stats = { 0, 0, 0, m_shared->bytes };
+  for (std::vector<ThreadPool *>::const_iterator i = m_shared->threads.begin (); i != m_shared->threads.end (); i++)
+    {
+      // Blocks may be freed by another thread than the one that allocated them
+      live += (*i)->allocs.load (std::memory_order_relaxed);
+      live -= (*i)->frees.load (std::memory_order_relaxed);
+      stats.hits += (*i)->hits.load (std::memory_order_relaxed);
+      stats.misses += (*i)->misses.load (std::memory_order_relaxed);
+    }
+  stats.live = live > 0 ? live : 0;
+  return stats;
+}
+
+} // namespace ns3
@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SIZE_CLASS_POOL_H
+#define SIZE_CLASS_POOL_H
+
+#include <stdint.h>
+#include <cstddef>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::SizeClassPool declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup core
+ * \brief A free list allocator for small, frequently recycled objects.
+ *
+ * Blocks are served from per-thread free lists, one per 16-byte size
+ * class up to 256 bytes, carved from 64 KiB chunks; larger requests use
+ * the global allocator.  Freed blocks go back to the free list of their
+ * class, so a steady-state workload does not call malloc/free.  Free
+ * lists are bounded: a thread that frees more blocks than it allocates
+ * hands batches to a list shared by all threads, which allocating
+ * threads draw from.  Chunks are never returned to the system.
+ *
+ * A class uses a pool through class-specific operator new and delete:
+ *
+ * \code
+ *   void *
+ *   MyClass::operator new (std::size_t size)
+ *   {
+ *     return GetPool ().Allocate (size);
+ *   }
+ * \endcode
+ *
+ * Pools must outlive every block they hand out, including the ones
+ * freed by static destructors, so they are created on first use and
+ * never destroyed.  At most eight pools may exist.
+ */
+class SizeClassPool
+{
+public:
+  /** Statistics of a pool, summed over all threads. */
+  struct Stats
+  {
+    uint64_t live;    //!< Blocks allocated and not yet freed
+    uint64_t hits;    //!< Allocations served from a free list
+    uint64_t misses;  //!< Allocations carved from a chunk or too large for the pool
+    uint64_t bytes;   //!< Memory held in chunks
+  };
+
+  /** Constructor. */
+  SizeClassPool ();
+
+  /**
+   * Allocate a block from the free list of its size class.
+   *
+   * \param [in] size The size of the block.
+   * \returns The block.
+   */
+  void * Allocate (std::size_t size);
+  /**
+   * Return a block to the free list of its size class.
+   *
+   * \param [in] p The block.
+   * \param [in] size The size passed to Allocate() for this block.
+   */
+  void Deallocate (void *p, std::size_t size);
+  /**
+   * Get the statistics of the pool.
+   *
+   * The counters of other threads are read while they may be updated, so
+   * the result is only exact when no other thread uses the pool.
+   *
+   * \returns The statistics.
+   */
+  Stats GetStats (void) const;
+
+  /** The allocator state of a thread. */
+  struct ThreadPool;
+  /** The state shared by the threads. */
+  struct Shared;
+
+private:
+  /**
+   * Get the state of the current thread, creating it on first use.
+   * \returns The state of the current thread.
+   */
+  ThreadPool * GetThreadPool (void);
+
+  /** Copying a pool would hand its blocks out twice. */
+  SizeClassPool (const SizeClassPool &);
+  /**
+   * Copying a pool would hand its blocks out twice.
+   * \returns The pool.
+   */
+  SizeClassPool & operator = (const SizeClassPool &);
+
+  /** Index of the pool in the per-thread state table. */
+  uint32_t m_index;
+  /** The state shared by the threads. */
+  Shared *m_shared;
+};
+
+} // namespace ns3
+
+#endif /* SIZE_CLASS_POOL_H */
@@ -2469,6 +2469,61 @@ NormalCachingTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_GT (v2, 0, "Incorrect value returned, expected > 0");
 }
 
+/**
+ * \ingroup rng-tests
+ * Test case for restarting existing streams with RandomVariableStream::ResetAll
+ */
+class ResetAllTestCase : public TestCaseBase
+{
+public:
+  // Constructor
+  ResetAllTestCase ();
+
+private:
+  // Inherited
+  virtual void DoRun (void);
+};
+
+ResetAllTestCase::ResetAllTestCase ()
+  : TestCaseBase ("Restart of existing streams from the current seed and run")
+{}
+
+void
+ResetAllTestCase::DoRun (void)
+{
+  NS_LOG_FUNCTION (this);
+  uint32_t seed = RngSeedManager::GetSeed ();
+  uint64_t run = RngSeedManager::GetRun ();
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+
+  Ptr<UniformRandomVariable> fixed = CreateObject<UniformRandomVariable> ();
+  fixed->SetStream (5);
+  Ptr<UniformRandomVariable> automatic = CreateObject<UniformRandomVariable> ();
+  double fixedRun1 = fixed->GetValue ();
+  double automaticRun1 = automatic->GetValue ();
+  fixed->GetValue ();
+  automatic->GetValue ();
+
+  // A stream restarted in run 2 draws what a stream created in run 2 draws
+  RngSeedManager::SetRun (2);
+  RandomVariableStream::ResetAll ();
+  Ptr<UniformRandomVariable> fresh = CreateObject<UniformRandomVariable> ();
+  fresh->SetStream (5);
+  double fixedRun2 = fixed->GetValue ();
+  NS_TEST_ASSERT_MSG_EQ (fixedRun2, fresh->GetValue (), "Restarted stream differs from a new stream");
+  NS_TEST_ASSERT_MSG_NE (fixedRun2, fixedRun1, "Restarted stream ignores the run number");
+
+  // Back in run 1, both streams start over
+  RngSeedManager::SetRun (1);
+  RandomVariableStream::ResetAll ();
+  NS_TEST_ASSERT_MSG_EQ (fixed->GetValue (), fixedRun1, "Fixed stream did not start over");
+  NS_TEST_ASSERT_MSG_EQ (automatic->GetValue (), automaticRun1, "Automatic stream did not start over");
+
+  RngSeedManager::SetSeed (seed);
+  RngSeedManager::SetRun (run);
+}
+
 /**
  * \ingroup rng-tests
  * RandomVariableStream test suite, covering all random number variable
@@ -2521,6 +2576,7 @@ RandomVariableSuite::RandomVariableSuite ()
   AddTestCase (new EmpiricalAntitheticTestCase);
   /// Issue #302:  NormalRandomVariable produces stale values
   AddTestCase (new NormalCachingTestCase);
+  AddTestCase (new ResetAllTestCase);
 }
 
 static RandomVariableSuite randomVariableSuite;  //!< Static variable for test initialization
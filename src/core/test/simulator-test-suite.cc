@@ -23,7 +23,10 @@
 #include "ns3/heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/ladder-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/uinteger.h"
+#include "ns3/default-simulator-impl.h"
 
 using namespace ns3;
 
@@ -531,6 +534,145 @@ SimulatorTemplateTestCase::DoRun (void)
 }
 
 
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that event memory is recycled through the event pool.
+ */
+class SimulatorEventPoolTestCase : public TestCase
+{
+public:
+  SimulatorEventPoolTestCase ();
+  virtual void DoRun (void);
+  /**
+   * Test Event.
+   * \param value Event parameter.
+   */
+  void Event (uint64_t value);
+};
+
+SimulatorEventPoolTestCase::SimulatorEventPoolTestCase ()
+  : TestCase ("Check that events are allocated from the event pool")
+{}
+
+void
+SimulatorEventPoolTestCase::Event (uint64_t value)
+{
+  (void) value;
+}
+
+void
+SimulatorEventPoolTestCase::DoRun (void)
+{
+  EventImpl::PoolStats start = EventImpl::GetPoolStats ();
+  for (uint64_t i = 0; i < 100; i++)
+    {
+      Simulator::Schedule (NanoSeconds (i), &SimulatorEventPoolTestCase::Event, this, i);
+    }
+  EventImpl::PoolStats scheduled = EventImpl::GetPoolStats ();
+  NS_TEST_EXPECT_MSG_EQ (scheduled.live, start.live + 100, "Scheduled events are not counted as live");
+  NS_TEST_EXPECT_MSG_EQ (scheduled.hits + scheduled.misses, start.hits + start.misses + 100,
+                         "Events were not allocated from the pool");
+
+  Simulator::Run ();
+  EventImpl::PoolStats run = EventImpl::GetPoolStats ();
+  NS_TEST_EXPECT_MSG_EQ (run.live, start.live, "Events were not returned to the pool");
+
+  // The memory of the events just run is reused
+  for (uint64_t i = 0; i < 100; i++)
+    {
+      Simulator::Schedule (NanoSeconds (i), &SimulatorEventPoolTestCase::Event, this, i);
+    }
+  EventImpl::PoolStats again = EventImpl::GetPoolStats ();
+  NS_TEST_EXPECT_MSG_EQ (again.hits, run.hits + 100, "Freed events were not reused");
+  NS_TEST_EXPECT_MSG_EQ (again.misses, run.misses, "Fresh memory used despite free events");
+  Simulator::Destroy ();
+  NS_TEST_EXPECT_MSG_EQ (EventImpl::GetPoolStats ().live, start.live, "Destroy did not free the events");
+}
+
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check the purge of the cancelled events of DefaultSimulatorImpl.
+ */
+class SimulatorPurgeTestCase : public TestCase
+{
+public:
+  SimulatorPurgeTestCase ();
+private:
+  virtual void DoRun (void);
+  /**
+   * Record that an event ran.
+   * \param [in] value The event index.
+   */
+  void Event (uint64_t value);
+  /**
+   * Get an occupancy counter of the simulator.
+   * \param [in] name The attribute name.
+   * \returns The counter value.
+   */
+  uint64_t GetCounter (std::string name) const;
+  std::vector<uint64_t> m_ran;  //!< Indices of the events which ran, in order
+};
+
+SimulatorPurgeTestCase::SimulatorPurgeTestCase ()
+  : TestCase ("Cancelled events are purged from the event queue")
+{}
+
+void
+SimulatorPurgeTestCase::Event (uint64_t value)
+{
+  m_ran.push_back (value);
+}
+
+uint64_t
+SimulatorPurgeTestCase::GetCounter (std::string name) const
+{
+  UintegerValue value;
+  Simulator::GetImplementation ()->GetAttribute (name, value);
+  return value.Get ();
+}
+
+void
+SimulatorPurgeTestCase::DoRun (void)
+{
+  Ptr<SimulatorImpl> impl = Simulator::GetImplementation ();
+  if (impl->GetInstanceTypeId () != DefaultSimulatorImpl::GetTypeId ())
+    {
+      return;
+    }
+  impl->SetAttribute ("PurgeMinimum", UintegerValue (10));
+
+  std::vector<EventId> events;
+  for (uint64_t i = 0; i < 100; i++)
+    {
+      events.push_back (Simulator::Schedule (NanoSeconds (i + 1), &SimulatorPurgeTestCase::Event, this, i));
+    }
+  NS_TEST_EXPECT_MSG_EQ (GetCounter ("QueuedEvents"), 100, "Wrong number of queued events");
+
+  // The 51st cancellation makes the cancelled events outnumber the live ones
+  for (uint64_t i = 0; i < 60; i++)
+    {
+      events[i].Cancel ();
+      // Cancelling twice is not counted twice
+      events[i].Cancel ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (GetCounter ("Purges"), 1, "The event queue was not purged once");
+  NS_TEST_EXPECT_MSG_EQ (GetCounter ("PurgedEvents"), 51, "Wrong number of purged events");
+  NS_TEST_EXPECT_MSG_EQ (GetCounter ("CancelledEvents"), 9, "Wrong number of cancelled events");
+  NS_TEST_EXPECT_MSG_EQ (GetCounter ("QueuedEvents"), 49, "Wrong number of queued events");
+
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (m_ran.size (), 40, "Wrong number of events ran");
+  for (uint64_t i = 0; i < m_ran.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_ran[i], 60 + i, "Live events ran out of order");
+    }
+  NS_TEST_EXPECT_MSG_EQ (GetCounter ("CancelledEvents"), 0, "Cancelled events left after the run");
+  NS_TEST_EXPECT_MSG_EQ (GetCounter ("QueuedEvents"), 0, "Events left after the run");
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup simulator-tests
  *  
@@ -554,6 +696,13 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (PriorityQueueScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (LadderScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    // Spread every bucket on a finer rung
+    factory.Set ("BucketThreshold", UintegerValue (1));
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new SimulatorEventPoolTestCase, TestCase::QUICK);
+    AddTestCase (new SimulatorPurgeTestCase, TestCase::QUICK);
   }
 };
 
@@ -27,9 +27,19 @@
 #include <queue>
 #include <algorithm>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <unistd.h>
 #include "ns3/assert.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/string.h"
+#include "ns3/hash.h"
+#include "ns3/system-path.h"
+#include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
@@ -38,11 +48,24 @@
 #include "global-route-manager-impl.h"
 #include "candidate-queue.h"
 #include "ipv4-global-routing.h"
+#include "ipv4-routing-table-entry.h"
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("GlobalRouteManagerImpl");
 
+/**
+ * \relates GlobalRouteManagerImpl
+ * \anchor GlobalValueGlobalRoutingCacheDir
+ * \brief Directory of the cached global routing tables.
+ */
+static GlobalValue g_globalRoutingCacheDir = GlobalValue ("GlobalRoutingCacheDir",
+                                                          "Directory in which the global route manager keeps the routing "
+                                                          "tables of every topology it computed, to load them instead of "
+                                                          "running SPF again; empty disables the cache",
+                                                          StringValue (""),
+                                                          MakeStringChecker ());
+
 /**
  * \brief Stream insertion operator.
  *
@@ -698,6 +721,13 @@ GlobalRouteManagerImpl::InitializeRoutes ()
 //
 // Walk the list of nodes in the system.
 //
+  std::string cacheFile = GetRouteCacheFilename ();
+  if (!cacheFile.empty () && LoadRoutes (cacheFile))
+    {
+      NS_LOG_INFO ("Loaded routes from " << cacheFile);
+      return;
+    }
+
   NS_LOG_INFO ("About to start SPF calculation");
   NodeList::Iterator listEnd = NodeList::End ();
   for (NodeList::Iterator i = NodeList::Begin (); i != listEnd; i++)
@@ -727,6 +757,208 @@ GlobalRouteManagerImpl::InitializeRoutes ()
         }
     }
   NS_LOG_INFO ("Finished SPF calculation");
+
+  if (!cacheFile.empty ())
+    {
+      SaveRoutes (cacheFile);
+    }
+}
+
+uint64_t
+GlobalRouteManagerImpl::TopologyFingerprint (void) const
+{
+  NS_LOG_FUNCTION (this);
+//
+// The LSAs of all routers go into the fingerprint since they all feed the
+// SPF calculation; the interfaces map the link data of the LSAs to the
+// outgoing interfaces of the routes.
+//
+  std::ostringstream topology;
+  uint32_t systemId = Simulator::GetSystemId ();
+  topology << "system " << systemId << std::endl;
+  NodeList::Iterator listEnd = NodeList::End ();
+  for (NodeList::Iterator i = NodeList::Begin (); i != listEnd; i++)
+    {
+      Ptr<Node> node = *i;
+      Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter> ();
+      if (!rtr)
+        {
+          continue;
+        }
+      topology << "node " << node->GetId () << " system " << node->GetSystemId ()
+               << " router " << rtr->GetRouterId () << std::endl;
+
+      Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+      for (uint32_t j = 0; j < ipv4->GetNInterfaces (); j++)
+        {
+          topology << "interface " << j << (ipv4->IsUp (j) ? " up" : " down")
+                   << " metric " << ipv4->GetMetric (j);
+          for (uint32_t k = 0; k < ipv4->GetNAddresses (j); k++)
+            {
+              Ipv4InterfaceAddress address = ipv4->GetAddress (j, k);
+              topology << " " << address.GetLocal () << "/" << address.GetMask ();
+            }
+          topology << std::endl;
+        }
+
+      for (uint32_t j = 0; j < rtr->GetNumLSAs (); j++)
+        {
+          GlobalRoutingLSA lsa;
+          rtr->GetLSA (j, lsa);
+          topology << lsa;
+        }
+    }
+  return Hash64 (topology.str ());
+}
+
+std::string
+GlobalRouteManagerImpl::GetRouteCacheFilename (void) const
+{
+  NS_LOG_FUNCTION (this);
+  StringValue cacheDir;
+  g_globalRoutingCacheDir.GetValue (cacheDir);
+  if (cacheDir.Get ().empty ())
+    {
+      return "";
+    }
+  std::ostringstream name;
+  name << "global-routes-" << std::hex << std::setw (16) << std::setfill ('0')
+       << TopologyFingerprint () << ".txt";
+  return SystemPath::Append (cacheDir.Get (), name.str ());
+}
+
+//
+// The cache file is plain text:
+//
+//   ns3-global-routes 1
+//   node <id> <host routes> <network routes> <external routes>
+//   <destination> <mask> <gateway> <interface>
+//   ...
+//
+// with one node line per router of this system, followed by its routes in
+// table order.
+//
+bool
+GlobalRouteManagerImpl::LoadRoutes (std::string filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  std::ifstream in (filename.c_str ());
+  std::string magic;
+  uint32_t version = 0;
+  if (!(in >> magic >> version) || magic != "ns3-global-routes" || version != 1)
+    {
+      NS_LOG_LOGIC ("No usable route cache in " << filename);
+      return false;
+    }
+
+  struct CachedTable
+  {
+    Ptr<Ipv4GlobalRouting> routing;
+    std::vector<Ipv4RoutingTableEntry> routes[3]; // host, network, external
+  };
+  std::vector<CachedTable> tables;
+  std::string keyword;
+  while (in >> keyword)
+    {
+      uint32_t nodeId;
+      uint32_t nRoutes[3];
+      if (keyword != "node" || !(in >> nodeId >> nRoutes[0] >> nRoutes[1] >> nRoutes[2])
+          || nodeId >= NodeList::GetNNodes ())
+        {
+          NS_LOG_WARN ("Malformed route cache " << filename);
+          return false;
+        }
+      Ptr<GlobalRouter> rtr = NodeList::GetNode (nodeId)->GetObject<GlobalRouter> ();
+      if (!rtr)
+        {
+          NS_LOG_WARN ("Route cache " << filename << " has routes for node " << nodeId <<
+                       ", which is not a global router");
+          return false;
+        }
+      CachedTable table;
+      table.routing = rtr->GetRoutingProtocol ();
+      for (uint32_t kind = 0; kind < 3; kind++)
+        {
+          for (uint32_t r = 0; r < nRoutes[kind]; r++)
+            {
+              std::string dest, mask, gateway;
+              uint32_t interface;
+              if (!(in >> dest >> mask >> gateway >> interface))
+                {
+                  NS_LOG_WARN ("Truncated route cache " << filename);
+                  return false;
+                }
+              table.routes[kind].push_back (Ipv4RoutingTableEntry::CreateNetworkRouteTo (
+                                              Ipv4Address (dest.c_str ()), Ipv4Mask (mask.c_str ()),
+                                              Ipv4Address (gateway.c_str ()), interface));
+            }
+        }
+      tables.push_back (table);
+    }
+
+  for (std::vector<CachedTable>::const_iterator t = tables.begin (); t != tables.end (); t++)
+    {
+      for (const Ipv4RoutingTableEntry &route : t->routes[0])
+        {
+          t->routing->AddHostRouteTo (route.GetDest (), route.GetGateway (), route.GetInterface ());
+        }
+      for (const Ipv4RoutingTableEntry &route : t->routes[1])
+        {
+          t->routing->AddNetworkRouteTo (route.GetDestNetwork (), route.GetDestNetworkMask (),
+                                         route.GetGateway (), route.GetInterface ());
+        }
+      for (const Ipv4RoutingTableEntry &route : t->routes[2])
+        {
+          t->routing->AddASExternalRouteTo (route.GetDestNetwork (), route.GetDestNetworkMask (),
+                                            route.GetGateway (), route.GetInterface ());
+        }
+    }
+  return true;
+}
+
+void
+GlobalRouteManagerImpl::SaveRoutes (std::string filename) const
+{
+  NS_LOG_FUNCTION (this << filename);
+  StringValue cacheDir;
+  g_globalRoutingCacheDir.GetValue (cacheDir);
+  SystemPath::MakeDirectories (cacheDir.Get ());
+
+  std::ostringstream tmpName;
+  tmpName << filename << ".tmp." << getpid ();
+  std::ofstream out (tmpName.str ().c_str ());
+  out << "ns3-global-routes 1" << std::endl;
+
+  std::vector<Ipv4RoutingTableEntry> routes[3];
+  uint32_t systemId = Simulator::GetSystemId ();
+  NodeList::Iterator listEnd = NodeList::End ();
+  for (NodeList::Iterator i = NodeList::Begin (); i != listEnd; i++)
+    {
+      Ptr<Node> node = *i;
+      Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter> ();
+      if (!rtr || node->GetSystemId () != systemId)
+        {
+          continue;
+        }
+      rtr->GetRoutingProtocol ()->GetRoutes (routes[0], routes[1], routes[2]);
+      out << "node " << node->GetId () << " " << routes[0].size () << " "
+          << routes[1].size () << " " << routes[2].size () << std::endl;
+      for (uint32_t kind = 0; kind < 3; kind++)
+        {
+          for (const Ipv4RoutingTableEntry &route : routes[kind])
+            {
+              out << route.GetDestNetwork () << " " << route.GetDestNetworkMask () << " "
+                  << route.GetGateway () << " " << route.GetInterface () << std::endl;
+            }
+        }
+    }
+
+  out.close ();
+  if (!out || std::rename (tmpName.str ().c_str (), filename.c_str ()) != 0)
+    {
+      NS_LOG_WARN ("Could not write the route cache " << filename);
+      std::remove (tmpName.str ().c_str ());
+    }
 }
 
 //
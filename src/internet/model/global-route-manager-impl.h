@@ -26,6 +26,7 @@
 #include <list>
 #include <queue>
 #include <map>
+#include <string>
 #include <vector>
 #include "ns3/object.h"
 #include "ns3/ptr.h"
@@ -732,6 +733,10 @@ public:
 /**
  * @brief Compute routes using a Dijkstra SPF computation and populate
  * per-node forwarding tables
+ *
+ * If the GlobalRoutingCacheDir global value is set, the tables of a
+ * topology seen before are loaded from its cache file instead, and newly
+ * computed tables are saved there.
  */
   virtual void InitializeRoutes ();
 
@@ -770,6 +775,50 @@ private:
   SPFVertex* m_spfroot; //!< the root node
   GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
 
+  /**
+   * \brief Fingerprint the input of the SPF calculation.
+   *
+   * Hashes the LSAs of every router of this system together with the
+   * addresses and state of its interfaces, which decide the outgoing
+   * interfaces of the routes.  Two topologies with the same fingerprint get
+   * the same routing tables.
+   *
+   * \returns a 64-bit FNV-1a hash
+   */
+  uint64_t TopologyFingerprint (void) const;
+
+  /**
+   * \brief Get the route cache file for the current topology.
+   *
+   * The file is in the GlobalRoutingCacheDir directory and named after
+   * TopologyFingerprint (), so every topology gets its own file.
+   *
+   * \returns the file name, or an empty string if the GlobalRoutingCacheDir
+   * global value is not set
+   */
+  std::string GetRouteCacheFilename (void) const;
+
+  /**
+   * \brief Install the routing tables saved by SaveRoutes.
+   *
+   * The whole file is read and checked before any route is installed, so a
+   * missing, truncated or foreign file leaves the tables untouched.
+   *
+   * \param filename the cache file
+   * \returns true if the routes were installed
+   */
+  bool LoadRoutes (std::string filename);
+
+  /**
+   * \brief Save the global routing tables of all routers of this system.
+   *
+   * The file is written under a temporary name and renamed, so concurrent
+   * runs of the same topology never see a partial file.
+   *
+   * \param filename the cache file
+   */
+  void SaveRoutes (std::string filename) const;
+
   /**
    * \brief Test if a node is a stub, from an OSPF sense.
    *
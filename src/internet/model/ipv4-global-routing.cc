@@ -17,6 +17,7 @@
 //
 
 #include <vector>
+#include <algorithm>
 #include <iomanip>
 #include "ns3/names.h"
 #include "ns3/log.h"
@@ -59,7 +60,9 @@ Ipv4GlobalRouting::GetTypeId (void)
 
 Ipv4GlobalRouting::Ipv4GlobalRouting () 
   : m_randomEcmpRouting (false),
-    m_respondToInterfaceEvents (false)
+    m_respondToInterfaceEvents (false),
+    m_lookupValid (false),
+    m_networkTrieUsable (true)
 {
   NS_LOG_FUNCTION (this);
 
@@ -80,6 +83,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, nextHop, interface);
   m_hostRoutes.push_back (route);
+  m_lookupValid = false;
 }
 
 void 
@@ -90,6 +94,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, interface);
   m_hostRoutes.push_back (route);
+  m_lookupValid = false;
 }
 
 void 
@@ -105,6 +110,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         nextHop,
                                                         interface);
   m_networkRoutes.push_back (route);
+  m_lookupValid = false;
 }
 
 void 
@@ -118,6 +124,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         networkMask,
                                                         interface);
   m_networkRoutes.push_back (route);
+  m_lookupValid = false;
 }
 
 void 
@@ -136,6 +143,49 @@ Ipv4GlobalRouting::AddASExternalRouteTo (Ipv4Address network,
 }
 
 
+void
+Ipv4GlobalRouting::BuildLookup (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_hostLookup.clear ();
+  for (HostRoutesCI i = m_hostRoutes.begin (); i != m_hostRoutes.end (); i++)
+    {
+      NS_ASSERT ((*i)->IsHost ());
+      m_hostLookup[(*i)->GetDest ().Get ()].push_back (*i);
+    }
+
+  m_networkTrie.assign (1, TrieNode ());
+  m_networkTrie[0].child[0] = m_networkTrie[0].child[1] = 0;
+  m_networkTrieUsable = true;
+  uint32_t position = 0;
+  for (NetworkRoutesCI j = m_networkRoutes.begin (); j != m_networkRoutes.end (); j++, position++)
+    {
+      uint32_t mask = (*j)->GetDestNetworkMask ().Get ();
+      if ((~mask & (~mask + 1)) != 0)
+        {
+          NS_LOG_LOGIC ("Non-contiguous mask " << (*j)->GetDestNetworkMask () << ", network routes are scanned");
+          m_networkTrieUsable = false;
+          break;
+        }
+      uint32_t network = (*j)->GetDestNetwork ().Get ();
+      uint16_t length = (*j)->GetDestNetworkMask ().GetPrefixLength ();
+      uint32_t node = 0;
+      for (uint16_t depth = 0; depth < length; depth++)
+        {
+          uint32_t bit = (network >> (31 - depth)) & 1;
+          if (m_networkTrie[node].child[bit] == 0)
+            {
+              m_networkTrie[node].child[bit] = m_networkTrie.size ();
+              m_networkTrie.push_back (TrieNode ());
+              m_networkTrie.back ().child[0] = m_networkTrie.back ().child[1] = 0;
+            }
+          node = m_networkTrie[node].child[bit];
+        }
+      m_networkTrie[node].routes.push_back (IndexedRoute (position, *j));
+    }
+  m_lookupValid = true;
+}
+
 Ptr<Ipv4Route>
 Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
 {
@@ -146,13 +196,18 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
   typedef std::vector<Ipv4RoutingTableEntry*> RouteVec_t;
   RouteVec_t allRoutes;
 
+  if (!m_lookupValid)
+    {
+      BuildLookup ();
+    }
+
   NS_LOG_LOGIC ("Number of m_hostRoutes = " << m_hostRoutes.size ());
-  for (HostRoutesCI i = m_hostRoutes.begin (); 
-       i != m_hostRoutes.end (); 
-       i++) 
+  std::unordered_map<uint32_t, std::vector<Ipv4RoutingTableEntry *> >::const_iterator host = m_hostLookup.find (dest.Get ());
+  if (host != m_hostLookup.end ())
     {
-      NS_ASSERT ((*i)->IsHost ());
-      if ((*i)->GetDest () == dest)
+      for (std::vector<Ipv4RoutingTableEntry *>::const_iterator i = host->second.begin ();
+           i != host->second.end ();
+           i++)
         {
           if (oif != 0)
             {
@@ -163,10 +218,58 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
                 }
             }
           allRoutes.push_back (*i);
-          NS_LOG_LOGIC (allRoutes.size () << "Found global host route" << *i); 
+          NS_LOG_LOGIC (allRoutes.size () << "Found global host route" << *i);
+        }
+    }
+  if (allRoutes.size () == 0 && m_networkTrieUsable) // if no host route is found
+    {
+      NS_LOG_LOGIC ("Number of m_networkRoutes" << m_networkRoutes.size ());
+      // Every prefix of dest along the trie path matches.  Candidates keep
+      // their table order, as in a scan of m_networkRoutes, so that ECMP
+      // picks the same route as before.
+      std::vector<IndexedRoute> matches;
+      uint32_t matchingPrefixes = 0;
+      uint32_t address = dest.Get ();
+      uint32_t node = 0;
+      for (uint32_t depth = 0; ; depth++)
+        {
+          const TrieNode &trieNode = m_networkTrie[node];
+          if (!trieNode.routes.empty ())
+            {
+              matches.insert (matches.end (), trieNode.routes.begin (), trieNode.routes.end ());
+              matchingPrefixes++;
+            }
+          if (depth == 32)
+            {
+              break;
+            }
+          node = trieNode.child[(address >> (31 - depth)) & 1];
+          if (node == 0)
+            {
+              break;
+            }
+        }
+      if (matchingPrefixes > 1)
+        {
+          std::sort (matches.begin (), matches.end ());
+        }
+      for (std::vector<IndexedRoute>::const_iterator j = matches.begin ();
+           j != matches.end ();
+           j++)
+        {
+          if (oif != 0)
+            {
+              if (oif != m_ipv4->GetNetDevice (j->second->GetInterface ()))
+                {
+                  NS_LOG_LOGIC ("Not on requested interface, skipping");
+                  continue;
+                }
+            }
+          allRoutes.push_back (j->second);
+          NS_LOG_LOGIC (allRoutes.size () << "Found global network route" << j->second);
         }
     }
-  if (allRoutes.size () == 0) // if no host route is found
+  else if (allRoutes.size () == 0)
     {
       NS_LOG_LOGIC ("Number of m_networkRoutes" << m_networkRoutes.size ());
       for (NetworkRoutesI j = m_networkRoutes.begin (); 
@@ -256,6 +359,29 @@ Ipv4GlobalRouting::GetNRoutes (void) const
   return n;
 }
 
+void
+Ipv4GlobalRouting::GetRoutes (std::vector<Ipv4RoutingTableEntry> &hostRoutes,
+                              std::vector<Ipv4RoutingTableEntry> &networkRoutes,
+                              std::vector<Ipv4RoutingTableEntry> &externalRoutes) const
+{
+  NS_LOG_FUNCTION (this);
+  hostRoutes.clear ();
+  for (HostRoutesCI i = m_hostRoutes.begin (); i != m_hostRoutes.end (); i++)
+    {
+      hostRoutes.push_back (**i);
+    }
+  networkRoutes.clear ();
+  for (NetworkRoutesCI j = m_networkRoutes.begin (); j != m_networkRoutes.end (); j++)
+    {
+      networkRoutes.push_back (**j);
+    }
+  externalRoutes.clear ();
+  for (ASExternalRoutesCI k = m_ASexternalRoutes.begin (); k != m_ASexternalRoutes.end (); k++)
+    {
+      externalRoutes.push_back (**k);
+    }
+}
+
 Ipv4RoutingTableEntry *
 Ipv4GlobalRouting::GetRoute (uint32_t index) const
 {
@@ -309,6 +435,7 @@ void
 Ipv4GlobalRouting::RemoveRoute (uint32_t index)
 {
   NS_LOG_FUNCTION (this << index);
+  m_lookupValid = false;
   if (index < m_hostRoutes.size ())
     {
       uint32_t tmp = 0;
@@ -392,6 +519,9 @@ Ipv4GlobalRouting::DoDispose (void)
     {
       delete (*l);
     }
+  m_hostLookup.clear ();
+  m_networkTrie.clear ();
+  m_lookupValid = false;
 
   Ipv4RoutingProtocol::DoDispose ();
 }
@@ -21,6 +21,9 @@
 #define IPV4_GLOBAL_ROUTING_H
 
 #include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -200,6 +203,21 @@ public:
    */
   Ipv4RoutingTableEntry *GetRoute (uint32_t i) const;
 
+  /**
+   * \brief Copy the routing table, one list per kind of route.
+   *
+   * Each list is in table order, and adding its routes back with the
+   * matching Add*RouteTo method rebuilds the same table.  Unlike GetRoute,
+   * this walks the table once.
+   *
+   * \param hostRoutes the routes added by AddHostRouteTo
+   * \param networkRoutes the routes added by AddNetworkRouteTo
+   * \param externalRoutes the routes added by AddASExternalRouteTo
+   */
+  void GetRoutes (std::vector<Ipv4RoutingTableEntry> &hostRoutes,
+                  std::vector<Ipv4RoutingTableEntry> &networkRoutes,
+                  std::vector<Ipv4RoutingTableEntry> &externalRoutes) const;
+
   /**
    * \brief Remove a route from the global unicast routing table.
    *
@@ -268,10 +286,37 @@ private:
    */
   Ptr<Ipv4Route> LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif = 0);
 
+  /**
+   * \brief Rebuild the lookup structures from the route lists.
+   *
+   * Called by LookupGlobal when the routes changed since the last build.
+   */
+  void BuildLookup (void);
+
   HostRoutes m_hostRoutes;             //!< Routes to hosts
   NetworkRoutes m_networkRoutes;       //!< Routes to networks
   ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+  /// A network route with its position in m_networkRoutes
+  typedef std::pair<uint32_t, Ipv4RoutingTableEntry *> IndexedRoute;
+
+  /**
+   * \brief A node of the binary trie over network route prefixes.
+   *
+   * The node at depth d stands for a d-bit prefix; its children extend it
+   * with a 0 or 1 bit.
+   */
+  struct TrieNode
+  {
+    uint32_t child[2];                 //!< Index of the child node, 0 if none (the root is never a child)
+    std::vector<IndexedRoute> routes;  //!< Network routes with exactly this prefix, in table order
+  };
+
+  bool m_lookupValid;  //!< True if the lookup structures match the route lists
+  std::unordered_map<uint32_t, std::vector<Ipv4RoutingTableEntry *> > m_hostLookup; //!< Host routes by destination, in table order
+  std::vector<TrieNode> m_networkTrie;  //!< Trie of the network routes, root first
+  bool m_networkTrieUsable;  //!< False if a network route has a non-contiguous mask, which the trie cannot hold
+
   Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
@@ -0,0 +1,153 @@
+#include <cstring>
+
+#include "acklog.hh"
+
+using namespace std;
+
+const char AckLogWriter::MAGIC[ 8 ] = { 'R', 'E', 'M', 'Y', 'A', 'C', 'K', '1' };
+
+AckLogWriter::AckLogWriter( const string & filename )
+  : _file( fopen( filename.c_str(), "wb" ) ),
+    _records()
+{
+  if ( _file ) {
+    uint32_t record_size = sizeof( AckRecord );
+    fwrite( MAGIC, 1, sizeof( MAGIC ), _file );
+    fwrite( &record_size, sizeof( record_size ), 1, _file );
+  }
+  _records.reserve( BLOCK_RECORDS );
+}
+
+AckLogWriter::~AckLogWriter()
+{
+  close();
+}
+
+void AckLogWriter::write( const AckRecord & record )
+{
+  _records.push_back( record );
+  if ( _records.size() == BLOCK_RECORDS ) {
+    write_block();
+  }
+}
+
+void AckLogWriter::write_block( void )
+{
+  if ( _file && !_records.empty() ) {
+    fwrite( _records.data(), sizeof( AckRecord ), _records.size(), _file );
+  }
+  _records.clear();
+}
+
+void AckLogWriter::close( void )
+{
+  if ( !_file ) {
+    return;
+  }
+  write_block();
+  fclose( _file );
+  _file = nullptr;
+}
+
+AckLogReader::AckLogReader( const string & filename )
+  : _file( fopen( filename.c_str(), "rb" ) ),
+    _records(),
+    _position( 0 )
+{
+  char magic[ sizeof( AckLogWriter::MAGIC ) ];
+  uint32_t record_size = 0;
+  if ( _file && ( fread( magic, 1, sizeof( magic ), _file ) != sizeof( magic )
+                  || memcmp( magic, AckLogWriter::MAGIC, sizeof( magic ) ) != 0
+                  || fread( &record_size, sizeof( record_size ), 1, _file ) != 1
+                  || record_size != sizeof( AckRecord ) ) ) {
+    fclose( _file );
+    _file = nullptr;
+  }
+}
+
+AckLogReader::~AckLogReader()
+{
+  if ( _file ) {
+    fclose( _file );
+  }
+}
+
+const vector< AckRecord > & AckLogReader::next_block( void )
+{
+  _records.resize( AckLogWriter::BLOCK_RECORDS );
+  size_t count = _file ? fread( _records.data(), sizeof( AckRecord ), _records.size(), _file ) : 0;
+  _records.resize( count );
+  return _records;
+}
+
+vector< AckRecord > AckLogReader::read_all( void )
+{
+  vector< AckRecord > all;
+  for ( const vector< AckRecord > * block = &next_block(); !block->empty(); block = &next_block() ) {
+    all.insert( all.end(), block->begin(), block->end() );
+  }
+  return all;
+}
+
+AckReplay::Decision AckReplay::decide( const Whisker & whisker, unsigned int previous_window, const Memory & memory )
+{
+  Decision decision;
+  decision.window = whisker.window( previous_window );
+  if ( decision.window > 16384 ) {
+    decision.window = 16384;
+  }
+  decision.intersend = whisker.intersend() * memory.field( Memory::REC_EWMA );
+  return decision;
+}
+
+AckReplay::AckReplay( const WhiskerTree & tree )
+  : _tree( tree ),
+    _flows(),
+    _records( 0 ),
+    _mismatches( 0 )
+{
+}
+
+AckReplay::Flow & AckReplay::flow( const AckRecord & record )
+{
+  if ( record.flow >= _flows.size() ) {
+    _flows.resize( record.flow + 1, Flow { Memory(), 0 } );
+  }
+  Flow & ret = _flows[ record.flow ];
+  ret.memory.set_datasize( record.datasize );
+  /* as in TcpRemy, the pacing rate needs the receive EWMA */
+  ret.memory.set_active_axes( _tree.active_axes() | ( 1u << Memory::REC_EWMA ) );
+  return ret;
+}
+
+AckReplay::Decision AckReplay::replay( const AckRecord & record )
+{
+  Flow & f = flow( record );
+  switch ( record.kind ) {
+  case AckRecord::RESET:
+    f.memory.reset();
+    f.window = 0;
+    break;
+  case AckRecord::INIT:
+    f.window = 0;
+    break;
+  default:
+    f.memory.packet_received( record.packet() );
+    break;
+  }
+
+  Decision decision = decide( _tree.use_whisker( f.memory ), f.window, f.memory );
+  f.window = decision.window;
+  _records++;
+  return decision;
+}
+
+bool AckReplay::check( const AckRecord & record )
+{
+  Decision decision = replay( record );
+  bool match = decision.window == record.window && decision.intersend == record.intersend;
+  if ( !match ) {
+    _mismatches++;
+  }
+  return match;
+}
@@ -0,0 +1,121 @@
+#ifndef ACKLOG_HH
+#define ACKLOG_HH
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "memory.hh"
+#include "packet.hh"
+#include "whiskertree.hh"
+
+/* one congestion-control decision of a RemyTCP flow and the input that led to it */
+struct AckRecord {
+  enum Kind : uint8_t {
+    INIT = 0,  /* flow started: memory as is, window 0 */
+    RESET,     /* flow reset: memory cleared, window 0 */
+    ACK        /* packet fed to the memory, then a decision */
+  };
+
+  uint32_t flow;
+  uint8_t kind;
+  uint8_t datasize;   /* Memory::datasize() of the flow */
+  uint16_t reserved;
+  double tick_sent, tick_received, seq_no, queue_stat, link_stat;
+  uint32_t window;    /* decision: window in packets */
+  uint32_t reserved2;
+  double intersend;   /* decision: intersend time in us */
+
+  RemyPacket packet( void ) const { return RemyPacket( tick_sent, tick_received, seq_no, queue_stat, link_stat ); }
+};
+
+/*
+ * Log of AckRecords:
+ *   file := MAGIC u32 record_size AckRecord*
+ * in native byte order. Records are buffered and written in blocks.
+ */
+class AckLogWriter {
+private:
+  FILE * _file;
+  std::vector< AckRecord > _records;
+
+  void write_block( void );
+
+public:
+  static const char MAGIC[ 8 ];
+  static const unsigned int BLOCK_RECORDS = 16384;
+
+  AckLogWriter( const std::string & filename );
+  ~AckLogWriter();
+
+  AckLogWriter( const AckLogWriter & other ) = delete;
+  AckLogWriter & operator=( const AckLogWriter & other ) = delete;
+
+  bool is_open( void ) const { return _file != nullptr; }
+  void write( const AckRecord & record );
+  void close( void );
+};
+
+class AckLogReader {
+private:
+  FILE * _file;
+  std::vector< AckRecord > _records;
+  size_t _position;
+
+public:
+  AckLogReader( const std::string & filename );
+  ~AckLogReader();
+
+  AckLogReader( const AckLogReader & other ) = delete;
+  AckLogReader & operator=( const AckLogReader & other ) = delete;
+
+  bool is_open( void ) const { return _file != nullptr; }
+
+  /* next block of records; empty at the end of the log */
+  const std::vector< AckRecord > & next_block( void );
+
+  /* reads the whole log */
+  std::vector< AckRecord > read_all( void );
+};
+
+/* replays logged flows through Memory and a WhiskerTree without a simulation */
+class AckReplay {
+public:
+  struct Decision {
+    unsigned int window;
+    double intersend;
+  };
+
+  /* the decision TcpRemy takes for a whisker */
+  static Decision decide( const Whisker & whisker, unsigned int previous_window, const Memory & memory );
+
+private:
+  struct Flow {
+    Memory memory;
+    unsigned int window;
+  };
+
+  const WhiskerTree & _tree;
+  std::vector< Flow > _flows;
+  uint64_t _records;
+  uint64_t _mismatches;
+
+  Flow & flow( const AckRecord & record );
+
+public:
+  AckReplay( const WhiskerTree & tree );
+
+  /* returns the decision the tree takes for the record */
+  Decision replay( const AckRecord & record );
+
+  /* replays a record and checks the logged decision; true if it matches */
+  bool check( const AckRecord & record );
+
+  void clear( void ) { _flows.clear(); _records = _mismatches = 0; }
+
+  uint64_t records( void ) const { return _records; }
+  uint64_t mismatches( void ) const { return _mismatches; }
+};
+
+#endif
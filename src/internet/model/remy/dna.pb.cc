@@ -14,316 +14,296 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ConfigRange_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ConfigVector_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Fin_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_FinTree_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Memory_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MemoryRange_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetConfig_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_OptimizationSetting_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_OptimizationSettings_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Range_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Whisker_dna_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_dna_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_WhiskerTree_dna_2eproto;
-namespace RemyBuffers {
-class WhiskerTreeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<WhiskerTree> _instance;
-} _WhiskerTree_default_instance_;
-class FinTreeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<FinTree> _instance;
-} _FinTree_default_instance_;
-class MemoryRangeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MemoryRange> _instance;
-} _MemoryRange_default_instance_;
-class MemoryDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Memory> _instance;
-} _Memory_default_instance_;
-class WhiskerDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Whisker> _instance;
-} _Whisker_default_instance_;
-class FinDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Fin> _instance;
-} _Fin_default_instance_;
-class OptimizationSettingDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<OptimizationSetting> _instance;
-} _OptimizationSetting_default_instance_;
-class OptimizationSettingsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<OptimizationSettings> _instance;
-} _OptimizationSettings_default_instance_;
-class RangeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Range> _instance;
-} _Range_default_instance_;
-class ConfigRangeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ConfigRange> _instance;
-} _ConfigRange_default_instance_;
-class NetConfigDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NetConfig> _instance;
-} _NetConfig_default_instance_;
-class ConfigVectorDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ConfigVector> _instance;
-} _ConfigVector_default_instance_;
-}  // namespace RemyBuffers
-static void InitDefaultsscc_info_ConfigRange_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_ConfigRange_default_instance_;
-    new (ptr) ::RemyBuffers::ConfigRange();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::ConfigRange::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ConfigRange_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ConfigRange_dna_2eproto}, {
-      &scc_info_Range_dna_2eproto.base,}};
-
-static void InitDefaultsscc_info_ConfigVector_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_ConfigVector_default_instance_;
-    new (ptr) ::RemyBuffers::ConfigVector();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::ConfigVector::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ConfigVector_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ConfigVector_dna_2eproto}, {
-      &scc_info_NetConfig_dna_2eproto.base,}};
-
-static void InitDefaultsscc_info_Fin_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_Fin_default_instance_;
-    new (ptr) ::RemyBuffers::Fin();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::Fin::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Fin_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Fin_dna_2eproto}, {
-      &scc_info_MemoryRange_dna_2eproto.base,}};
-
-static void InitDefaultsscc_info_FinTree_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_FinTree_default_instance_;
-    new (ptr) ::RemyBuffers::FinTree();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::FinTree::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_FinTree_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_FinTree_dna_2eproto}, {
-      &scc_info_MemoryRange_dna_2eproto.base,
-      &scc_info_Fin_dna_2eproto.base,
-      &scc_info_ConfigRange_dna_2eproto.base,
-      &scc_info_OptimizationSettings_dna_2eproto.base,
-      &scc_info_ConfigVector_dna_2eproto.base,}};
-
-static void InitDefaultsscc_info_Memory_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_Memory_default_instance_;
-    new (ptr) ::RemyBuffers::Memory();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::Memory::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Memory_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Memory_dna_2eproto}, {}};
-
-static void InitDefaultsscc_info_MemoryRange_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_MemoryRange_default_instance_;
-    new (ptr) ::RemyBuffers::MemoryRange();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::MemoryRange::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MemoryRange_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MemoryRange_dna_2eproto}, {
-      &scc_info_Memory_dna_2eproto.base,}};
-
-static void InitDefaultsscc_info_NetConfig_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_NetConfig_default_instance_;
-    new (ptr) ::RemyBuffers::NetConfig();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::NetConfig::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetConfig_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NetConfig_dna_2eproto}, {}};
-
-static void InitDefaultsscc_info_OptimizationSetting_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_OptimizationSetting_default_instance_;
-    new (ptr) ::RemyBuffers::OptimizationSetting();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::OptimizationSetting::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_OptimizationSetting_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_OptimizationSetting_dna_2eproto}, {}};
-
-static void InitDefaultsscc_info_OptimizationSettings_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_OptimizationSettings_default_instance_;
-    new (ptr) ::RemyBuffers::OptimizationSettings();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::OptimizationSettings::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_OptimizationSettings_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_OptimizationSettings_dna_2eproto}, {
-      &scc_info_OptimizationSetting_dna_2eproto.base,}};
-
-static void InitDefaultsscc_info_Range_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::RemyBuffers::_Range_default_instance_;
-    new (ptr) ::RemyBuffers::Range();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::Range::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Range_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Range_dna_2eproto}, {}};
-
-static void InitDefaultsscc_info_Whisker_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_Whisker_default_instance_;
-    new (ptr) ::RemyBuffers::Whisker();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::Whisker::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Whisker_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Whisker_dna_2eproto}, {
-      &scc_info_MemoryRange_dna_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static void InitDefaultsscc_info_WhiskerTree_dna_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::RemyBuffers::_WhiskerTree_default_instance_;
-    new (ptr) ::RemyBuffers::WhiskerTree();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::RemyBuffers::WhiskerTree::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_WhiskerTree_dna_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_WhiskerTree_dna_2eproto}, {
-      &scc_info_MemoryRange_dna_2eproto.base,
-      &scc_info_Whisker_dna_2eproto.base,
-      &scc_info_ConfigRange_dna_2eproto.base,
-      &scc_info_OptimizationSettings_dna_2eproto.base,
-      &scc_info_ConfigVector_dna_2eproto.base,}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_dna_2eproto[12];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_dna_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_dna_2eproto = nullptr;
+namespace RemyBuffers {
+PROTOBUF_CONSTEXPR WhiskerTree::WhiskerTree(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.children_)*/{}
+  , /*decltype(_impl_.domain_)*/nullptr
+  , /*decltype(_impl_.leaf_)*/nullptr
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.optimizer_)*/nullptr
+  , /*decltype(_impl_.configvector_)*/nullptr} {}
+struct WhiskerTreeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WhiskerTreeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WhiskerTreeDefaultTypeInternal() {}
+  union {
+    WhiskerTree _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WhiskerTreeDefaultTypeInternal _WhiskerTree_default_instance_;
+PROTOBUF_CONSTEXPR FinTree::FinTree(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.children_)*/{}
+  , /*decltype(_impl_.domain_)*/nullptr
+  , /*decltype(_impl_.leaf_)*/nullptr
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.optimizer_)*/nullptr
+  , /*decltype(_impl_.configvector_)*/nullptr} {}
+struct FinTreeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FinTreeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FinTreeDefaultTypeInternal() {}
+  union {
+    FinTree _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FinTreeDefaultTypeInternal _FinTree_default_instance_;
+PROTOBUF_CONSTEXPR MemoryRange::MemoryRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.active_axis_)*/{}
+  , /*decltype(_impl_.lower_)*/nullptr
+  , /*decltype(_impl_.upper_)*/nullptr} {}
+struct MemoryRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemoryRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemoryRangeDefaultTypeInternal() {}
+  union {
+    MemoryRange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemoryRangeDefaultTypeInternal _MemoryRange_default_instance_;
+PROTOBUF_CONSTEXPR Memory::Memory(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rec_send_ewma_)*/0
+  , /*decltype(_impl_.rec_rec_ewma_)*/0
+  , /*decltype(_impl_.rtt_ratio_)*/0
+  , /*decltype(_impl_.slow_rec_rec_ewma_)*/0
+  , /*decltype(_impl_.rtt_diff_)*/0
+  , /*decltype(_impl_.queueing_delay_)*/0
+  , /*decltype(_impl_.recent_loss_)*/0
+  , /*decltype(_impl_.int_queue_)*/0
+  , /*decltype(_impl_.int_link_)*/0} {}
+struct MemoryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemoryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemoryDefaultTypeInternal() {}
+  union {
+    Memory _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemoryDefaultTypeInternal _Memory_default_instance_;
+PROTOBUF_CONSTEXPR Whisker::Whisker(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.domain_)*/nullptr
+  , /*decltype(_impl_.window_multiple_)*/0
+  , /*decltype(_impl_.intersend_)*/0
+  , /*decltype(_impl_.window_increment_)*/0} {}
+struct WhiskerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WhiskerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WhiskerDefaultTypeInternal() {}
+  union {
+    Whisker _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WhiskerDefaultTypeInternal _Whisker_default_instance_;
+PROTOBUF_CONSTEXPR Fin::Fin(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.domain_)*/nullptr
+  , /*decltype(_impl_.lambda_)*/0} {}
+struct FinDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FinDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FinDefaultTypeInternal() {}
+  union {
+    Fin _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FinDefaultTypeInternal _Fin_default_instance_;
+PROTOBUF_CONSTEXPR OptimizationSetting::OptimizationSetting(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.min_value_)*/0
+  , /*decltype(_impl_.max_value_)*/0
+  , /*decltype(_impl_.min_change_)*/0
+  , /*decltype(_impl_.max_change_)*/0
+  , /*decltype(_impl_.multiplier_)*/0
+  , /*decltype(_impl_.default_value_)*/0} {}
+struct OptimizationSettingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OptimizationSettingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OptimizationSettingDefaultTypeInternal() {}
+  union {
+    OptimizationSetting _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OptimizationSettingDefaultTypeInternal _OptimizationSetting_default_instance_;
+PROTOBUF_CONSTEXPR OptimizationSettings::OptimizationSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.window_increment_)*/nullptr
+  , /*decltype(_impl_.window_multiple_)*/nullptr
+  , /*decltype(_impl_.intersend_)*/nullptr
+  , /*decltype(_impl_.lambda_)*/nullptr} {}
+struct OptimizationSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OptimizationSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OptimizationSettingsDefaultTypeInternal() {}
+  union {
+    OptimizationSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OptimizationSettingsDefaultTypeInternal _OptimizationSettings_default_instance_;
+PROTOBUF_CONSTEXPR Range::Range(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.low_)*/0
+  , /*decltype(_impl_.high_)*/0
+  , /*decltype(_impl_.incr_)*/0} {}
+struct RangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeDefaultTypeInternal() {}
+  union {
+    Range _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeDefaultTypeInternal _Range_default_instance_;
+PROTOBUF_CONSTEXPR ConfigRange::ConfigRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.link_packets_per_ms_)*/nullptr
+  , /*decltype(_impl_.rtt_)*/nullptr
+  , /*decltype(_impl_.num_senders_)*/nullptr
+  , /*decltype(_impl_.buffer_size_)*/nullptr
+  , /*decltype(_impl_.mean_off_duration_)*/nullptr
+  , /*decltype(_impl_.mean_on_duration_)*/nullptr
+  , /*decltype(_impl_.stochastic_loss_rate_)*/nullptr
+  , /*decltype(_impl_.simulation_ticks_)*/0u} {}
+struct ConfigRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigRangeDefaultTypeInternal() {}
+  union {
+    ConfigRange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigRangeDefaultTypeInternal _ConfigRange_default_instance_;
+PROTOBUF_CONSTEXPR NetConfig::NetConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.mean_on_duration_)*/0
+  , /*decltype(_impl_.mean_off_duration_)*/0
+  , /*decltype(_impl_.link_ppt_)*/0
+  , /*decltype(_impl_.num_senders_)*/0u
+  , /*decltype(_impl_.buffer_size_)*/0u
+  , /*decltype(_impl_.delay_)*/0
+  , /*decltype(_impl_.stochastic_loss_rate_)*/0} {}
+struct NetConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetConfigDefaultTypeInternal() {}
+  union {
+    NetConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetConfigDefaultTypeInternal _NetConfig_default_instance_;
+PROTOBUF_CONSTEXPR ConfigVector::ConfigVector(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.config_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConfigVectorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigVectorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigVectorDefaultTypeInternal() {}
+  union {
+    ConfigVector _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigVectorDefaultTypeInternal _ConfigVector_default_instance_;
+}  // namespace RemyBuffers
+static ::_pb::Metadata file_level_metadata_dna_2eproto[12];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_dna_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_dna_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_dna_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _has_bits_),
+const uint32_t TableStruct_dna_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, domain_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, children_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, leaf_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, config_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, optimizer_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, configvector_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _impl_.domain_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _impl_.children_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _impl_.leaf_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _impl_.config_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _impl_.optimizer_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::WhiskerTree, _impl_.configvector_),
   0,
   ~0u,
   1,
   2,
   3,
   4,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, domain_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, children_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, leaf_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, config_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, optimizer_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, configvector_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _impl_.domain_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _impl_.children_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _impl_.leaf_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _impl_.config_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _impl_.optimizer_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::FinTree, _impl_.configvector_),
   0,
   ~0u,
   1,
   2,
   3,
   4,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, lower_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, upper_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, active_axis_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, _impl_.lower_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, _impl_.upper_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::MemoryRange, _impl_.active_axis_),
   0,
   1,
   ~0u,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, rec_send_ewma_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, rec_rec_ewma_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, rtt_ratio_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, slow_rec_rec_ewma_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, rtt_diff_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, queueing_delay_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, recent_loss_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, int_queue_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, int_link_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.rec_send_ewma_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.rec_rec_ewma_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.rtt_ratio_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.slow_rec_rec_ewma_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.rtt_diff_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.queueing_delay_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.recent_loss_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.int_queue_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Memory, _impl_.int_link_),
   0,
   1,
   2,
@@ -333,82 +313,88 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_dna_2eproto::offsets[] PROTOBU
   6,
   7,
   8,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, window_increment_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, window_multiple_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, intersend_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, domain_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, _impl_.window_increment_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, _impl_.window_multiple_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, _impl_.intersend_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Whisker, _impl_.domain_),
+  3,
   1,
   2,
-  3,
   0,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Fin, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Fin, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::Fin, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Fin, lambda_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Fin, domain_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Fin, _impl_.lambda_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Fin, _impl_.domain_),
   1,
   0,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, min_value_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, max_value_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, min_change_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, max_change_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, multiplier_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, default_value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _impl_.min_value_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _impl_.max_value_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _impl_.min_change_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _impl_.max_change_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _impl_.multiplier_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSetting, _impl_.default_value_),
   0,
   1,
   2,
   3,
   4,
   5,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, window_increment_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, window_multiple_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, intersend_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, lambda_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, _impl_.window_increment_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, _impl_.window_multiple_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, _impl_.intersend_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::OptimizationSettings, _impl_.lambda_),
   0,
   1,
   2,
   3,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, low_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, high_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, incr_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, _impl_.low_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, _impl_.high_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::Range, _impl_.incr_),
   0,
   1,
   2,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, link_packets_per_ms_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, rtt_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, num_senders_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, buffer_size_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, mean_off_duration_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, mean_on_duration_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, simulation_ticks_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, stochastic_loss_rate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.link_packets_per_ms_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.rtt_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.num_senders_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.buffer_size_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.mean_off_duration_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.mean_on_duration_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.simulation_ticks_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigRange, _impl_.stochastic_loss_rate_),
   0,
   1,
   2,
@@ -417,18 +403,19 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_dna_2eproto::offsets[] PROTOBU
   5,
   7,
   6,
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, mean_on_duration_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, mean_off_duration_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, num_senders_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, link_ppt_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, delay_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, buffer_size_),
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, stochastic_loss_rate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_.mean_on_duration_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_.mean_off_duration_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_.num_senders_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_.link_ppt_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_.delay_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_.buffer_size_),
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::NetConfig, _impl_.stochastic_loss_rate_),
   0,
   1,
   3,
@@ -441,36 +428,37 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_dna_2eproto::offsets[] PROTOBU
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigVector, config_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RemyBuffers::ConfigVector, _impl_.config_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 11, sizeof(::RemyBuffers::WhiskerTree)},
-  { 17, 28, sizeof(::RemyBuffers::FinTree)},
-  { 34, 42, sizeof(::RemyBuffers::MemoryRange)},
-  { 45, 59, sizeof(::RemyBuffers::Memory)},
-  { 68, 77, sizeof(::RemyBuffers::Whisker)},
-  { 81, 88, sizeof(::RemyBuffers::Fin)},
-  { 90, 101, sizeof(::RemyBuffers::OptimizationSetting)},
-  { 107, 116, sizeof(::RemyBuffers::OptimizationSettings)},
-  { 120, 128, sizeof(::RemyBuffers::Range)},
-  { 131, 144, sizeof(::RemyBuffers::ConfigRange)},
-  { 152, 164, sizeof(::RemyBuffers::NetConfig)},
-  { 171, -1, sizeof(::RemyBuffers::ConfigVector)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::RemyBuffers::WhiskerTree)},
+  { 18, 30, -1, sizeof(::RemyBuffers::FinTree)},
+  { 36, 45, -1, sizeof(::RemyBuffers::MemoryRange)},
+  { 48, 63, -1, sizeof(::RemyBuffers::Memory)},
+  { 72, 82, -1, sizeof(::RemyBuffers::Whisker)},
+  { 86, 94, -1, sizeof(::RemyBuffers::Fin)},
+  { 96, 108, -1, sizeof(::RemyBuffers::OptimizationSetting)},
+  { 114, 124, -1, sizeof(::RemyBuffers::OptimizationSettings)},
+  { 128, 137, -1, sizeof(::RemyBuffers::Range)},
+  { 140, 154, -1, sizeof(::RemyBuffers::ConfigRange)},
+  { 162, 175, -1, sizeof(::RemyBuffers::NetConfig)},
+  { 182, -1, -1, sizeof(::RemyBuffers::ConfigVector)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_WhiskerTree_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_FinTree_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_MemoryRange_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_Memory_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_Whisker_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_Fin_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_OptimizationSetting_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_OptimizationSettings_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_Range_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_ConfigRange_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_NetConfig_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::RemyBuffers::_ConfigVector_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RemyBuffers::_WhiskerTree_default_instance_._instance,
+  &::RemyBuffers::_FinTree_default_instance_._instance,
+  &::RemyBuffers::_MemoryRange_default_instance_._instance,
+  &::RemyBuffers::_Memory_default_instance_._instance,
+  &::RemyBuffers::_Whisker_default_instance_._instance,
+  &::RemyBuffers::_Fin_default_instance_._instance,
+  &::RemyBuffers::_OptimizationSetting_default_instance_._instance,
+  &::RemyBuffers::_OptimizationSettings_default_instance_._instance,
+  &::RemyBuffers::_Range_default_instance_._instance,
+  &::RemyBuffers::_ConfigRange_default_instance_._instance,
+  &::RemyBuffers::_NetConfig_default_instance_._instance,
+  &::RemyBuffers::_ConfigVector_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_dna_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -533,32 +521,21 @@ const char descriptor_table_protodef_dna_2eproto[] PROTOBUF_SECTION_VARIABLE(pro
   "tor\022&\n\006config\030Q \003(\0132\026.RemyBuffers.NetCon"
   "fig"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_dna_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_dna_2eproto_sccs[12] = {
-  &scc_info_ConfigRange_dna_2eproto.base,
-  &scc_info_ConfigVector_dna_2eproto.base,
-  &scc_info_Fin_dna_2eproto.base,
-  &scc_info_FinTree_dna_2eproto.base,
-  &scc_info_Memory_dna_2eproto.base,
-  &scc_info_MemoryRange_dna_2eproto.base,
-  &scc_info_NetConfig_dna_2eproto.base,
-  &scc_info_OptimizationSetting_dna_2eproto.base,
-  &scc_info_OptimizationSettings_dna_2eproto.base,
-  &scc_info_Range_dna_2eproto.base,
-  &scc_info_Whisker_dna_2eproto.base,
-  &scc_info_WhiskerTree_dna_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_dna_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_dna_2eproto = {
-  false, false, descriptor_table_protodef_dna_2eproto, "dna.proto", 2283,
-  &descriptor_table_dna_2eproto_once, descriptor_table_dna_2eproto_sccs, descriptor_table_dna_2eproto_deps, 12, 0,
-  schemas, file_default_instances, TableStruct_dna_2eproto::offsets,
-  file_level_metadata_dna_2eproto, 12, file_level_enum_descriptors_dna_2eproto, file_level_service_descriptors_dna_2eproto,
+static ::_pbi::once_flag descriptor_table_dna_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_dna_2eproto = {
+    false, false, 2283, descriptor_table_protodef_dna_2eproto,
+    "dna.proto",
+    &descriptor_table_dna_2eproto_once, nullptr, 0, 12,
+    schemas, file_default_instances, TableStruct_dna_2eproto::offsets,
+    file_level_metadata_dna_2eproto, file_level_enum_descriptors_dna_2eproto,
+    file_level_service_descriptors_dna_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_dna_2eproto_getter() {
+  return &descriptor_table_dna_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_dna_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_dna_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_dna_2eproto(&descriptor_table_dna_2eproto);
 namespace RemyBuffers {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MemoryRange_Axis_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_dna_2eproto);
@@ -581,7 +558,7 @@ bool MemoryRange_Axis_IsValid(int value) {
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr MemoryRange_Axis MemoryRange::SEND_EWMA;
 constexpr MemoryRange_Axis MemoryRange::REC_EWMA;
 constexpr MemoryRange_Axis MemoryRange::RTT_RATIO;
@@ -594,25 +571,13 @@ constexpr MemoryRange_Axis MemoryRange::INT_LINK;
 constexpr MemoryRange_Axis MemoryRange::Axis_MIN;
 constexpr MemoryRange_Axis MemoryRange::Axis_MAX;
 constexpr int MemoryRange::Axis_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void WhiskerTree::InitAsDefaultInstance() {
-  ::RemyBuffers::_WhiskerTree_default_instance_._instance.get_mutable()->domain_ = const_cast< ::RemyBuffers::MemoryRange*>(
-      ::RemyBuffers::MemoryRange::internal_default_instance());
-  ::RemyBuffers::_WhiskerTree_default_instance_._instance.get_mutable()->leaf_ = const_cast< ::RemyBuffers::Whisker*>(
-      ::RemyBuffers::Whisker::internal_default_instance());
-  ::RemyBuffers::_WhiskerTree_default_instance_._instance.get_mutable()->config_ = const_cast< ::RemyBuffers::ConfigRange*>(
-      ::RemyBuffers::ConfigRange::internal_default_instance());
-  ::RemyBuffers::_WhiskerTree_default_instance_._instance.get_mutable()->optimizer_ = const_cast< ::RemyBuffers::OptimizationSettings*>(
-      ::RemyBuffers::OptimizationSettings::internal_default_instance());
-  ::RemyBuffers::_WhiskerTree_default_instance_._instance.get_mutable()->configvector_ = const_cast< ::RemyBuffers::ConfigVector*>(
-      ::RemyBuffers::ConfigVector::internal_default_instance());
-}
 class WhiskerTree::_Internal {
  public:
-  using HasBits = decltype(std::declval<WhiskerTree>()._has_bits_);
+  using HasBits = decltype(std::declval<WhiskerTree>()._impl_._has_bits_);
   static const ::RemyBuffers::MemoryRange& domain(const WhiskerTree* msg);
   static void set_has_domain(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
@@ -637,154 +602,153 @@ class WhiskerTree::_Internal {
 
 const ::RemyBuffers::MemoryRange&
 WhiskerTree::_Internal::domain(const WhiskerTree* msg) {
-  return *msg->domain_;
+  return *msg->_impl_.domain_;
 }
 const ::RemyBuffers::Whisker&
 WhiskerTree::_Internal::leaf(const WhiskerTree* msg) {
-  return *msg->leaf_;
+  return *msg->_impl_.leaf_;
 }
 const ::RemyBuffers::ConfigRange&
 WhiskerTree::_Internal::config(const WhiskerTree* msg) {
-  return *msg->config_;
+  return *msg->_impl_.config_;
 }
 const ::RemyBuffers::OptimizationSettings&
 WhiskerTree::_Internal::optimizer(const WhiskerTree* msg) {
-  return *msg->optimizer_;
+  return *msg->_impl_.optimizer_;
 }
 const ::RemyBuffers::ConfigVector&
 WhiskerTree::_Internal::configvector(const WhiskerTree* msg) {
-  return *msg->configvector_;
+  return *msg->_impl_.configvector_;
 }
-WhiskerTree::WhiskerTree(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  children_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+WhiskerTree::WhiskerTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.WhiskerTree)
 }
 WhiskerTree::WhiskerTree(const WhiskerTree& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_),
-      children_(from.children_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WhiskerTree* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.children_){from._impl_.children_}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.leaf_){nullptr}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.optimizer_){nullptr}
+    , decltype(_impl_.configvector_){nullptr}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_domain()) {
-    domain_ = new ::RemyBuffers::MemoryRange(*from.domain_);
-  } else {
-    domain_ = nullptr;
+    _this->_impl_.domain_ = new ::RemyBuffers::MemoryRange(*from._impl_.domain_);
   }
   if (from._internal_has_leaf()) {
-    leaf_ = new ::RemyBuffers::Whisker(*from.leaf_);
-  } else {
-    leaf_ = nullptr;
+    _this->_impl_.leaf_ = new ::RemyBuffers::Whisker(*from._impl_.leaf_);
   }
   if (from._internal_has_config()) {
-    config_ = new ::RemyBuffers::ConfigRange(*from.config_);
-  } else {
-    config_ = nullptr;
+    _this->_impl_.config_ = new ::RemyBuffers::ConfigRange(*from._impl_.config_);
   }
   if (from._internal_has_optimizer()) {
-    optimizer_ = new ::RemyBuffers::OptimizationSettings(*from.optimizer_);
-  } else {
-    optimizer_ = nullptr;
+    _this->_impl_.optimizer_ = new ::RemyBuffers::OptimizationSettings(*from._impl_.optimizer_);
   }
   if (from._internal_has_configvector()) {
-    configvector_ = new ::RemyBuffers::ConfigVector(*from.configvector_);
-  } else {
-    configvector_ = nullptr;
+    _this->_impl_.configvector_ = new ::RemyBuffers::ConfigVector(*from._impl_.configvector_);
   }
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.WhiskerTree)
 }
 
-void WhiskerTree::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_WhiskerTree_dna_2eproto.base);
-  ::memset(&domain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&configvector_) -
-      reinterpret_cast<char*>(&domain_)) + sizeof(configvector_));
+inline void WhiskerTree::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.children_){arena}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.leaf_){nullptr}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.optimizer_){nullptr}
+    , decltype(_impl_.configvector_){nullptr}
+  };
 }
 
 WhiskerTree::~WhiskerTree() {
   // @@protoc_insertion_point(destructor:RemyBuffers.WhiskerTree)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void WhiskerTree::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete domain_;
-  if (this != internal_default_instance()) delete leaf_;
-  if (this != internal_default_instance()) delete config_;
-  if (this != internal_default_instance()) delete optimizer_;
-  if (this != internal_default_instance()) delete configvector_;
+inline void WhiskerTree::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.children_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.domain_;
+  if (this != internal_default_instance()) delete _impl_.leaf_;
+  if (this != internal_default_instance()) delete _impl_.config_;
+  if (this != internal_default_instance()) delete _impl_.optimizer_;
+  if (this != internal_default_instance()) delete _impl_.configvector_;
 }
 
-void WhiskerTree::ArenaDtor(void* object) {
-  WhiskerTree* _this = reinterpret_cast< WhiskerTree* >(object);
-  (void)_this;
-}
-void WhiskerTree::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void WhiskerTree::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const WhiskerTree& WhiskerTree::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_WhiskerTree_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void WhiskerTree::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.WhiskerTree)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  children_.Clear();
-  cached_has_bits = _has_bits_[0];
+  _impl_.children_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     if (cached_has_bits & 0x00000001u) {
-      GOOGLE_DCHECK(domain_ != nullptr);
-      domain_->Clear();
+      GOOGLE_DCHECK(_impl_.domain_ != nullptr);
+      _impl_.domain_->Clear();
     }
     if (cached_has_bits & 0x00000002u) {
-      GOOGLE_DCHECK(leaf_ != nullptr);
-      leaf_->Clear();
+      GOOGLE_DCHECK(_impl_.leaf_ != nullptr);
+      _impl_.leaf_->Clear();
     }
     if (cached_has_bits & 0x00000004u) {
-      GOOGLE_DCHECK(config_ != nullptr);
-      config_->Clear();
+      GOOGLE_DCHECK(_impl_.config_ != nullptr);
+      _impl_.config_->Clear();
     }
     if (cached_has_bits & 0x00000008u) {
-      GOOGLE_DCHECK(optimizer_ != nullptr);
-      optimizer_->Clear();
+      GOOGLE_DCHECK(_impl_.optimizer_ != nullptr);
+      _impl_.optimizer_->Clear();
     }
     if (cached_has_bits & 0x00000010u) {
-      GOOGLE_DCHECK(configvector_ != nullptr);
-      configvector_->Clear();
+      GOOGLE_DCHECK(_impl_.configvector_ != nullptr);
+      _impl_.configvector_->Clear();
     }
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* WhiskerTree::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* WhiskerTree::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional .RemyBuffers.MemoryRange domain = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_domain(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .RemyBuffers.WhiskerTree children = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -792,116 +756,117 @@ const char* WhiskerTree::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Whisker leaf = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_leaf(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.ConfigRange config = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.OptimizationSettings optimizer = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr = ctx->ParseMessage(_internal_mutable_optimizer(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.ConfigVector configvector = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_configvector(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* WhiskerTree::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* WhiskerTree::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.WhiskerTree)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .RemyBuffers.MemoryRange domain = 1;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::domain(this), target, stream);
+      InternalWriteMessage(1, _Internal::domain(this),
+        _Internal::domain(this).GetCachedSize(), target, stream);
   }
 
   // repeated .RemyBuffers.WhiskerTree children = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_children_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_children_size()); i < n; i++) {
+    const auto& repfield = this->_internal_children(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_children(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Whisker leaf = 3;
   if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::leaf(this), target, stream);
+      InternalWriteMessage(3, _Internal::leaf(this),
+        _Internal::leaf(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.ConfigRange config = 4;
   if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::config(this), target, stream);
+      InternalWriteMessage(4, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.OptimizationSettings optimizer = 5;
   if (cached_has_bits & 0x00000008u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::optimizer(this), target, stream);
+      InternalWriteMessage(5, _Internal::optimizer(this),
+        _Internal::optimizer(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.ConfigVector configvector = 6;
   if (cached_has_bits & 0x00000010u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::configvector(this), target, stream);
+      InternalWriteMessage(6, _Internal::configvector(this),
+        _Internal::configvector(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.WhiskerTree)
@@ -912,112 +877,98 @@ size_t WhiskerTree::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.WhiskerTree)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .RemyBuffers.WhiskerTree children = 2;
   total_size += 1UL * this->_internal_children_size();
-  for (const auto& msg : this->children_) {
+  for (const auto& msg : this->_impl_.children_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     // optional .RemyBuffers.MemoryRange domain = 1;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *domain_);
+          *_impl_.domain_);
     }
 
     // optional .RemyBuffers.Whisker leaf = 3;
     if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *leaf_);
+          *_impl_.leaf_);
     }
 
     // optional .RemyBuffers.ConfigRange config = 4;
     if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *config_);
+          *_impl_.config_);
     }
 
     // optional .RemyBuffers.OptimizationSettings optimizer = 5;
     if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *optimizer_);
+          *_impl_.optimizer_);
     }
 
     // optional .RemyBuffers.ConfigVector configvector = 6;
     if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *configvector_);
+          *_impl_.configvector_);
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WhiskerTree::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.WhiskerTree)
-  GOOGLE_DCHECK_NE(&from, this);
-  const WhiskerTree* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<WhiskerTree>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.WhiskerTree)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.WhiskerTree)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WhiskerTree::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WhiskerTree::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WhiskerTree::GetClassData() const { return &_class_data_; }
 
-void WhiskerTree::MergeFrom(const WhiskerTree& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.WhiskerTree)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void WhiskerTree::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WhiskerTree*>(&to_msg);
+  auto& from = static_cast<const WhiskerTree&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.WhiskerTree)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  children_.MergeFrom(from.children_);
-  cached_has_bits = from._has_bits_[0];
+  _this->_impl_.children_.MergeFrom(from._impl_.children_);
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(from._internal_domain());
+      _this->_internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(
+          from._internal_domain());
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_mutable_leaf()->::RemyBuffers::Whisker::MergeFrom(from._internal_leaf());
+      _this->_internal_mutable_leaf()->::RemyBuffers::Whisker::MergeFrom(
+          from._internal_leaf());
     }
     if (cached_has_bits & 0x00000004u) {
-      _internal_mutable_config()->::RemyBuffers::ConfigRange::MergeFrom(from._internal_config());
+      _this->_internal_mutable_config()->::RemyBuffers::ConfigRange::MergeFrom(
+          from._internal_config());
     }
     if (cached_has_bits & 0x00000008u) {
-      _internal_mutable_optimizer()->::RemyBuffers::OptimizationSettings::MergeFrom(from._internal_optimizer());
+      _this->_internal_mutable_optimizer()->::RemyBuffers::OptimizationSettings::MergeFrom(
+          from._internal_optimizer());
     }
     if (cached_has_bits & 0x00000010u) {
-      _internal_mutable_configvector()->::RemyBuffers::ConfigVector::MergeFrom(from._internal_configvector());
+      _this->_internal_mutable_configvector()->::RemyBuffers::ConfigVector::MergeFrom(
+          from._internal_configvector());
     }
   }
-}
-
-void WhiskerTree::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.WhiskerTree)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void WhiskerTree::CopyFrom(const WhiskerTree& from) {
@@ -1033,39 +984,28 @@ bool WhiskerTree::IsInitialized() const {
 
 void WhiskerTree::InternalSwap(WhiskerTree* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  children_.InternalSwap(&other->children_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.children_.InternalSwap(&other->_impl_.children_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(WhiskerTree, configvector_)
-      + sizeof(WhiskerTree::configvector_)
-      - PROTOBUF_FIELD_OFFSET(WhiskerTree, domain_)>(
-          reinterpret_cast<char*>(&domain_),
-          reinterpret_cast<char*>(&other->domain_));
+      PROTOBUF_FIELD_OFFSET(WhiskerTree, _impl_.configvector_)
+      + sizeof(WhiskerTree::_impl_.configvector_)
+      - PROTOBUF_FIELD_OFFSET(WhiskerTree, _impl_.domain_)>(
+          reinterpret_cast<char*>(&_impl_.domain_),
+          reinterpret_cast<char*>(&other->_impl_.domain_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata WhiskerTree::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void FinTree::InitAsDefaultInstance() {
-  ::RemyBuffers::_FinTree_default_instance_._instance.get_mutable()->domain_ = const_cast< ::RemyBuffers::MemoryRange*>(
-      ::RemyBuffers::MemoryRange::internal_default_instance());
-  ::RemyBuffers::_FinTree_default_instance_._instance.get_mutable()->leaf_ = const_cast< ::RemyBuffers::Fin*>(
-      ::RemyBuffers::Fin::internal_default_instance());
-  ::RemyBuffers::_FinTree_default_instance_._instance.get_mutable()->config_ = const_cast< ::RemyBuffers::ConfigRange*>(
-      ::RemyBuffers::ConfigRange::internal_default_instance());
-  ::RemyBuffers::_FinTree_default_instance_._instance.get_mutable()->optimizer_ = const_cast< ::RemyBuffers::OptimizationSettings*>(
-      ::RemyBuffers::OptimizationSettings::internal_default_instance());
-  ::RemyBuffers::_FinTree_default_instance_._instance.get_mutable()->configvector_ = const_cast< ::RemyBuffers::ConfigVector*>(
-      ::RemyBuffers::ConfigVector::internal_default_instance());
-}
 class FinTree::_Internal {
  public:
-  using HasBits = decltype(std::declval<FinTree>()._has_bits_);
+  using HasBits = decltype(std::declval<FinTree>()._impl_._has_bits_);
   static const ::RemyBuffers::MemoryRange& domain(const FinTree* msg);
   static void set_has_domain(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
@@ -1090,154 +1030,153 @@ class FinTree::_Internal {
 
 const ::RemyBuffers::MemoryRange&
 FinTree::_Internal::domain(const FinTree* msg) {
-  return *msg->domain_;
+  return *msg->_impl_.domain_;
 }
 const ::RemyBuffers::Fin&
 FinTree::_Internal::leaf(const FinTree* msg) {
-  return *msg->leaf_;
+  return *msg->_impl_.leaf_;
 }
 const ::RemyBuffers::ConfigRange&
 FinTree::_Internal::config(const FinTree* msg) {
-  return *msg->config_;
+  return *msg->_impl_.config_;
 }
 const ::RemyBuffers::OptimizationSettings&
 FinTree::_Internal::optimizer(const FinTree* msg) {
-  return *msg->optimizer_;
+  return *msg->_impl_.optimizer_;
 }
 const ::RemyBuffers::ConfigVector&
 FinTree::_Internal::configvector(const FinTree* msg) {
-  return *msg->configvector_;
+  return *msg->_impl_.configvector_;
 }
-FinTree::FinTree(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  children_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+FinTree::FinTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.FinTree)
 }
 FinTree::FinTree(const FinTree& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_),
-      children_(from.children_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FinTree* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.children_){from._impl_.children_}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.leaf_){nullptr}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.optimizer_){nullptr}
+    , decltype(_impl_.configvector_){nullptr}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_domain()) {
-    domain_ = new ::RemyBuffers::MemoryRange(*from.domain_);
-  } else {
-    domain_ = nullptr;
+    _this->_impl_.domain_ = new ::RemyBuffers::MemoryRange(*from._impl_.domain_);
   }
   if (from._internal_has_leaf()) {
-    leaf_ = new ::RemyBuffers::Fin(*from.leaf_);
-  } else {
-    leaf_ = nullptr;
+    _this->_impl_.leaf_ = new ::RemyBuffers::Fin(*from._impl_.leaf_);
   }
   if (from._internal_has_config()) {
-    config_ = new ::RemyBuffers::ConfigRange(*from.config_);
-  } else {
-    config_ = nullptr;
+    _this->_impl_.config_ = new ::RemyBuffers::ConfigRange(*from._impl_.config_);
   }
   if (from._internal_has_optimizer()) {
-    optimizer_ = new ::RemyBuffers::OptimizationSettings(*from.optimizer_);
-  } else {
-    optimizer_ = nullptr;
+    _this->_impl_.optimizer_ = new ::RemyBuffers::OptimizationSettings(*from._impl_.optimizer_);
   }
   if (from._internal_has_configvector()) {
-    configvector_ = new ::RemyBuffers::ConfigVector(*from.configvector_);
-  } else {
-    configvector_ = nullptr;
+    _this->_impl_.configvector_ = new ::RemyBuffers::ConfigVector(*from._impl_.configvector_);
   }
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.FinTree)
 }
 
-void FinTree::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FinTree_dna_2eproto.base);
-  ::memset(&domain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&configvector_) -
-      reinterpret_cast<char*>(&domain_)) + sizeof(configvector_));
+inline void FinTree::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.children_){arena}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.leaf_){nullptr}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.optimizer_){nullptr}
+    , decltype(_impl_.configvector_){nullptr}
+  };
 }
 
 FinTree::~FinTree() {
   // @@protoc_insertion_point(destructor:RemyBuffers.FinTree)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void FinTree::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete domain_;
-  if (this != internal_default_instance()) delete leaf_;
-  if (this != internal_default_instance()) delete config_;
-  if (this != internal_default_instance()) delete optimizer_;
-  if (this != internal_default_instance()) delete configvector_;
+inline void FinTree::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.children_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.domain_;
+  if (this != internal_default_instance()) delete _impl_.leaf_;
+  if (this != internal_default_instance()) delete _impl_.config_;
+  if (this != internal_default_instance()) delete _impl_.optimizer_;
+  if (this != internal_default_instance()) delete _impl_.configvector_;
 }
 
-void FinTree::ArenaDtor(void* object) {
-  FinTree* _this = reinterpret_cast< FinTree* >(object);
-  (void)_this;
-}
-void FinTree::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void FinTree::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const FinTree& FinTree::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FinTree_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FinTree::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.FinTree)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  children_.Clear();
-  cached_has_bits = _has_bits_[0];
+  _impl_.children_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     if (cached_has_bits & 0x00000001u) {
-      GOOGLE_DCHECK(domain_ != nullptr);
-      domain_->Clear();
+      GOOGLE_DCHECK(_impl_.domain_ != nullptr);
+      _impl_.domain_->Clear();
     }
     if (cached_has_bits & 0x00000002u) {
-      GOOGLE_DCHECK(leaf_ != nullptr);
-      leaf_->Clear();
+      GOOGLE_DCHECK(_impl_.leaf_ != nullptr);
+      _impl_.leaf_->Clear();
     }
     if (cached_has_bits & 0x00000004u) {
-      GOOGLE_DCHECK(config_ != nullptr);
-      config_->Clear();
+      GOOGLE_DCHECK(_impl_.config_ != nullptr);
+      _impl_.config_->Clear();
     }
     if (cached_has_bits & 0x00000008u) {
-      GOOGLE_DCHECK(optimizer_ != nullptr);
-      optimizer_->Clear();
+      GOOGLE_DCHECK(_impl_.optimizer_ != nullptr);
+      _impl_.optimizer_->Clear();
     }
     if (cached_has_bits & 0x00000010u) {
-      GOOGLE_DCHECK(configvector_ != nullptr);
-      configvector_->Clear();
+      GOOGLE_DCHECK(_impl_.configvector_ != nullptr);
+      _impl_.configvector_->Clear();
     }
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* FinTree::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FinTree::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional .RemyBuffers.MemoryRange domain = 90;
       case 90:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 210)) {
           ptr = ctx->ParseMessage(_internal_mutable_domain(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .RemyBuffers.FinTree children = 91;
       case 91:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 218)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 218)) {
           ptr -= 2;
           do {
             ptr += 2;
@@ -1245,116 +1184,117 @@ const char* FinTree::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<730>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Fin leaf = 92;
       case 92:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 226)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 226)) {
           ptr = ctx->ParseMessage(_internal_mutable_leaf(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.ConfigRange config = 93;
       case 93:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 234)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 234)) {
           ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.OptimizationSettings optimizer = 94;
       case 94:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 242)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
           ptr = ctx->ParseMessage(_internal_mutable_optimizer(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.ConfigVector configvector = 95;
       case 95:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 250)) {
           ptr = ctx->ParseMessage(_internal_mutable_configvector(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* FinTree::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* FinTree::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.FinTree)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .RemyBuffers.MemoryRange domain = 90;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        90, _Internal::domain(this), target, stream);
+      InternalWriteMessage(90, _Internal::domain(this),
+        _Internal::domain(this).GetCachedSize(), target, stream);
   }
 
   // repeated .RemyBuffers.FinTree children = 91;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_children_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_children_size()); i < n; i++) {
+    const auto& repfield = this->_internal_children(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(91, this->_internal_children(i), target, stream);
+        InternalWriteMessage(91, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Fin leaf = 92;
   if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        92, _Internal::leaf(this), target, stream);
+      InternalWriteMessage(92, _Internal::leaf(this),
+        _Internal::leaf(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.ConfigRange config = 93;
   if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        93, _Internal::config(this), target, stream);
+      InternalWriteMessage(93, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.OptimizationSettings optimizer = 94;
   if (cached_has_bits & 0x00000008u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        94, _Internal::optimizer(this), target, stream);
+      InternalWriteMessage(94, _Internal::optimizer(this),
+        _Internal::optimizer(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.ConfigVector configvector = 95;
   if (cached_has_bits & 0x00000010u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        95, _Internal::configvector(this), target, stream);
+      InternalWriteMessage(95, _Internal::configvector(this),
+        _Internal::configvector(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.FinTree)
@@ -1365,112 +1305,98 @@ size_t FinTree::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.FinTree)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .RemyBuffers.FinTree children = 91;
   total_size += 2UL * this->_internal_children_size();
-  for (const auto& msg : this->children_) {
+  for (const auto& msg : this->_impl_.children_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     // optional .RemyBuffers.MemoryRange domain = 90;
     if (cached_has_bits & 0x00000001u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *domain_);
+          *_impl_.domain_);
     }
 
     // optional .RemyBuffers.Fin leaf = 92;
     if (cached_has_bits & 0x00000002u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *leaf_);
+          *_impl_.leaf_);
     }
 
     // optional .RemyBuffers.ConfigRange config = 93;
     if (cached_has_bits & 0x00000004u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *config_);
+          *_impl_.config_);
     }
 
     // optional .RemyBuffers.OptimizationSettings optimizer = 94;
     if (cached_has_bits & 0x00000008u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *optimizer_);
+          *_impl_.optimizer_);
     }
 
     // optional .RemyBuffers.ConfigVector configvector = 95;
     if (cached_has_bits & 0x00000010u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *configvector_);
+          *_impl_.configvector_);
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void FinTree::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.FinTree)
-  GOOGLE_DCHECK_NE(&from, this);
-  const FinTree* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FinTree>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.FinTree)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.FinTree)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FinTree::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FinTree::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FinTree::GetClassData() const { return &_class_data_; }
 
-void FinTree::MergeFrom(const FinTree& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.FinTree)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void FinTree::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FinTree*>(&to_msg);
+  auto& from = static_cast<const FinTree&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.FinTree)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  children_.MergeFrom(from.children_);
-  cached_has_bits = from._has_bits_[0];
+  _this->_impl_.children_.MergeFrom(from._impl_.children_);
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(from._internal_domain());
+      _this->_internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(
+          from._internal_domain());
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_mutable_leaf()->::RemyBuffers::Fin::MergeFrom(from._internal_leaf());
+      _this->_internal_mutable_leaf()->::RemyBuffers::Fin::MergeFrom(
+          from._internal_leaf());
     }
     if (cached_has_bits & 0x00000004u) {
-      _internal_mutable_config()->::RemyBuffers::ConfigRange::MergeFrom(from._internal_config());
+      _this->_internal_mutable_config()->::RemyBuffers::ConfigRange::MergeFrom(
+          from._internal_config());
     }
     if (cached_has_bits & 0x00000008u) {
-      _internal_mutable_optimizer()->::RemyBuffers::OptimizationSettings::MergeFrom(from._internal_optimizer());
+      _this->_internal_mutable_optimizer()->::RemyBuffers::OptimizationSettings::MergeFrom(
+          from._internal_optimizer());
     }
     if (cached_has_bits & 0x00000010u) {
-      _internal_mutable_configvector()->::RemyBuffers::ConfigVector::MergeFrom(from._internal_configvector());
+      _this->_internal_mutable_configvector()->::RemyBuffers::ConfigVector::MergeFrom(
+          from._internal_configvector());
     }
   }
-}
-
-void FinTree::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.FinTree)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FinTree::CopyFrom(const FinTree& from) {
@@ -1486,33 +1412,28 @@ bool FinTree::IsInitialized() const {
 
 void FinTree::InternalSwap(FinTree* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  children_.InternalSwap(&other->children_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.children_.InternalSwap(&other->_impl_.children_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(FinTree, configvector_)
-      + sizeof(FinTree::configvector_)
-      - PROTOBUF_FIELD_OFFSET(FinTree, domain_)>(
-          reinterpret_cast<char*>(&domain_),
-          reinterpret_cast<char*>(&other->domain_));
+      PROTOBUF_FIELD_OFFSET(FinTree, _impl_.configvector_)
+      + sizeof(FinTree::_impl_.configvector_)
+      - PROTOBUF_FIELD_OFFSET(FinTree, _impl_.domain_)>(
+          reinterpret_cast<char*>(&_impl_.domain_),
+          reinterpret_cast<char*>(&other->_impl_.domain_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata FinTree::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void MemoryRange::InitAsDefaultInstance() {
-  ::RemyBuffers::_MemoryRange_default_instance_._instance.get_mutable()->lower_ = const_cast< ::RemyBuffers::Memory*>(
-      ::RemyBuffers::Memory::internal_default_instance());
-  ::RemyBuffers::_MemoryRange_default_instance_._instance.get_mutable()->upper_ = const_cast< ::RemyBuffers::Memory*>(
-      ::RemyBuffers::Memory::internal_default_instance());
-}
 class MemoryRange::_Internal {
  public:
-  using HasBits = decltype(std::declval<MemoryRange>()._has_bits_);
+  using HasBits = decltype(std::declval<MemoryRange>()._impl_._has_bits_);
   static const ::RemyBuffers::Memory& lower(const MemoryRange* msg);
   static void set_has_lower(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
@@ -1525,123 +1446,123 @@ class MemoryRange::_Internal {
 
 const ::RemyBuffers::Memory&
 MemoryRange::_Internal::lower(const MemoryRange* msg) {
-  return *msg->lower_;
+  return *msg->_impl_.lower_;
 }
 const ::RemyBuffers::Memory&
 MemoryRange::_Internal::upper(const MemoryRange* msg) {
-  return *msg->upper_;
+  return *msg->_impl_.upper_;
 }
-MemoryRange::MemoryRange(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  active_axis_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+MemoryRange::MemoryRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.MemoryRange)
 }
 MemoryRange::MemoryRange(const MemoryRange& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_),
-      active_axis_(from.active_axis_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MemoryRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.active_axis_){from._impl_.active_axis_}
+    , decltype(_impl_.lower_){nullptr}
+    , decltype(_impl_.upper_){nullptr}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_lower()) {
-    lower_ = new ::RemyBuffers::Memory(*from.lower_);
-  } else {
-    lower_ = nullptr;
+    _this->_impl_.lower_ = new ::RemyBuffers::Memory(*from._impl_.lower_);
   }
   if (from._internal_has_upper()) {
-    upper_ = new ::RemyBuffers::Memory(*from.upper_);
-  } else {
-    upper_ = nullptr;
+    _this->_impl_.upper_ = new ::RemyBuffers::Memory(*from._impl_.upper_);
   }
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.MemoryRange)
 }
 
-void MemoryRange::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_MemoryRange_dna_2eproto.base);
-  ::memset(&lower_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&upper_) -
-      reinterpret_cast<char*>(&lower_)) + sizeof(upper_));
+inline void MemoryRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.active_axis_){arena}
+    , decltype(_impl_.lower_){nullptr}
+    , decltype(_impl_.upper_){nullptr}
+  };
 }
 
 MemoryRange::~MemoryRange() {
   // @@protoc_insertion_point(destructor:RemyBuffers.MemoryRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void MemoryRange::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete lower_;
-  if (this != internal_default_instance()) delete upper_;
+inline void MemoryRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.active_axis_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.lower_;
+  if (this != internal_default_instance()) delete _impl_.upper_;
 }
 
-void MemoryRange::ArenaDtor(void* object) {
-  MemoryRange* _this = reinterpret_cast< MemoryRange* >(object);
-  (void)_this;
-}
-void MemoryRange::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void MemoryRange::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const MemoryRange& MemoryRange::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_MemoryRange_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void MemoryRange::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.MemoryRange)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  active_axis_.Clear();
-  cached_has_bits = _has_bits_[0];
+  _impl_.active_axis_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
-      GOOGLE_DCHECK(lower_ != nullptr);
-      lower_->Clear();
+      GOOGLE_DCHECK(_impl_.lower_ != nullptr);
+      _impl_.lower_->Clear();
     }
     if (cached_has_bits & 0x00000002u) {
-      GOOGLE_DCHECK(upper_ != nullptr);
-      upper_->Clear();
+      GOOGLE_DCHECK(_impl_.upper_ != nullptr);
+      _impl_.upper_->Clear();
     }
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* MemoryRange::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* MemoryRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional .RemyBuffers.Memory lower = 11;
       case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
           ptr = ctx->ParseMessage(_internal_mutable_lower(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Memory upper = 12;
       case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
           ptr = ctx->ParseMessage(_internal_mutable_upper(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .RemyBuffers.MemoryRange.Axis active_axis = 13;
       case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
             CHK_(ptr);
             if (PROTOBUF_PREDICT_TRUE(::RemyBuffers::MemoryRange_Axis_IsValid(val))) {
               _internal_add_active_axis(static_cast<::RemyBuffers::MemoryRange_Axis>(val));
@@ -1650,66 +1571,66 @@ const char* MemoryRange::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
             }
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<104>(ptr));
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106) {
+        } else if (static_cast<uint8_t>(tag) == 106) {
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_active_axis(), ptr, ctx, ::RemyBuffers::MemoryRange_Axis_IsValid, &_internal_metadata_, 13);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* MemoryRange::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* MemoryRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.MemoryRange)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .RemyBuffers.Memory lower = 11;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        11, _Internal::lower(this), target, stream);
+      InternalWriteMessage(11, _Internal::lower(this),
+        _Internal::lower(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Memory upper = 12;
   if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        12, _Internal::upper(this), target, stream);
+      InternalWriteMessage(12, _Internal::upper(this),
+        _Internal::upper(this).GetCachedSize(), target, stream);
   }
 
   // repeated .RemyBuffers.MemoryRange.Axis active_axis = 13;
   for (int i = 0, n = this->_internal_active_axis_size(); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
         13, this->_internal_active_axis(i), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.MemoryRange)
@@ -1720,7 +1641,7 @@ size_t MemoryRange::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.MemoryRange)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1728,77 +1649,60 @@ size_t MemoryRange::ByteSizeLong() const {
   {
     size_t data_size = 0;
     unsigned int count = static_cast<unsigned int>(this->_internal_active_axis_size());for (unsigned int i = 0; i < count; i++) {
-      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+      data_size += ::_pbi::WireFormatLite::EnumSize(
         this->_internal_active_axis(static_cast<int>(i)));
     }
     total_size += (1UL * count) + data_size;
   }
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     // optional .RemyBuffers.Memory lower = 11;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *lower_);
+          *_impl_.lower_);
     }
 
     // optional .RemyBuffers.Memory upper = 12;
     if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *upper_);
+          *_impl_.upper_);
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MemoryRange::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.MemoryRange)
-  GOOGLE_DCHECK_NE(&from, this);
-  const MemoryRange* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<MemoryRange>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.MemoryRange)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.MemoryRange)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MemoryRange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MemoryRange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MemoryRange::GetClassData() const { return &_class_data_; }
 
-void MemoryRange::MergeFrom(const MemoryRange& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.MemoryRange)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void MemoryRange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MemoryRange*>(&to_msg);
+  auto& from = static_cast<const MemoryRange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.MemoryRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  active_axis_.MergeFrom(from.active_axis_);
-  cached_has_bits = from._has_bits_[0];
+  _this->_impl_.active_axis_.MergeFrom(from._impl_.active_axis_);
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_lower()->::RemyBuffers::Memory::MergeFrom(from._internal_lower());
+      _this->_internal_mutable_lower()->::RemyBuffers::Memory::MergeFrom(
+          from._internal_lower());
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_mutable_upper()->::RemyBuffers::Memory::MergeFrom(from._internal_upper());
+      _this->_internal_mutable_upper()->::RemyBuffers::Memory::MergeFrom(
+          from._internal_upper());
     }
   }
-}
-
-void MemoryRange::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.MemoryRange)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MemoryRange::CopyFrom(const MemoryRange& from) {
@@ -1814,29 +1718,28 @@ bool MemoryRange::IsInitialized() const {
 
 void MemoryRange::InternalSwap(MemoryRange* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  active_axis_.InternalSwap(&other->active_axis_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.active_axis_.InternalSwap(&other->_impl_.active_axis_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(MemoryRange, upper_)
-      + sizeof(MemoryRange::upper_)
-      - PROTOBUF_FIELD_OFFSET(MemoryRange, lower_)>(
-          reinterpret_cast<char*>(&lower_),
-          reinterpret_cast<char*>(&other->lower_));
+      PROTOBUF_FIELD_OFFSET(MemoryRange, _impl_.upper_)
+      + sizeof(MemoryRange::_impl_.upper_)
+      - PROTOBUF_FIELD_OFFSET(MemoryRange, _impl_.lower_)>(
+          reinterpret_cast<char*>(&_impl_.lower_),
+          reinterpret_cast<char*>(&other->_impl_.lower_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata MemoryRange::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void Memory::InitAsDefaultInstance() {
-}
 class Memory::_Internal {
  public:
-  using HasBits = decltype(std::declval<Memory>()._has_bits_);
+  using HasBits = decltype(std::declval<Memory>()._impl_._has_bits_);
   static void set_has_rec_send_ewma(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
@@ -1866,237 +1769,263 @@ class Memory::_Internal {
   }
 };
 
-Memory::Memory(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Memory::Memory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.Memory)
 }
 Memory::Memory(const Memory& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Memory* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rec_send_ewma_){}
+    , decltype(_impl_.rec_rec_ewma_){}
+    , decltype(_impl_.rtt_ratio_){}
+    , decltype(_impl_.slow_rec_rec_ewma_){}
+    , decltype(_impl_.rtt_diff_){}
+    , decltype(_impl_.queueing_delay_){}
+    , decltype(_impl_.recent_loss_){}
+    , decltype(_impl_.int_queue_){}
+    , decltype(_impl_.int_link_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&rec_send_ewma_, &from.rec_send_ewma_,
-    static_cast<size_t>(reinterpret_cast<char*>(&int_link_) -
-    reinterpret_cast<char*>(&rec_send_ewma_)) + sizeof(int_link_));
+  ::memcpy(&_impl_.rec_send_ewma_, &from._impl_.rec_send_ewma_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.int_link_) -
+    reinterpret_cast<char*>(&_impl_.rec_send_ewma_)) + sizeof(_impl_.int_link_));
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.Memory)
 }
 
-void Memory::SharedCtor() {
-  ::memset(&rec_send_ewma_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&int_link_) -
-      reinterpret_cast<char*>(&rec_send_ewma_)) + sizeof(int_link_));
+inline void Memory::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rec_send_ewma_){0}
+    , decltype(_impl_.rec_rec_ewma_){0}
+    , decltype(_impl_.rtt_ratio_){0}
+    , decltype(_impl_.slow_rec_rec_ewma_){0}
+    , decltype(_impl_.rtt_diff_){0}
+    , decltype(_impl_.queueing_delay_){0}
+    , decltype(_impl_.recent_loss_){0}
+    , decltype(_impl_.int_queue_){0}
+    , decltype(_impl_.int_link_){0}
+  };
 }
 
 Memory::~Memory() {
   // @@protoc_insertion_point(destructor:RemyBuffers.Memory)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Memory::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Memory::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Memory::ArenaDtor(void* object) {
-  Memory* _this = reinterpret_cast< Memory* >(object);
-  (void)_this;
-}
-void Memory::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Memory::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Memory& Memory::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Memory_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Memory::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.Memory)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
-    ::memset(&rec_send_ewma_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&int_queue_) -
-        reinterpret_cast<char*>(&rec_send_ewma_)) + sizeof(int_queue_));
+    ::memset(&_impl_.rec_send_ewma_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.int_queue_) -
+        reinterpret_cast<char*>(&_impl_.rec_send_ewma_)) + sizeof(_impl_.int_queue_));
   }
-  int_link_ = 0;
-  _has_bits_.Clear();
+  _impl_.int_link_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Memory::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Memory::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional double rec_send_ewma = 21;
       case 21:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 169)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 169)) {
           _Internal::set_has_rec_send_ewma(&has_bits);
-          rec_send_ewma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.rec_send_ewma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double rec_rec_ewma = 22;
       case 22:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 177)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 177)) {
           _Internal::set_has_rec_rec_ewma(&has_bits);
-          rec_rec_ewma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.rec_rec_ewma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double rtt_ratio = 23;
       case 23:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 185)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 185)) {
           _Internal::set_has_rtt_ratio(&has_bits);
-          rtt_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.rtt_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double slow_rec_rec_ewma = 24;
       case 24:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 193)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 193)) {
           _Internal::set_has_slow_rec_rec_ewma(&has_bits);
-          slow_rec_rec_ewma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.slow_rec_rec_ewma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double rtt_diff = 25;
       case 25:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 201)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 201)) {
           _Internal::set_has_rtt_diff(&has_bits);
-          rtt_diff_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.rtt_diff_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double queueing_delay = 26;
       case 26:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 209)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 209)) {
           _Internal::set_has_queueing_delay(&has_bits);
-          queueing_delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.queueing_delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double recent_loss = 27;
       case 27:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 217)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 217)) {
           _Internal::set_has_recent_loss(&has_bits);
-          recent_loss_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.recent_loss_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double int_queue = 28;
       case 28:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 225)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 225)) {
           _Internal::set_has_int_queue(&has_bits);
-          int_queue_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.int_queue_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double int_link = 29;
       case 29:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 233)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 233)) {
           _Internal::set_has_int_link(&has_bits);
-          int_link_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.int_link_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Memory::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Memory::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.Memory)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional double rec_send_ewma = 21;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(21, this->_internal_rec_send_ewma(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(21, this->_internal_rec_send_ewma(), target);
   }
 
   // optional double rec_rec_ewma = 22;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(22, this->_internal_rec_rec_ewma(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(22, this->_internal_rec_rec_ewma(), target);
   }
 
   // optional double rtt_ratio = 23;
   if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(23, this->_internal_rtt_ratio(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(23, this->_internal_rtt_ratio(), target);
   }
 
   // optional double slow_rec_rec_ewma = 24;
   if (cached_has_bits & 0x00000008u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(24, this->_internal_slow_rec_rec_ewma(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(24, this->_internal_slow_rec_rec_ewma(), target);
   }
 
   // optional double rtt_diff = 25;
   if (cached_has_bits & 0x00000010u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(25, this->_internal_rtt_diff(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(25, this->_internal_rtt_diff(), target);
   }
 
   // optional double queueing_delay = 26;
   if (cached_has_bits & 0x00000020u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(26, this->_internal_queueing_delay(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(26, this->_internal_queueing_delay(), target);
   }
 
   // optional double recent_loss = 27;
   if (cached_has_bits & 0x00000040u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(27, this->_internal_recent_loss(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(27, this->_internal_recent_loss(), target);
   }
 
   // optional double int_queue = 28;
   if (cached_has_bits & 0x00000080u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(28, this->_internal_int_queue(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(28, this->_internal_int_queue(), target);
   }
 
   // optional double int_link = 29;
   if (cached_has_bits & 0x00000100u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(29, this->_internal_int_link(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(29, this->_internal_int_link(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.Memory)
@@ -2107,11 +2036,11 @@ size_t Memory::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.Memory)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     // optional double rec_send_ewma = 21;
     if (cached_has_bits & 0x00000001u) {
@@ -2159,75 +2088,56 @@ size_t Memory::ByteSizeLong() const {
     total_size += 2 + 8;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Memory::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.Memory)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Memory* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Memory>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.Memory)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.Memory)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Memory::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Memory::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Memory::GetClassData() const { return &_class_data_; }
 
-void Memory::MergeFrom(const Memory& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Memory)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Memory::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Memory*>(&to_msg);
+  auto& from = static_cast<const Memory&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Memory)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
-      rec_send_ewma_ = from.rec_send_ewma_;
+      _this->_impl_.rec_send_ewma_ = from._impl_.rec_send_ewma_;
     }
     if (cached_has_bits & 0x00000002u) {
-      rec_rec_ewma_ = from.rec_rec_ewma_;
+      _this->_impl_.rec_rec_ewma_ = from._impl_.rec_rec_ewma_;
     }
     if (cached_has_bits & 0x00000004u) {
-      rtt_ratio_ = from.rtt_ratio_;
+      _this->_impl_.rtt_ratio_ = from._impl_.rtt_ratio_;
     }
     if (cached_has_bits & 0x00000008u) {
-      slow_rec_rec_ewma_ = from.slow_rec_rec_ewma_;
+      _this->_impl_.slow_rec_rec_ewma_ = from._impl_.slow_rec_rec_ewma_;
     }
     if (cached_has_bits & 0x00000010u) {
-      rtt_diff_ = from.rtt_diff_;
+      _this->_impl_.rtt_diff_ = from._impl_.rtt_diff_;
     }
     if (cached_has_bits & 0x00000020u) {
-      queueing_delay_ = from.queueing_delay_;
+      _this->_impl_.queueing_delay_ = from._impl_.queueing_delay_;
     }
     if (cached_has_bits & 0x00000040u) {
-      recent_loss_ = from.recent_loss_;
+      _this->_impl_.recent_loss_ = from._impl_.recent_loss_;
     }
     if (cached_has_bits & 0x00000080u) {
-      int_queue_ = from.int_queue_;
+      _this->_impl_.int_queue_ = from._impl_.int_queue_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   if (cached_has_bits & 0x00000100u) {
-    _internal_set_int_link(from._internal_int_link());
+    _this->_internal_set_int_link(from._internal_int_link());
   }
-}
-
-void Memory::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.Memory)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Memory::CopyFrom(const Memory& from) {
@@ -2243,38 +2153,35 @@ bool Memory::IsInitialized() const {
 
 void Memory::InternalSwap(Memory* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Memory, int_link_)
-      + sizeof(Memory::int_link_)
-      - PROTOBUF_FIELD_OFFSET(Memory, rec_send_ewma_)>(
-          reinterpret_cast<char*>(&rec_send_ewma_),
-          reinterpret_cast<char*>(&other->rec_send_ewma_));
+      PROTOBUF_FIELD_OFFSET(Memory, _impl_.int_link_)
+      + sizeof(Memory::_impl_.int_link_)
+      - PROTOBUF_FIELD_OFFSET(Memory, _impl_.rec_send_ewma_)>(
+          reinterpret_cast<char*>(&_impl_.rec_send_ewma_),
+          reinterpret_cast<char*>(&other->_impl_.rec_send_ewma_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Memory::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void Whisker::InitAsDefaultInstance() {
-  ::RemyBuffers::_Whisker_default_instance_._instance.get_mutable()->domain_ = const_cast< ::RemyBuffers::MemoryRange*>(
-      ::RemyBuffers::MemoryRange::internal_default_instance());
-}
 class Whisker::_Internal {
  public:
-  using HasBits = decltype(std::declval<Whisker>()._has_bits_);
+  using HasBits = decltype(std::declval<Whisker>()._impl_._has_bits_);
   static void set_has_window_increment(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
+    (*has_bits)[0] |= 8u;
   }
   static void set_has_window_multiple(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
+    (*has_bits)[0] |= 2u;
   }
   static void set_has_intersend(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
+    (*has_bits)[0] |= 4u;
   }
   static const ::RemyBuffers::MemoryRange& domain(const Whisker* msg);
   static void set_has_domain(HasBits* has_bits) {
@@ -2284,180 +2191,187 @@ class Whisker::_Internal {
 
 const ::RemyBuffers::MemoryRange&
 Whisker::_Internal::domain(const Whisker* msg) {
-  return *msg->domain_;
+  return *msg->_impl_.domain_;
 }
-Whisker::Whisker(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Whisker::Whisker(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.Whisker)
 }
 Whisker::Whisker(const Whisker& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Whisker* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.window_multiple_){}
+    , decltype(_impl_.intersend_){}
+    , decltype(_impl_.window_increment_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_domain()) {
-    domain_ = new ::RemyBuffers::MemoryRange(*from.domain_);
-  } else {
-    domain_ = nullptr;
+    _this->_impl_.domain_ = new ::RemyBuffers::MemoryRange(*from._impl_.domain_);
   }
-  ::memcpy(&window_increment_, &from.window_increment_,
-    static_cast<size_t>(reinterpret_cast<char*>(&intersend_) -
-    reinterpret_cast<char*>(&window_increment_)) + sizeof(intersend_));
+  ::memcpy(&_impl_.window_multiple_, &from._impl_.window_multiple_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.window_increment_) -
+    reinterpret_cast<char*>(&_impl_.window_multiple_)) + sizeof(_impl_.window_increment_));
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.Whisker)
 }
 
-void Whisker::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Whisker_dna_2eproto.base);
-  ::memset(&domain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&intersend_) -
-      reinterpret_cast<char*>(&domain_)) + sizeof(intersend_));
+inline void Whisker::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.window_multiple_){0}
+    , decltype(_impl_.intersend_){0}
+    , decltype(_impl_.window_increment_){0}
+  };
 }
 
 Whisker::~Whisker() {
   // @@protoc_insertion_point(destructor:RemyBuffers.Whisker)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Whisker::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete domain_;
+inline void Whisker::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.domain_;
 }
 
-void Whisker::ArenaDtor(void* object) {
-  Whisker* _this = reinterpret_cast< Whisker* >(object);
-  (void)_this;
-}
-void Whisker::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Whisker::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Whisker& Whisker::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Whisker_dna_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Whisker::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.Whisker)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    GOOGLE_DCHECK(domain_ != nullptr);
-    domain_->Clear();
+    GOOGLE_DCHECK(_impl_.domain_ != nullptr);
+    _impl_.domain_->Clear();
   }
   if (cached_has_bits & 0x0000000eu) {
-    ::memset(&window_increment_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&intersend_) -
-        reinterpret_cast<char*>(&window_increment_)) + sizeof(intersend_));
+    ::memset(&_impl_.window_multiple_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.window_increment_) -
+        reinterpret_cast<char*>(&_impl_.window_multiple_)) + sizeof(_impl_.window_increment_));
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Whisker::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Whisker::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional sint32 window_increment = 31;
       case 31:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 248)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 248)) {
           _Internal::set_has_window_increment(&has_bits);
-          window_increment_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          _impl_.window_increment_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double window_multiple = 32;
       case 32:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 1)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 1)) {
           _Internal::set_has_window_multiple(&has_bits);
-          window_multiple_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.window_multiple_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double intersend = 33;
       case 33:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
           _Internal::set_has_intersend(&has_bits);
-          intersend_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.intersend_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.MemoryRange domain = 34;
       case 34:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_domain(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Whisker::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Whisker::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.Whisker)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional sint32 window_increment = 31;
-  if (cached_has_bits & 0x00000002u) {
+  if (cached_has_bits & 0x00000008u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32ToArray(31, this->_internal_window_increment(), target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(31, this->_internal_window_increment(), target);
   }
 
   // optional double window_multiple = 32;
-  if (cached_has_bits & 0x00000004u) {
+  if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(32, this->_internal_window_multiple(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(32, this->_internal_window_multiple(), target);
   }
 
   // optional double intersend = 33;
-  if (cached_has_bits & 0x00000008u) {
+  if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(33, this->_internal_intersend(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(33, this->_internal_intersend(), target);
   }
 
   // optional .RemyBuffers.MemoryRange domain = 34;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        34, _Internal::domain(this), target, stream);
+      InternalWriteMessage(34, _Internal::domain(this),
+        _Internal::domain(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.Whisker)
@@ -2468,91 +2382,73 @@ size_t Whisker::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.Whisker)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
     // optional .RemyBuffers.MemoryRange domain = 34;
     if (cached_has_bits & 0x00000001u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *domain_);
+          *_impl_.domain_);
     }
 
-    // optional sint32 window_increment = 31;
+    // optional double window_multiple = 32;
     if (cached_has_bits & 0x00000002u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt32Size(
-          this->_internal_window_increment());
+      total_size += 2 + 8;
     }
 
-    // optional double window_multiple = 32;
+    // optional double intersend = 33;
     if (cached_has_bits & 0x00000004u) {
       total_size += 2 + 8;
     }
 
-    // optional double intersend = 33;
+    // optional sint32 window_increment = 31;
     if (cached_has_bits & 0x00000008u) {
-      total_size += 2 + 8;
+      total_size += 2 +
+        ::_pbi::WireFormatLite::SInt32Size(
+          this->_internal_window_increment());
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Whisker::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.Whisker)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Whisker* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Whisker>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.Whisker)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.Whisker)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Whisker::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Whisker::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Whisker::GetClassData() const { return &_class_data_; }
 
-void Whisker::MergeFrom(const Whisker& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Whisker)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Whisker::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Whisker*>(&to_msg);
+  auto& from = static_cast<const Whisker&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Whisker)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(from._internal_domain());
+      _this->_internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(
+          from._internal_domain());
     }
     if (cached_has_bits & 0x00000002u) {
-      window_increment_ = from.window_increment_;
+      _this->_impl_.window_multiple_ = from._impl_.window_multiple_;
     }
     if (cached_has_bits & 0x00000004u) {
-      window_multiple_ = from.window_multiple_;
+      _this->_impl_.intersend_ = from._impl_.intersend_;
     }
     if (cached_has_bits & 0x00000008u) {
-      intersend_ = from.intersend_;
+      _this->_impl_.window_increment_ = from._impl_.window_increment_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void Whisker::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.Whisker)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Whisker::CopyFrom(const Whisker& from) {
@@ -2568,30 +2464,27 @@ bool Whisker::IsInitialized() const {
 
 void Whisker::InternalSwap(Whisker* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Whisker, intersend_)
-      + sizeof(Whisker::intersend_)
-      - PROTOBUF_FIELD_OFFSET(Whisker, domain_)>(
-          reinterpret_cast<char*>(&domain_),
-          reinterpret_cast<char*>(&other->domain_));
+      PROTOBUF_FIELD_OFFSET(Whisker, _impl_.window_increment_)
+      + sizeof(Whisker::_impl_.window_increment_)
+      - PROTOBUF_FIELD_OFFSET(Whisker, _impl_.domain_)>(
+          reinterpret_cast<char*>(&_impl_.domain_),
+          reinterpret_cast<char*>(&other->_impl_.domain_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Whisker::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void Fin::InitAsDefaultInstance() {
-  ::RemyBuffers::_Fin_default_instance_._instance.get_mutable()->domain_ = const_cast< ::RemyBuffers::MemoryRange*>(
-      ::RemyBuffers::MemoryRange::internal_default_instance());
-}
 class Fin::_Internal {
  public:
-  using HasBits = decltype(std::declval<Fin>()._has_bits_);
+  using HasBits = decltype(std::declval<Fin>()._impl_._has_bits_);
   static void set_has_lambda(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
@@ -2603,146 +2496,147 @@ class Fin::_Internal {
 
 const ::RemyBuffers::MemoryRange&
 Fin::_Internal::domain(const Fin* msg) {
-  return *msg->domain_;
+  return *msg->_impl_.domain_;
 }
-Fin::Fin(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Fin::Fin(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.Fin)
 }
 Fin::Fin(const Fin& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Fin* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.lambda_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_domain()) {
-    domain_ = new ::RemyBuffers::MemoryRange(*from.domain_);
-  } else {
-    domain_ = nullptr;
+    _this->_impl_.domain_ = new ::RemyBuffers::MemoryRange(*from._impl_.domain_);
   }
-  lambda_ = from.lambda_;
+  _this->_impl_.lambda_ = from._impl_.lambda_;
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.Fin)
 }
 
-void Fin::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Fin_dna_2eproto.base);
-  ::memset(&domain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lambda_) -
-      reinterpret_cast<char*>(&domain_)) + sizeof(lambda_));
+inline void Fin::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.domain_){nullptr}
+    , decltype(_impl_.lambda_){0}
+  };
 }
 
 Fin::~Fin() {
   // @@protoc_insertion_point(destructor:RemyBuffers.Fin)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Fin::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete domain_;
+inline void Fin::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.domain_;
 }
 
-void Fin::ArenaDtor(void* object) {
-  Fin* _this = reinterpret_cast< Fin* >(object);
-  (void)_this;
-}
-void Fin::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Fin::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Fin& Fin::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Fin_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Fin::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.Fin)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    GOOGLE_DCHECK(domain_ != nullptr);
-    domain_->Clear();
+    GOOGLE_DCHECK(_impl_.domain_ != nullptr);
+    _impl_.domain_->Clear();
   }
-  lambda_ = 0;
-  _has_bits_.Clear();
+  _impl_.lambda_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Fin::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Fin::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional double lambda = 37;
       case 37:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 41)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
           _Internal::set_has_lambda(&has_bits);
-          lambda_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.lambda_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.MemoryRange domain = 38;
       case 38:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_domain(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Fin::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Fin::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.Fin)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional double lambda = 37;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(37, this->_internal_lambda(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(37, this->_internal_lambda(), target);
   }
 
   // optional .RemyBuffers.MemoryRange domain = 38;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        38, _Internal::domain(this), target, stream);
+      InternalWriteMessage(38, _Internal::domain(this),
+        _Internal::domain(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.Fin)
@@ -2753,17 +2647,17 @@ size_t Fin::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.Fin)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     // optional .RemyBuffers.MemoryRange domain = 38;
     if (cached_has_bits & 0x00000001u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *domain_);
+          *_impl_.domain_);
     }
 
     // optional double lambda = 37;
@@ -2772,54 +2666,36 @@ size_t Fin::ByteSizeLong() const {
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Fin::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.Fin)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Fin* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Fin>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.Fin)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.Fin)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Fin::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Fin::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Fin::GetClassData() const { return &_class_data_; }
 
-void Fin::MergeFrom(const Fin& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Fin)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Fin::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Fin*>(&to_msg);
+  auto& from = static_cast<const Fin&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Fin)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(from._internal_domain());
+      _this->_internal_mutable_domain()->::RemyBuffers::MemoryRange::MergeFrom(
+          from._internal_domain());
     }
     if (cached_has_bits & 0x00000002u) {
-      lambda_ = from.lambda_;
+      _this->_impl_.lambda_ = from._impl_.lambda_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void Fin::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.Fin)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Fin::CopyFrom(const Fin& from) {
@@ -2835,28 +2711,27 @@ bool Fin::IsInitialized() const {
 
 void Fin::InternalSwap(Fin* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Fin, lambda_)
-      + sizeof(Fin::lambda_)
-      - PROTOBUF_FIELD_OFFSET(Fin, domain_)>(
-          reinterpret_cast<char*>(&domain_),
-          reinterpret_cast<char*>(&other->domain_));
+      PROTOBUF_FIELD_OFFSET(Fin, _impl_.lambda_)
+      + sizeof(Fin::_impl_.lambda_)
+      - PROTOBUF_FIELD_OFFSET(Fin, _impl_.domain_)>(
+          reinterpret_cast<char*>(&_impl_.domain_),
+          reinterpret_cast<char*>(&other->_impl_.domain_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Fin::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void OptimizationSetting::InitAsDefaultInstance() {
-}
 class OptimizationSetting::_Internal {
  public:
-  using HasBits = decltype(std::declval<OptimizationSetting>()._has_bits_);
+  using HasBits = decltype(std::declval<OptimizationSetting>()._impl_._has_bits_);
   static void set_has_min_value(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
@@ -2877,194 +2752,211 @@ class OptimizationSetting::_Internal {
   }
 };
 
-OptimizationSetting::OptimizationSetting(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+OptimizationSetting::OptimizationSetting(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.OptimizationSetting)
 }
 OptimizationSetting::OptimizationSetting(const OptimizationSetting& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OptimizationSetting* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_value_){}
+    , decltype(_impl_.max_value_){}
+    , decltype(_impl_.min_change_){}
+    , decltype(_impl_.max_change_){}
+    , decltype(_impl_.multiplier_){}
+    , decltype(_impl_.default_value_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&min_value_, &from.min_value_,
-    static_cast<size_t>(reinterpret_cast<char*>(&default_value_) -
-    reinterpret_cast<char*>(&min_value_)) + sizeof(default_value_));
+  ::memcpy(&_impl_.min_value_, &from._impl_.min_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.default_value_) -
+    reinterpret_cast<char*>(&_impl_.min_value_)) + sizeof(_impl_.default_value_));
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.OptimizationSetting)
 }
 
-void OptimizationSetting::SharedCtor() {
-  ::memset(&min_value_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&default_value_) -
-      reinterpret_cast<char*>(&min_value_)) + sizeof(default_value_));
+inline void OptimizationSetting::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_value_){0}
+    , decltype(_impl_.max_value_){0}
+    , decltype(_impl_.min_change_){0}
+    , decltype(_impl_.max_change_){0}
+    , decltype(_impl_.multiplier_){0}
+    , decltype(_impl_.default_value_){0}
+  };
 }
 
 OptimizationSetting::~OptimizationSetting() {
   // @@protoc_insertion_point(destructor:RemyBuffers.OptimizationSetting)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void OptimizationSetting::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void OptimizationSetting::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void OptimizationSetting::ArenaDtor(void* object) {
-  OptimizationSetting* _this = reinterpret_cast< OptimizationSetting* >(object);
-  (void)_this;
-}
-void OptimizationSetting::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void OptimizationSetting::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const OptimizationSetting& OptimizationSetting::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_OptimizationSetting_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void OptimizationSetting::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.OptimizationSetting)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000003fu) {
-    ::memset(&min_value_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&default_value_) -
-        reinterpret_cast<char*>(&min_value_)) + sizeof(default_value_));
+    ::memset(&_impl_.min_value_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.default_value_) -
+        reinterpret_cast<char*>(&_impl_.min_value_)) + sizeof(_impl_.default_value_));
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* OptimizationSetting::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* OptimizationSetting::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional double min_value = 41;
       case 41:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 73)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
           _Internal::set_has_min_value(&has_bits);
-          min_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.min_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double max_value = 42;
       case 42:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 81)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
           _Internal::set_has_max_value(&has_bits);
-          max_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.max_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double min_change = 43;
       case 43:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 89)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
           _Internal::set_has_min_change(&has_bits);
-          min_change_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.min_change_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double max_change = 44;
       case 44:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 97)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
           _Internal::set_has_max_change(&has_bits);
-          max_change_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.max_change_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double multiplier = 45;
       case 45:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 105)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
           _Internal::set_has_multiplier(&has_bits);
-          multiplier_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.multiplier_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double default_value = 46;
       case 46:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 113)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
           _Internal::set_has_default_value(&has_bits);
-          default_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.default_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* OptimizationSetting::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* OptimizationSetting::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.OptimizationSetting)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional double min_value = 41;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(41, this->_internal_min_value(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(41, this->_internal_min_value(), target);
   }
 
   // optional double max_value = 42;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(42, this->_internal_max_value(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(42, this->_internal_max_value(), target);
   }
 
   // optional double min_change = 43;
   if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(43, this->_internal_min_change(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(43, this->_internal_min_change(), target);
   }
 
   // optional double max_change = 44;
   if (cached_has_bits & 0x00000008u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(44, this->_internal_max_change(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(44, this->_internal_max_change(), target);
   }
 
   // optional double multiplier = 45;
   if (cached_has_bits & 0x00000010u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(45, this->_internal_multiplier(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(45, this->_internal_multiplier(), target);
   }
 
   // optional double default_value = 46;
   if (cached_has_bits & 0x00000020u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(46, this->_internal_default_value(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(46, this->_internal_default_value(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.OptimizationSetting)
@@ -3075,11 +2967,11 @@ size_t OptimizationSetting::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.OptimizationSetting)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000003fu) {
     // optional double min_value = 41;
     if (cached_has_bits & 0x00000001u) {
@@ -3112,66 +3004,47 @@ size_t OptimizationSetting::ByteSizeLong() const {
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void OptimizationSetting::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.OptimizationSetting)
-  GOOGLE_DCHECK_NE(&from, this);
-  const OptimizationSetting* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<OptimizationSetting>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.OptimizationSetting)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.OptimizationSetting)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OptimizationSetting::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OptimizationSetting::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OptimizationSetting::GetClassData() const { return &_class_data_; }
 
-void OptimizationSetting::MergeFrom(const OptimizationSetting& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.OptimizationSetting)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void OptimizationSetting::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OptimizationSetting*>(&to_msg);
+  auto& from = static_cast<const OptimizationSetting&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.OptimizationSetting)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x0000003fu) {
     if (cached_has_bits & 0x00000001u) {
-      min_value_ = from.min_value_;
+      _this->_impl_.min_value_ = from._impl_.min_value_;
     }
     if (cached_has_bits & 0x00000002u) {
-      max_value_ = from.max_value_;
+      _this->_impl_.max_value_ = from._impl_.max_value_;
     }
     if (cached_has_bits & 0x00000004u) {
-      min_change_ = from.min_change_;
+      _this->_impl_.min_change_ = from._impl_.min_change_;
     }
     if (cached_has_bits & 0x00000008u) {
-      max_change_ = from.max_change_;
+      _this->_impl_.max_change_ = from._impl_.max_change_;
     }
     if (cached_has_bits & 0x00000010u) {
-      multiplier_ = from.multiplier_;
+      _this->_impl_.multiplier_ = from._impl_.multiplier_;
     }
     if (cached_has_bits & 0x00000020u) {
-      default_value_ = from.default_value_;
+      _this->_impl_.default_value_ = from._impl_.default_value_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void OptimizationSetting::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.OptimizationSetting)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void OptimizationSetting::CopyFrom(const OptimizationSetting& from) {
@@ -3187,36 +3060,27 @@ bool OptimizationSetting::IsInitialized() const {
 
 void OptimizationSetting::InternalSwap(OptimizationSetting* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(OptimizationSetting, default_value_)
-      + sizeof(OptimizationSetting::default_value_)
-      - PROTOBUF_FIELD_OFFSET(OptimizationSetting, min_value_)>(
-          reinterpret_cast<char*>(&min_value_),
-          reinterpret_cast<char*>(&other->min_value_));
+      PROTOBUF_FIELD_OFFSET(OptimizationSetting, _impl_.default_value_)
+      + sizeof(OptimizationSetting::_impl_.default_value_)
+      - PROTOBUF_FIELD_OFFSET(OptimizationSetting, _impl_.min_value_)>(
+          reinterpret_cast<char*>(&_impl_.min_value_),
+          reinterpret_cast<char*>(&other->_impl_.min_value_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata OptimizationSetting::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void OptimizationSettings::InitAsDefaultInstance() {
-  ::RemyBuffers::_OptimizationSettings_default_instance_._instance.get_mutable()->window_increment_ = const_cast< ::RemyBuffers::OptimizationSetting*>(
-      ::RemyBuffers::OptimizationSetting::internal_default_instance());
-  ::RemyBuffers::_OptimizationSettings_default_instance_._instance.get_mutable()->window_multiple_ = const_cast< ::RemyBuffers::OptimizationSetting*>(
-      ::RemyBuffers::OptimizationSetting::internal_default_instance());
-  ::RemyBuffers::_OptimizationSettings_default_instance_._instance.get_mutable()->intersend_ = const_cast< ::RemyBuffers::OptimizationSetting*>(
-      ::RemyBuffers::OptimizationSetting::internal_default_instance());
-  ::RemyBuffers::_OptimizationSettings_default_instance_._instance.get_mutable()->lambda_ = const_cast< ::RemyBuffers::OptimizationSetting*>(
-      ::RemyBuffers::OptimizationSetting::internal_default_instance());
-}
 class OptimizationSettings::_Internal {
  public:
-  using HasBits = decltype(std::declval<OptimizationSettings>()._has_bits_);
+  using HasBits = decltype(std::declval<OptimizationSettings>()._impl_._has_bits_);
   static const ::RemyBuffers::OptimizationSetting& window_increment(const OptimizationSettings* msg);
   static void set_has_window_increment(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
@@ -3237,219 +3101,217 @@ class OptimizationSettings::_Internal {
 
 const ::RemyBuffers::OptimizationSetting&
 OptimizationSettings::_Internal::window_increment(const OptimizationSettings* msg) {
-  return *msg->window_increment_;
+  return *msg->_impl_.window_increment_;
 }
 const ::RemyBuffers::OptimizationSetting&
 OptimizationSettings::_Internal::window_multiple(const OptimizationSettings* msg) {
-  return *msg->window_multiple_;
+  return *msg->_impl_.window_multiple_;
 }
 const ::RemyBuffers::OptimizationSetting&
 OptimizationSettings::_Internal::intersend(const OptimizationSettings* msg) {
-  return *msg->intersend_;
+  return *msg->_impl_.intersend_;
 }
 const ::RemyBuffers::OptimizationSetting&
 OptimizationSettings::_Internal::lambda(const OptimizationSettings* msg) {
-  return *msg->lambda_;
+  return *msg->_impl_.lambda_;
 }
-OptimizationSettings::OptimizationSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+OptimizationSettings::OptimizationSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.OptimizationSettings)
 }
 OptimizationSettings::OptimizationSettings(const OptimizationSettings& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OptimizationSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.window_increment_){nullptr}
+    , decltype(_impl_.window_multiple_){nullptr}
+    , decltype(_impl_.intersend_){nullptr}
+    , decltype(_impl_.lambda_){nullptr}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_window_increment()) {
-    window_increment_ = new ::RemyBuffers::OptimizationSetting(*from.window_increment_);
-  } else {
-    window_increment_ = nullptr;
+    _this->_impl_.window_increment_ = new ::RemyBuffers::OptimizationSetting(*from._impl_.window_increment_);
   }
   if (from._internal_has_window_multiple()) {
-    window_multiple_ = new ::RemyBuffers::OptimizationSetting(*from.window_multiple_);
-  } else {
-    window_multiple_ = nullptr;
+    _this->_impl_.window_multiple_ = new ::RemyBuffers::OptimizationSetting(*from._impl_.window_multiple_);
   }
   if (from._internal_has_intersend()) {
-    intersend_ = new ::RemyBuffers::OptimizationSetting(*from.intersend_);
-  } else {
-    intersend_ = nullptr;
+    _this->_impl_.intersend_ = new ::RemyBuffers::OptimizationSetting(*from._impl_.intersend_);
   }
   if (from._internal_has_lambda()) {
-    lambda_ = new ::RemyBuffers::OptimizationSetting(*from.lambda_);
-  } else {
-    lambda_ = nullptr;
+    _this->_impl_.lambda_ = new ::RemyBuffers::OptimizationSetting(*from._impl_.lambda_);
   }
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.OptimizationSettings)
 }
 
-void OptimizationSettings::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_OptimizationSettings_dna_2eproto.base);
-  ::memset(&window_increment_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lambda_) -
-      reinterpret_cast<char*>(&window_increment_)) + sizeof(lambda_));
+inline void OptimizationSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.window_increment_){nullptr}
+    , decltype(_impl_.window_multiple_){nullptr}
+    , decltype(_impl_.intersend_){nullptr}
+    , decltype(_impl_.lambda_){nullptr}
+  };
 }
 
 OptimizationSettings::~OptimizationSettings() {
   // @@protoc_insertion_point(destructor:RemyBuffers.OptimizationSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void OptimizationSettings::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete window_increment_;
-  if (this != internal_default_instance()) delete window_multiple_;
-  if (this != internal_default_instance()) delete intersend_;
-  if (this != internal_default_instance()) delete lambda_;
+inline void OptimizationSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.window_increment_;
+  if (this != internal_default_instance()) delete _impl_.window_multiple_;
+  if (this != internal_default_instance()) delete _impl_.intersend_;
+  if (this != internal_default_instance()) delete _impl_.lambda_;
 }
 
-void OptimizationSettings::ArenaDtor(void* object) {
-  OptimizationSettings* _this = reinterpret_cast< OptimizationSettings* >(object);
-  (void)_this;
-}
-void OptimizationSettings::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void OptimizationSettings::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const OptimizationSettings& OptimizationSettings::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_OptimizationSettings_dna_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void OptimizationSettings::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.OptimizationSettings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
-      GOOGLE_DCHECK(window_increment_ != nullptr);
-      window_increment_->Clear();
+      GOOGLE_DCHECK(_impl_.window_increment_ != nullptr);
+      _impl_.window_increment_->Clear();
     }
     if (cached_has_bits & 0x00000002u) {
-      GOOGLE_DCHECK(window_multiple_ != nullptr);
-      window_multiple_->Clear();
+      GOOGLE_DCHECK(_impl_.window_multiple_ != nullptr);
+      _impl_.window_multiple_->Clear();
     }
     if (cached_has_bits & 0x00000004u) {
-      GOOGLE_DCHECK(intersend_ != nullptr);
-      intersend_->Clear();
+      GOOGLE_DCHECK(_impl_.intersend_ != nullptr);
+      _impl_.intersend_->Clear();
     }
     if (cached_has_bits & 0x00000008u) {
-      GOOGLE_DCHECK(lambda_ != nullptr);
-      lambda_->Clear();
+      GOOGLE_DCHECK(_impl_.lambda_ != nullptr);
+      _impl_.lambda_->Clear();
     }
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* OptimizationSettings::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* OptimizationSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional .RemyBuffers.OptimizationSetting window_increment = 51;
       case 51:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
           ptr = ctx->ParseMessage(_internal_mutable_window_increment(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.OptimizationSetting window_multiple = 52;
       case 52:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 162)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
           ptr = ctx->ParseMessage(_internal_mutable_window_multiple(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.OptimizationSetting intersend = 53;
       case 53:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
           ptr = ctx->ParseMessage(_internal_mutable_intersend(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.OptimizationSetting lambda = 54;
       case 54:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 178)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
           ptr = ctx->ParseMessage(_internal_mutable_lambda(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* OptimizationSettings::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* OptimizationSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.OptimizationSettings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .RemyBuffers.OptimizationSetting window_increment = 51;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        51, _Internal::window_increment(this), target, stream);
+      InternalWriteMessage(51, _Internal::window_increment(this),
+        _Internal::window_increment(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.OptimizationSetting window_multiple = 52;
   if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        52, _Internal::window_multiple(this), target, stream);
+      InternalWriteMessage(52, _Internal::window_multiple(this),
+        _Internal::window_multiple(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.OptimizationSetting intersend = 53;
   if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        53, _Internal::intersend(this), target, stream);
+      InternalWriteMessage(53, _Internal::intersend(this),
+        _Internal::intersend(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.OptimizationSetting lambda = 54;
   if (cached_has_bits & 0x00000008u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        54, _Internal::lambda(this), target, stream);
+      InternalWriteMessage(54, _Internal::lambda(this),
+        _Internal::lambda(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.OptimizationSettings)
@@ -3460,94 +3322,79 @@ size_t OptimizationSettings::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.OptimizationSettings)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
     // optional .RemyBuffers.OptimizationSetting window_increment = 51;
     if (cached_has_bits & 0x00000001u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *window_increment_);
+          *_impl_.window_increment_);
     }
 
     // optional .RemyBuffers.OptimizationSetting window_multiple = 52;
     if (cached_has_bits & 0x00000002u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *window_multiple_);
+          *_impl_.window_multiple_);
     }
 
     // optional .RemyBuffers.OptimizationSetting intersend = 53;
     if (cached_has_bits & 0x00000004u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *intersend_);
+          *_impl_.intersend_);
     }
 
     // optional .RemyBuffers.OptimizationSetting lambda = 54;
     if (cached_has_bits & 0x00000008u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *lambda_);
+          *_impl_.lambda_);
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void OptimizationSettings::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.OptimizationSettings)
-  GOOGLE_DCHECK_NE(&from, this);
-  const OptimizationSettings* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<OptimizationSettings>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.OptimizationSettings)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.OptimizationSettings)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OptimizationSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OptimizationSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OptimizationSettings::GetClassData() const { return &_class_data_; }
 
-void OptimizationSettings::MergeFrom(const OptimizationSettings& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.OptimizationSettings)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void OptimizationSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OptimizationSettings*>(&to_msg);
+  auto& from = static_cast<const OptimizationSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.OptimizationSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_window_increment()->::RemyBuffers::OptimizationSetting::MergeFrom(from._internal_window_increment());
+      _this->_internal_mutable_window_increment()->::RemyBuffers::OptimizationSetting::MergeFrom(
+          from._internal_window_increment());
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_mutable_window_multiple()->::RemyBuffers::OptimizationSetting::MergeFrom(from._internal_window_multiple());
+      _this->_internal_mutable_window_multiple()->::RemyBuffers::OptimizationSetting::MergeFrom(
+          from._internal_window_multiple());
     }
     if (cached_has_bits & 0x00000004u) {
-      _internal_mutable_intersend()->::RemyBuffers::OptimizationSetting::MergeFrom(from._internal_intersend());
+      _this->_internal_mutable_intersend()->::RemyBuffers::OptimizationSetting::MergeFrom(
+          from._internal_intersend());
     }
     if (cached_has_bits & 0x00000008u) {
-      _internal_mutable_lambda()->::RemyBuffers::OptimizationSetting::MergeFrom(from._internal_lambda());
+      _this->_internal_mutable_lambda()->::RemyBuffers::OptimizationSetting::MergeFrom(
+          from._internal_lambda());
     }
   }
-}
-
-void OptimizationSettings::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.OptimizationSettings)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void OptimizationSettings::CopyFrom(const OptimizationSettings& from) {
@@ -3563,28 +3410,27 @@ bool OptimizationSettings::IsInitialized() const {
 
 void OptimizationSettings::InternalSwap(OptimizationSettings* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(OptimizationSettings, lambda_)
-      + sizeof(OptimizationSettings::lambda_)
-      - PROTOBUF_FIELD_OFFSET(OptimizationSettings, window_increment_)>(
-          reinterpret_cast<char*>(&window_increment_),
-          reinterpret_cast<char*>(&other->window_increment_));
+      PROTOBUF_FIELD_OFFSET(OptimizationSettings, _impl_.lambda_)
+      + sizeof(OptimizationSettings::_impl_.lambda_)
+      - PROTOBUF_FIELD_OFFSET(OptimizationSettings, _impl_.window_increment_)>(
+          reinterpret_cast<char*>(&_impl_.window_increment_),
+          reinterpret_cast<char*>(&other->_impl_.window_increment_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata OptimizationSettings::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void Range::InitAsDefaultInstance() {
-}
 class Range::_Internal {
  public:
-  using HasBits = decltype(std::declval<Range>()._has_bits_);
+  using HasBits = decltype(std::declval<Range>()._impl_._has_bits_);
   static void set_has_low(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
@@ -3596,152 +3442,160 @@ class Range::_Internal {
   }
 };
 
-Range::Range(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Range::Range(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.Range)
 }
 Range::Range(const Range& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Range* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.low_){}
+    , decltype(_impl_.high_){}
+    , decltype(_impl_.incr_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&low_, &from.low_,
-    static_cast<size_t>(reinterpret_cast<char*>(&incr_) -
-    reinterpret_cast<char*>(&low_)) + sizeof(incr_));
+  ::memcpy(&_impl_.low_, &from._impl_.low_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.incr_) -
+    reinterpret_cast<char*>(&_impl_.low_)) + sizeof(_impl_.incr_));
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.Range)
 }
 
-void Range::SharedCtor() {
-  ::memset(&low_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&incr_) -
-      reinterpret_cast<char*>(&low_)) + sizeof(incr_));
+inline void Range::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.low_){0}
+    , decltype(_impl_.high_){0}
+    , decltype(_impl_.incr_){0}
+  };
 }
 
 Range::~Range() {
   // @@protoc_insertion_point(destructor:RemyBuffers.Range)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Range::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Range::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Range::ArenaDtor(void* object) {
-  Range* _this = reinterpret_cast< Range* >(object);
-  (void)_this;
-}
-void Range::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Range::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Range& Range::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Range_dna_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Range::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.Range)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000007u) {
-    ::memset(&low_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&incr_) -
-        reinterpret_cast<char*>(&low_)) + sizeof(incr_));
+    ::memset(&_impl_.low_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.incr_) -
+        reinterpret_cast<char*>(&_impl_.low_)) + sizeof(_impl_.incr_));
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Range::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Range::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional double low = 61;
       case 61:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 233)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 233)) {
           _Internal::set_has_low(&has_bits);
-          low_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.low_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double high = 62;
       case 62:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 241)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 241)) {
           _Internal::set_has_high(&has_bits);
-          high_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.high_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double incr = 63;
       case 63:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 249)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 249)) {
           _Internal::set_has_incr(&has_bits);
-          incr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.incr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Range::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Range::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.Range)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional double low = 61;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(61, this->_internal_low(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(61, this->_internal_low(), target);
   }
 
   // optional double high = 62;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(62, this->_internal_high(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(62, this->_internal_high(), target);
   }
 
   // optional double incr = 63;
   if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(63, this->_internal_incr(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(63, this->_internal_incr(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.Range)
@@ -3752,11 +3606,11 @@ size_t Range::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.Range)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000007u) {
     // optional double low = 61;
     if (cached_has_bits & 0x00000001u) {
@@ -3774,57 +3628,38 @@ size_t Range::ByteSizeLong() const {
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Range::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.Range)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Range* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Range>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.Range)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.Range)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Range::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Range::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Range::GetClassData() const { return &_class_data_; }
 
-void Range::MergeFrom(const Range& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Range)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Range::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Range*>(&to_msg);
+  auto& from = static_cast<const Range&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.Range)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x00000007u) {
     if (cached_has_bits & 0x00000001u) {
-      low_ = from.low_;
+      _this->_impl_.low_ = from._impl_.low_;
     }
     if (cached_has_bits & 0x00000002u) {
-      high_ = from.high_;
+      _this->_impl_.high_ = from._impl_.high_;
     }
     if (cached_has_bits & 0x00000004u) {
-      incr_ = from.incr_;
+      _this->_impl_.incr_ = from._impl_.incr_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void Range::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.Range)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Range::CopyFrom(const Range& from) {
@@ -3840,42 +3675,27 @@ bool Range::IsInitialized() const {
 
 void Range::InternalSwap(Range* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Range, incr_)
-      + sizeof(Range::incr_)
-      - PROTOBUF_FIELD_OFFSET(Range, low_)>(
-          reinterpret_cast<char*>(&low_),
-          reinterpret_cast<char*>(&other->low_));
+      PROTOBUF_FIELD_OFFSET(Range, _impl_.incr_)
+      + sizeof(Range::_impl_.incr_)
+      - PROTOBUF_FIELD_OFFSET(Range, _impl_.low_)>(
+          reinterpret_cast<char*>(&_impl_.low_),
+          reinterpret_cast<char*>(&other->_impl_.low_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Range::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void ConfigRange::InitAsDefaultInstance() {
-  ::RemyBuffers::_ConfigRange_default_instance_._instance.get_mutable()->link_packets_per_ms_ = const_cast< ::RemyBuffers::Range*>(
-      ::RemyBuffers::Range::internal_default_instance());
-  ::RemyBuffers::_ConfigRange_default_instance_._instance.get_mutable()->rtt_ = const_cast< ::RemyBuffers::Range*>(
-      ::RemyBuffers::Range::internal_default_instance());
-  ::RemyBuffers::_ConfigRange_default_instance_._instance.get_mutable()->num_senders_ = const_cast< ::RemyBuffers::Range*>(
-      ::RemyBuffers::Range::internal_default_instance());
-  ::RemyBuffers::_ConfigRange_default_instance_._instance.get_mutable()->buffer_size_ = const_cast< ::RemyBuffers::Range*>(
-      ::RemyBuffers::Range::internal_default_instance());
-  ::RemyBuffers::_ConfigRange_default_instance_._instance.get_mutable()->mean_off_duration_ = const_cast< ::RemyBuffers::Range*>(
-      ::RemyBuffers::Range::internal_default_instance());
-  ::RemyBuffers::_ConfigRange_default_instance_._instance.get_mutable()->mean_on_duration_ = const_cast< ::RemyBuffers::Range*>(
-      ::RemyBuffers::Range::internal_default_instance());
-  ::RemyBuffers::_ConfigRange_default_instance_._instance.get_mutable()->stochastic_loss_rate_ = const_cast< ::RemyBuffers::Range*>(
-      ::RemyBuffers::Range::internal_default_instance());
-}
 class ConfigRange::_Internal {
  public:
-  using HasBits = decltype(std::declval<ConfigRange>()._has_bits_);
+  using HasBits = decltype(std::declval<ConfigRange>()._impl_._has_bits_);
   static const ::RemyBuffers::Range& link_packets_per_ms(const ConfigRange* msg);
   static void set_has_link_packets_per_ms(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
@@ -3911,322 +3731,323 @@ class ConfigRange::_Internal {
 
 const ::RemyBuffers::Range&
 ConfigRange::_Internal::link_packets_per_ms(const ConfigRange* msg) {
-  return *msg->link_packets_per_ms_;
+  return *msg->_impl_.link_packets_per_ms_;
 }
 const ::RemyBuffers::Range&
 ConfigRange::_Internal::rtt(const ConfigRange* msg) {
-  return *msg->rtt_;
+  return *msg->_impl_.rtt_;
 }
 const ::RemyBuffers::Range&
 ConfigRange::_Internal::num_senders(const ConfigRange* msg) {
-  return *msg->num_senders_;
+  return *msg->_impl_.num_senders_;
 }
 const ::RemyBuffers::Range&
 ConfigRange::_Internal::buffer_size(const ConfigRange* msg) {
-  return *msg->buffer_size_;
+  return *msg->_impl_.buffer_size_;
 }
 const ::RemyBuffers::Range&
 ConfigRange::_Internal::mean_off_duration(const ConfigRange* msg) {
-  return *msg->mean_off_duration_;
+  return *msg->_impl_.mean_off_duration_;
 }
 const ::RemyBuffers::Range&
 ConfigRange::_Internal::mean_on_duration(const ConfigRange* msg) {
-  return *msg->mean_on_duration_;
+  return *msg->_impl_.mean_on_duration_;
 }
 const ::RemyBuffers::Range&
 ConfigRange::_Internal::stochastic_loss_rate(const ConfigRange* msg) {
-  return *msg->stochastic_loss_rate_;
+  return *msg->_impl_.stochastic_loss_rate_;
 }
-ConfigRange::ConfigRange(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+ConfigRange::ConfigRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.ConfigRange)
 }
 ConfigRange::ConfigRange(const ConfigRange& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfigRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.link_packets_per_ms_){nullptr}
+    , decltype(_impl_.rtt_){nullptr}
+    , decltype(_impl_.num_senders_){nullptr}
+    , decltype(_impl_.buffer_size_){nullptr}
+    , decltype(_impl_.mean_off_duration_){nullptr}
+    , decltype(_impl_.mean_on_duration_){nullptr}
+    , decltype(_impl_.stochastic_loss_rate_){nullptr}
+    , decltype(_impl_.simulation_ticks_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_link_packets_per_ms()) {
-    link_packets_per_ms_ = new ::RemyBuffers::Range(*from.link_packets_per_ms_);
-  } else {
-    link_packets_per_ms_ = nullptr;
+    _this->_impl_.link_packets_per_ms_ = new ::RemyBuffers::Range(*from._impl_.link_packets_per_ms_);
   }
   if (from._internal_has_rtt()) {
-    rtt_ = new ::RemyBuffers::Range(*from.rtt_);
-  } else {
-    rtt_ = nullptr;
+    _this->_impl_.rtt_ = new ::RemyBuffers::Range(*from._impl_.rtt_);
   }
   if (from._internal_has_num_senders()) {
-    num_senders_ = new ::RemyBuffers::Range(*from.num_senders_);
-  } else {
-    num_senders_ = nullptr;
+    _this->_impl_.num_senders_ = new ::RemyBuffers::Range(*from._impl_.num_senders_);
   }
   if (from._internal_has_buffer_size()) {
-    buffer_size_ = new ::RemyBuffers::Range(*from.buffer_size_);
-  } else {
-    buffer_size_ = nullptr;
+    _this->_impl_.buffer_size_ = new ::RemyBuffers::Range(*from._impl_.buffer_size_);
   }
   if (from._internal_has_mean_off_duration()) {
-    mean_off_duration_ = new ::RemyBuffers::Range(*from.mean_off_duration_);
-  } else {
-    mean_off_duration_ = nullptr;
+    _this->_impl_.mean_off_duration_ = new ::RemyBuffers::Range(*from._impl_.mean_off_duration_);
   }
   if (from._internal_has_mean_on_duration()) {
-    mean_on_duration_ = new ::RemyBuffers::Range(*from.mean_on_duration_);
-  } else {
-    mean_on_duration_ = nullptr;
+    _this->_impl_.mean_on_duration_ = new ::RemyBuffers::Range(*from._impl_.mean_on_duration_);
   }
   if (from._internal_has_stochastic_loss_rate()) {
-    stochastic_loss_rate_ = new ::RemyBuffers::Range(*from.stochastic_loss_rate_);
-  } else {
-    stochastic_loss_rate_ = nullptr;
+    _this->_impl_.stochastic_loss_rate_ = new ::RemyBuffers::Range(*from._impl_.stochastic_loss_rate_);
   }
-  simulation_ticks_ = from.simulation_ticks_;
+  _this->_impl_.simulation_ticks_ = from._impl_.simulation_ticks_;
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.ConfigRange)
 }
 
-void ConfigRange::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ConfigRange_dna_2eproto.base);
-  ::memset(&link_packets_per_ms_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&simulation_ticks_) -
-      reinterpret_cast<char*>(&link_packets_per_ms_)) + sizeof(simulation_ticks_));
+inline void ConfigRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.link_packets_per_ms_){nullptr}
+    , decltype(_impl_.rtt_){nullptr}
+    , decltype(_impl_.num_senders_){nullptr}
+    , decltype(_impl_.buffer_size_){nullptr}
+    , decltype(_impl_.mean_off_duration_){nullptr}
+    , decltype(_impl_.mean_on_duration_){nullptr}
+    , decltype(_impl_.stochastic_loss_rate_){nullptr}
+    , decltype(_impl_.simulation_ticks_){0u}
+  };
 }
 
 ConfigRange::~ConfigRange() {
   // @@protoc_insertion_point(destructor:RemyBuffers.ConfigRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ConfigRange::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete link_packets_per_ms_;
-  if (this != internal_default_instance()) delete rtt_;
-  if (this != internal_default_instance()) delete num_senders_;
-  if (this != internal_default_instance()) delete buffer_size_;
-  if (this != internal_default_instance()) delete mean_off_duration_;
-  if (this != internal_default_instance()) delete mean_on_duration_;
-  if (this != internal_default_instance()) delete stochastic_loss_rate_;
+inline void ConfigRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.link_packets_per_ms_;
+  if (this != internal_default_instance()) delete _impl_.rtt_;
+  if (this != internal_default_instance()) delete _impl_.num_senders_;
+  if (this != internal_default_instance()) delete _impl_.buffer_size_;
+  if (this != internal_default_instance()) delete _impl_.mean_off_duration_;
+  if (this != internal_default_instance()) delete _impl_.mean_on_duration_;
+  if (this != internal_default_instance()) delete _impl_.stochastic_loss_rate_;
 }
 
-void ConfigRange::ArenaDtor(void* object) {
-  ConfigRange* _this = reinterpret_cast< ConfigRange* >(object);
-  (void)_this;
-}
-void ConfigRange::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ConfigRange::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ConfigRange& ConfigRange::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ConfigRange_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ConfigRange::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.ConfigRange)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
-      GOOGLE_DCHECK(link_packets_per_ms_ != nullptr);
-      link_packets_per_ms_->Clear();
+      GOOGLE_DCHECK(_impl_.link_packets_per_ms_ != nullptr);
+      _impl_.link_packets_per_ms_->Clear();
     }
     if (cached_has_bits & 0x00000002u) {
-      GOOGLE_DCHECK(rtt_ != nullptr);
-      rtt_->Clear();
+      GOOGLE_DCHECK(_impl_.rtt_ != nullptr);
+      _impl_.rtt_->Clear();
     }
     if (cached_has_bits & 0x00000004u) {
-      GOOGLE_DCHECK(num_senders_ != nullptr);
-      num_senders_->Clear();
+      GOOGLE_DCHECK(_impl_.num_senders_ != nullptr);
+      _impl_.num_senders_->Clear();
     }
     if (cached_has_bits & 0x00000008u) {
-      GOOGLE_DCHECK(buffer_size_ != nullptr);
-      buffer_size_->Clear();
+      GOOGLE_DCHECK(_impl_.buffer_size_ != nullptr);
+      _impl_.buffer_size_->Clear();
     }
     if (cached_has_bits & 0x00000010u) {
-      GOOGLE_DCHECK(mean_off_duration_ != nullptr);
-      mean_off_duration_->Clear();
+      GOOGLE_DCHECK(_impl_.mean_off_duration_ != nullptr);
+      _impl_.mean_off_duration_->Clear();
     }
     if (cached_has_bits & 0x00000020u) {
-      GOOGLE_DCHECK(mean_on_duration_ != nullptr);
-      mean_on_duration_->Clear();
+      GOOGLE_DCHECK(_impl_.mean_on_duration_ != nullptr);
+      _impl_.mean_on_duration_->Clear();
     }
     if (cached_has_bits & 0x00000040u) {
-      GOOGLE_DCHECK(stochastic_loss_rate_ != nullptr);
-      stochastic_loss_rate_->Clear();
+      GOOGLE_DCHECK(_impl_.stochastic_loss_rate_ != nullptr);
+      _impl_.stochastic_loss_rate_->Clear();
     }
   }
-  simulation_ticks_ = 0u;
-  _has_bits_.Clear();
+  _impl_.simulation_ticks_ = 0u;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ConfigRange::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ConfigRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional .RemyBuffers.Range link_packets_per_ms = 71;
       case 71:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
           ptr = ctx->ParseMessage(_internal_mutable_link_packets_per_ms(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Range rtt = 72;
       case 72:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
           ptr = ctx->ParseMessage(_internal_mutable_rtt(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Range num_senders = 73;
       case 73:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
           ptr = ctx->ParseMessage(_internal_mutable_num_senders(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Range buffer_size = 74;
       case 74:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
           ptr = ctx->ParseMessage(_internal_mutable_buffer_size(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Range mean_off_duration = 75;
       case 75:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
           ptr = ctx->ParseMessage(_internal_mutable_mean_off_duration(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Range mean_on_duration = 76;
       case 76:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
           ptr = ctx->ParseMessage(_internal_mutable_mean_on_duration(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional uint32 simulation_ticks = 77;
       case 77:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
           _Internal::set_has_simulation_ticks(&has_bits);
-          simulation_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.simulation_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional .RemyBuffers.Range stochastic_loss_rate = 78;
       case 78:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
           ptr = ctx->ParseMessage(_internal_mutable_stochastic_loss_rate(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ConfigRange::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ConfigRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.ConfigRange)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .RemyBuffers.Range link_packets_per_ms = 71;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        71, _Internal::link_packets_per_ms(this), target, stream);
+      InternalWriteMessage(71, _Internal::link_packets_per_ms(this),
+        _Internal::link_packets_per_ms(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Range rtt = 72;
   if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        72, _Internal::rtt(this), target, stream);
+      InternalWriteMessage(72, _Internal::rtt(this),
+        _Internal::rtt(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Range num_senders = 73;
   if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        73, _Internal::num_senders(this), target, stream);
+      InternalWriteMessage(73, _Internal::num_senders(this),
+        _Internal::num_senders(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Range buffer_size = 74;
   if (cached_has_bits & 0x00000008u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        74, _Internal::buffer_size(this), target, stream);
+      InternalWriteMessage(74, _Internal::buffer_size(this),
+        _Internal::buffer_size(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Range mean_off_duration = 75;
   if (cached_has_bits & 0x00000010u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        75, _Internal::mean_off_duration(this), target, stream);
+      InternalWriteMessage(75, _Internal::mean_off_duration(this),
+        _Internal::mean_off_duration(this).GetCachedSize(), target, stream);
   }
 
   // optional .RemyBuffers.Range mean_on_duration = 76;
   if (cached_has_bits & 0x00000020u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        76, _Internal::mean_on_duration(this), target, stream);
+      InternalWriteMessage(76, _Internal::mean_on_duration(this),
+        _Internal::mean_on_duration(this).GetCachedSize(), target, stream);
   }
 
   // optional uint32 simulation_ticks = 77;
   if (cached_has_bits & 0x00000080u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(77, this->_internal_simulation_ticks(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(77, this->_internal_simulation_ticks(), target);
   }
 
   // optional .RemyBuffers.Range stochastic_loss_rate = 78;
   if (cached_has_bits & 0x00000040u) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        78, _Internal::stochastic_loss_rate(this), target, stream);
+      InternalWriteMessage(78, _Internal::stochastic_loss_rate(this),
+        _Internal::stochastic_loss_rate(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.ConfigRange)
@@ -4237,135 +4058,123 @@ size_t ConfigRange::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.ConfigRange)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     // optional .RemyBuffers.Range link_packets_per_ms = 71;
     if (cached_has_bits & 0x00000001u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *link_packets_per_ms_);
+          *_impl_.link_packets_per_ms_);
     }
 
     // optional .RemyBuffers.Range rtt = 72;
     if (cached_has_bits & 0x00000002u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *rtt_);
+          *_impl_.rtt_);
     }
 
     // optional .RemyBuffers.Range num_senders = 73;
     if (cached_has_bits & 0x00000004u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *num_senders_);
+          *_impl_.num_senders_);
     }
 
     // optional .RemyBuffers.Range buffer_size = 74;
     if (cached_has_bits & 0x00000008u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *buffer_size_);
+          *_impl_.buffer_size_);
     }
 
     // optional .RemyBuffers.Range mean_off_duration = 75;
     if (cached_has_bits & 0x00000010u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *mean_off_duration_);
+          *_impl_.mean_off_duration_);
     }
 
     // optional .RemyBuffers.Range mean_on_duration = 76;
     if (cached_has_bits & 0x00000020u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *mean_on_duration_);
+          *_impl_.mean_on_duration_);
     }
 
     // optional .RemyBuffers.Range stochastic_loss_rate = 78;
     if (cached_has_bits & 0x00000040u) {
       total_size += 2 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *stochastic_loss_rate_);
+          *_impl_.stochastic_loss_rate_);
     }
 
     // optional uint32 simulation_ticks = 77;
     if (cached_has_bits & 0x00000080u) {
       total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        ::_pbi::WireFormatLite::UInt32Size(
           this->_internal_simulation_ticks());
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ConfigRange::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.ConfigRange)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ConfigRange* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ConfigRange>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.ConfigRange)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.ConfigRange)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfigRange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfigRange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfigRange::GetClassData() const { return &_class_data_; }
 
-void ConfigRange::MergeFrom(const ConfigRange& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.ConfigRange)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ConfigRange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfigRange*>(&to_msg);
+  auto& from = static_cast<const ConfigRange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.ConfigRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_link_packets_per_ms()->::RemyBuffers::Range::MergeFrom(from._internal_link_packets_per_ms());
+      _this->_internal_mutable_link_packets_per_ms()->::RemyBuffers::Range::MergeFrom(
+          from._internal_link_packets_per_ms());
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_mutable_rtt()->::RemyBuffers::Range::MergeFrom(from._internal_rtt());
+      _this->_internal_mutable_rtt()->::RemyBuffers::Range::MergeFrom(
+          from._internal_rtt());
     }
     if (cached_has_bits & 0x00000004u) {
-      _internal_mutable_num_senders()->::RemyBuffers::Range::MergeFrom(from._internal_num_senders());
+      _this->_internal_mutable_num_senders()->::RemyBuffers::Range::MergeFrom(
+          from._internal_num_senders());
     }
     if (cached_has_bits & 0x00000008u) {
-      _internal_mutable_buffer_size()->::RemyBuffers::Range::MergeFrom(from._internal_buffer_size());
+      _this->_internal_mutable_buffer_size()->::RemyBuffers::Range::MergeFrom(
+          from._internal_buffer_size());
     }
     if (cached_has_bits & 0x00000010u) {
-      _internal_mutable_mean_off_duration()->::RemyBuffers::Range::MergeFrom(from._internal_mean_off_duration());
+      _this->_internal_mutable_mean_off_duration()->::RemyBuffers::Range::MergeFrom(
+          from._internal_mean_off_duration());
     }
     if (cached_has_bits & 0x00000020u) {
-      _internal_mutable_mean_on_duration()->::RemyBuffers::Range::MergeFrom(from._internal_mean_on_duration());
+      _this->_internal_mutable_mean_on_duration()->::RemyBuffers::Range::MergeFrom(
+          from._internal_mean_on_duration());
     }
     if (cached_has_bits & 0x00000040u) {
-      _internal_mutable_stochastic_loss_rate()->::RemyBuffers::Range::MergeFrom(from._internal_stochastic_loss_rate());
+      _this->_internal_mutable_stochastic_loss_rate()->::RemyBuffers::Range::MergeFrom(
+          from._internal_stochastic_loss_rate());
     }
     if (cached_has_bits & 0x00000080u) {
-      simulation_ticks_ = from.simulation_ticks_;
+      _this->_impl_.simulation_ticks_ = from._impl_.simulation_ticks_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void ConfigRange::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.ConfigRange)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ConfigRange::CopyFrom(const ConfigRange& from) {
@@ -4381,28 +4190,27 @@ bool ConfigRange::IsInitialized() const {
 
 void ConfigRange::InternalSwap(ConfigRange* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ConfigRange, simulation_ticks_)
-      + sizeof(ConfigRange::simulation_ticks_)
-      - PROTOBUF_FIELD_OFFSET(ConfigRange, link_packets_per_ms_)>(
-          reinterpret_cast<char*>(&link_packets_per_ms_),
-          reinterpret_cast<char*>(&other->link_packets_per_ms_));
+      PROTOBUF_FIELD_OFFSET(ConfigRange, _impl_.simulation_ticks_)
+      + sizeof(ConfigRange::_impl_.simulation_ticks_)
+      - PROTOBUF_FIELD_OFFSET(ConfigRange, _impl_.link_packets_per_ms_)>(
+          reinterpret_cast<char*>(&_impl_.link_packets_per_ms_),
+          reinterpret_cast<char*>(&other->_impl_.link_packets_per_ms_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ConfigRange::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void NetConfig::InitAsDefaultInstance() {
-}
 class NetConfig::_Internal {
  public:
-  using HasBits = decltype(std::declval<NetConfig>()._has_bits_);
+  using HasBits = decltype(std::declval<NetConfig>()._impl_._has_bits_);
   static void set_has_mean_on_duration(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
@@ -4426,208 +4234,228 @@ class NetConfig::_Internal {
   }
 };
 
-NetConfig::NetConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+NetConfig::NetConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.NetConfig)
 }
 NetConfig::NetConfig(const NetConfig& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mean_on_duration_){}
+    , decltype(_impl_.mean_off_duration_){}
+    , decltype(_impl_.link_ppt_){}
+    , decltype(_impl_.num_senders_){}
+    , decltype(_impl_.buffer_size_){}
+    , decltype(_impl_.delay_){}
+    , decltype(_impl_.stochastic_loss_rate_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&mean_on_duration_, &from.mean_on_duration_,
-    static_cast<size_t>(reinterpret_cast<char*>(&stochastic_loss_rate_) -
-    reinterpret_cast<char*>(&mean_on_duration_)) + sizeof(stochastic_loss_rate_));
+  ::memcpy(&_impl_.mean_on_duration_, &from._impl_.mean_on_duration_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stochastic_loss_rate_) -
+    reinterpret_cast<char*>(&_impl_.mean_on_duration_)) + sizeof(_impl_.stochastic_loss_rate_));
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.NetConfig)
 }
 
-void NetConfig::SharedCtor() {
-  ::memset(&mean_on_duration_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&stochastic_loss_rate_) -
-      reinterpret_cast<char*>(&mean_on_duration_)) + sizeof(stochastic_loss_rate_));
+inline void NetConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mean_on_duration_){0}
+    , decltype(_impl_.mean_off_duration_){0}
+    , decltype(_impl_.link_ppt_){0}
+    , decltype(_impl_.num_senders_){0u}
+    , decltype(_impl_.buffer_size_){0u}
+    , decltype(_impl_.delay_){0}
+    , decltype(_impl_.stochastic_loss_rate_){0}
+  };
 }
 
 NetConfig::~NetConfig() {
   // @@protoc_insertion_point(destructor:RemyBuffers.NetConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NetConfig::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void NetConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void NetConfig::ArenaDtor(void* object) {
-  NetConfig* _this = reinterpret_cast< NetConfig* >(object);
-  (void)_this;
-}
-void NetConfig::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void NetConfig::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const NetConfig& NetConfig::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NetConfig_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void NetConfig::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.NetConfig)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000007fu) {
-    ::memset(&mean_on_duration_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&stochastic_loss_rate_) -
-        reinterpret_cast<char*>(&mean_on_duration_)) + sizeof(stochastic_loss_rate_));
+    ::memset(&_impl_.mean_on_duration_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.stochastic_loss_rate_) -
+        reinterpret_cast<char*>(&_impl_.mean_on_duration_)) + sizeof(_impl_.stochastic_loss_rate_));
   }
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NetConfig::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NetConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional double mean_on_duration = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
           _Internal::set_has_mean_on_duration(&has_bits);
-          mean_on_duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.mean_on_duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double mean_off_duration = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
           _Internal::set_has_mean_off_duration(&has_bits);
-          mean_off_duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.mean_off_duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional uint32 num_senders = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
           _Internal::set_has_num_senders(&has_bits);
-          num_senders_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.num_senders_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double link_ppt = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 33)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
           _Internal::set_has_link_ppt(&has_bits);
-          link_ppt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.link_ppt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double delay = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 41)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
           _Internal::set_has_delay(&has_bits);
-          delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional uint32 buffer_size = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
           _Internal::set_has_buffer_size(&has_bits);
-          buffer_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.buffer_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // optional double stochastic_loss_rate = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 57)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
           _Internal::set_has_stochastic_loss_rate(&has_bits);
-          stochastic_loss_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.stochastic_loss_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
-  _has_bits_.Or(has_bits);
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NetConfig::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* NetConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.NetConfig)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   // optional double mean_on_duration = 1;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_mean_on_duration(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_mean_on_duration(), target);
   }
 
   // optional double mean_off_duration = 2;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_mean_off_duration(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_mean_off_duration(), target);
   }
 
   // optional uint32 num_senders = 3;
   if (cached_has_bits & 0x00000008u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_num_senders(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_num_senders(), target);
   }
 
   // optional double link_ppt = 4;
   if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(4, this->_internal_link_ppt(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_link_ppt(), target);
   }
 
   // optional double delay = 5;
   if (cached_has_bits & 0x00000020u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(5, this->_internal_delay(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_delay(), target);
   }
 
   // optional uint32 buffer_size = 6;
   if (cached_has_bits & 0x00000010u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(6, this->_internal_buffer_size(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_buffer_size(), target);
   }
 
   // optional double stochastic_loss_rate = 7;
   if (cached_has_bits & 0x00000040u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(7, this->_internal_stochastic_loss_rate(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_stochastic_loss_rate(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.NetConfig)
@@ -4638,11 +4466,11 @@ size_t NetConfig::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.NetConfig)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x0000007fu) {
     // optional double mean_on_duration = 1;
     if (cached_has_bits & 0x00000001u) {
@@ -4661,16 +4489,12 @@ size_t NetConfig::ByteSizeLong() const {
 
     // optional uint32 num_senders = 3;
     if (cached_has_bits & 0x00000008u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-          this->_internal_num_senders());
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_senders());
     }
 
     // optional uint32 buffer_size = 6;
     if (cached_has_bits & 0x00000010u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-          this->_internal_buffer_size());
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_buffer_size());
     }
 
     // optional double delay = 5;
@@ -4684,69 +4508,50 @@ size_t NetConfig::ByteSizeLong() const {
     }
 
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NetConfig::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.NetConfig)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NetConfig* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NetConfig>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.NetConfig)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.NetConfig)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetConfig::GetClassData() const { return &_class_data_; }
 
-void NetConfig::MergeFrom(const NetConfig& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.NetConfig)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void NetConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetConfig*>(&to_msg);
+  auto& from = static_cast<const NetConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.NetConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
-      mean_on_duration_ = from.mean_on_duration_;
+      _this->_impl_.mean_on_duration_ = from._impl_.mean_on_duration_;
     }
     if (cached_has_bits & 0x00000002u) {
-      mean_off_duration_ = from.mean_off_duration_;
+      _this->_impl_.mean_off_duration_ = from._impl_.mean_off_duration_;
     }
     if (cached_has_bits & 0x00000004u) {
-      link_ppt_ = from.link_ppt_;
+      _this->_impl_.link_ppt_ = from._impl_.link_ppt_;
     }
     if (cached_has_bits & 0x00000008u) {
-      num_senders_ = from.num_senders_;
+      _this->_impl_.num_senders_ = from._impl_.num_senders_;
     }
     if (cached_has_bits & 0x00000010u) {
-      buffer_size_ = from.buffer_size_;
+      _this->_impl_.buffer_size_ = from._impl_.buffer_size_;
     }
     if (cached_has_bits & 0x00000020u) {
-      delay_ = from.delay_;
+      _this->_impl_.delay_ = from._impl_.delay_;
     }
     if (cached_has_bits & 0x00000040u) {
-      stochastic_loss_rate_ = from.stochastic_loss_rate_;
+      _this->_impl_.stochastic_loss_rate_ = from._impl_.stochastic_loss_rate_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void NetConfig::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.NetConfig)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NetConfig::CopyFrom(const NetConfig& from) {
@@ -4762,93 +4567,92 @@ bool NetConfig::IsInitialized() const {
 
 void NetConfig::InternalSwap(NetConfig* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(NetConfig, stochastic_loss_rate_)
-      + sizeof(NetConfig::stochastic_loss_rate_)
-      - PROTOBUF_FIELD_OFFSET(NetConfig, mean_on_duration_)>(
-          reinterpret_cast<char*>(&mean_on_duration_),
-          reinterpret_cast<char*>(&other->mean_on_duration_));
+      PROTOBUF_FIELD_OFFSET(NetConfig, _impl_.stochastic_loss_rate_)
+      + sizeof(NetConfig::_impl_.stochastic_loss_rate_)
+      - PROTOBUF_FIELD_OFFSET(NetConfig, _impl_.mean_on_duration_)>(
+          reinterpret_cast<char*>(&_impl_.mean_on_duration_),
+          reinterpret_cast<char*>(&other->_impl_.mean_on_duration_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NetConfig::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void ConfigVector::InitAsDefaultInstance() {
-}
 class ConfigVector::_Internal {
  public:
 };
 
-ConfigVector::ConfigVector(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  config_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+ConfigVector::ConfigVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:RemyBuffers.ConfigVector)
 }
 ConfigVector::ConfigVector(const ConfigVector& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      config_(from.config_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfigVector* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.config_){from._impl_.config_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:RemyBuffers.ConfigVector)
 }
 
-void ConfigVector::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ConfigVector_dna_2eproto.base);
+inline void ConfigVector::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.config_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ConfigVector::~ConfigVector() {
   // @@protoc_insertion_point(destructor:RemyBuffers.ConfigVector)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ConfigVector::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ConfigVector::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.config_.~RepeatedPtrField();
 }
 
-void ConfigVector::ArenaDtor(void* object) {
-  ConfigVector* _this = reinterpret_cast< ConfigVector* >(object);
-  (void)_this;
-}
-void ConfigVector::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ConfigVector::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ConfigVector& ConfigVector::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ConfigVector_dna_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ConfigVector::Clear() {
 // @@protoc_insertion_point(message_clear_start:RemyBuffers.ConfigVector)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  config_.Clear();
+  _impl_.config_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ConfigVector::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ConfigVector::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .RemyBuffers.NetConfig config = 81;
       case 81:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
           ptr -= 2;
           do {
             ptr += 2;
@@ -4856,46 +4660,48 @@ const char* ConfigVector::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_I
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<650>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ConfigVector::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ConfigVector::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:RemyBuffers.ConfigVector)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .RemyBuffers.NetConfig config = 81;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_config_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_config_size()); i < n; i++) {
+    const auto& repfield = this->_internal_config(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(81, this->_internal_config(i), target, stream);
+        InternalWriteMessage(81, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:RemyBuffers.ConfigVector)
@@ -4906,56 +4712,37 @@ size_t ConfigVector::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:RemyBuffers.ConfigVector)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .RemyBuffers.NetConfig config = 81;
   total_size += 2UL * this->_internal_config_size();
-  for (const auto& msg : this->config_) {
+  for (const auto& msg : this->_impl_.config_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ConfigVector::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:RemyBuffers.ConfigVector)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ConfigVector* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ConfigVector>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:RemyBuffers.ConfigVector)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:RemyBuffers.ConfigVector)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfigVector::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfigVector::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfigVector::GetClassData() const { return &_class_data_; }
 
-void ConfigVector::MergeFrom(const ConfigVector& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.ConfigVector)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  config_.MergeFrom(from.config_);
-}
+void ConfigVector::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfigVector*>(&to_msg);
+  auto& from = static_cast<const ConfigVector&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RemyBuffers.ConfigVector)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void ConfigVector::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:RemyBuffers.ConfigVector)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.config_.MergeFrom(from._impl_.config_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ConfigVector::CopyFrom(const ConfigVector& from) {
@@ -4971,52 +4758,65 @@ bool ConfigVector::IsInitialized() const {
 
 void ConfigVector::InternalSwap(ConfigVector* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  config_.InternalSwap(&other->config_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.config_.InternalSwap(&other->_impl_.config_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ConfigVector::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dna_2eproto_getter, &descriptor_table_dna_2eproto_once,
+      file_level_metadata_dna_2eproto[11]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace RemyBuffers
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::RemyBuffers::WhiskerTree* Arena::CreateMaybeMessage< ::RemyBuffers::WhiskerTree >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::WhiskerTree*
+Arena::CreateMaybeMessage< ::RemyBuffers::WhiskerTree >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::WhiskerTree >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::FinTree* Arena::CreateMaybeMessage< ::RemyBuffers::FinTree >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::FinTree*
+Arena::CreateMaybeMessage< ::RemyBuffers::FinTree >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::FinTree >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::MemoryRange* Arena::CreateMaybeMessage< ::RemyBuffers::MemoryRange >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::MemoryRange*
+Arena::CreateMaybeMessage< ::RemyBuffers::MemoryRange >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::MemoryRange >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::Memory* Arena::CreateMaybeMessage< ::RemyBuffers::Memory >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::Memory*
+Arena::CreateMaybeMessage< ::RemyBuffers::Memory >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::Memory >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::Whisker* Arena::CreateMaybeMessage< ::RemyBuffers::Whisker >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::Whisker*
+Arena::CreateMaybeMessage< ::RemyBuffers::Whisker >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::Whisker >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::Fin* Arena::CreateMaybeMessage< ::RemyBuffers::Fin >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::Fin*
+Arena::CreateMaybeMessage< ::RemyBuffers::Fin >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::Fin >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::OptimizationSetting* Arena::CreateMaybeMessage< ::RemyBuffers::OptimizationSetting >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::OptimizationSetting*
+Arena::CreateMaybeMessage< ::RemyBuffers::OptimizationSetting >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::OptimizationSetting >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::OptimizationSettings* Arena::CreateMaybeMessage< ::RemyBuffers::OptimizationSettings >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::OptimizationSettings*
+Arena::CreateMaybeMessage< ::RemyBuffers::OptimizationSettings >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::OptimizationSettings >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::Range* Arena::CreateMaybeMessage< ::RemyBuffers::Range >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::Range*
+Arena::CreateMaybeMessage< ::RemyBuffers::Range >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::Range >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::ConfigRange* Arena::CreateMaybeMessage< ::RemyBuffers::ConfigRange >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::ConfigRange*
+Arena::CreateMaybeMessage< ::RemyBuffers::ConfigRange >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::ConfigRange >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::NetConfig* Arena::CreateMaybeMessage< ::RemyBuffers::NetConfig >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::NetConfig*
+Arena::CreateMaybeMessage< ::RemyBuffers::NetConfig >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::NetConfig >(arena);
 }
-template<> PROTOBUF_NOINLINE ::RemyBuffers::ConfigVector* Arena::CreateMaybeMessage< ::RemyBuffers::ConfigVector >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::RemyBuffers::ConfigVector*
+Arena::CreateMaybeMessage< ::RemyBuffers::ConfigVector >(Arena* arena) {
   return Arena::CreateMessageInternal< ::RemyBuffers::ConfigVector >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -44,53 +42,45 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_dna_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[12]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_dna_2eproto;
 namespace RemyBuffers {
 class ConfigRange;
-class ConfigRangeDefaultTypeInternal;
+struct ConfigRangeDefaultTypeInternal;
 extern ConfigRangeDefaultTypeInternal _ConfigRange_default_instance_;
 class ConfigVector;
-class ConfigVectorDefaultTypeInternal;
+struct ConfigVectorDefaultTypeInternal;
 extern ConfigVectorDefaultTypeInternal _ConfigVector_default_instance_;
 class Fin;
-class FinDefaultTypeInternal;
+struct FinDefaultTypeInternal;
 extern FinDefaultTypeInternal _Fin_default_instance_;
 class FinTree;
-class FinTreeDefaultTypeInternal;
+struct FinTreeDefaultTypeInternal;
 extern FinTreeDefaultTypeInternal _FinTree_default_instance_;
 class Memory;
-class MemoryDefaultTypeInternal;
+struct MemoryDefaultTypeInternal;
 extern MemoryDefaultTypeInternal _Memory_default_instance_;
 class MemoryRange;
-class MemoryRangeDefaultTypeInternal;
+struct MemoryRangeDefaultTypeInternal;
 extern MemoryRangeDefaultTypeInternal _MemoryRange_default_instance_;
 class NetConfig;
-class NetConfigDefaultTypeInternal;
+struct NetConfigDefaultTypeInternal;
 extern NetConfigDefaultTypeInternal _NetConfig_default_instance_;
 class OptimizationSetting;
-class OptimizationSettingDefaultTypeInternal;
+struct OptimizationSettingDefaultTypeInternal;
 extern OptimizationSettingDefaultTypeInternal _OptimizationSetting_default_instance_;
 class OptimizationSettings;
-class OptimizationSettingsDefaultTypeInternal;
+struct OptimizationSettingsDefaultTypeInternal;
 extern OptimizationSettingsDefaultTypeInternal _OptimizationSettings_default_instance_;
 class Range;
-class RangeDefaultTypeInternal;
+struct RangeDefaultTypeInternal;
 extern RangeDefaultTypeInternal _Range_default_instance_;
 class Whisker;
-class WhiskerDefaultTypeInternal;
+struct WhiskerDefaultTypeInternal;
 extern WhiskerDefaultTypeInternal _Whisker_default_instance_;
 class WhiskerTree;
-class WhiskerTreeDefaultTypeInternal;
+struct WhiskerTreeDefaultTypeInternal;
 extern WhiskerTreeDefaultTypeInternal _WhiskerTree_default_instance_;
 }  // namespace RemyBuffers
 PROTOBUF_NAMESPACE_OPEN
@@ -135,17 +125,18 @@ inline const std::string& MemoryRange_Axis_Name(T enum_t_value) {
     MemoryRange_Axis_descriptor(), enum_t_value);
 }
 inline bool MemoryRange_Axis_Parse(
-    const std::string& name, MemoryRange_Axis* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MemoryRange_Axis* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MemoryRange_Axis>(
     MemoryRange_Axis_descriptor(), name, value);
 }
 // ===================================================================
 
-class WhiskerTree PROTOBUF_FINAL :
+class WhiskerTree final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.WhiskerTree) */ {
  public:
-  inline WhiskerTree() : WhiskerTree(nullptr) {};
-  virtual ~WhiskerTree();
+  inline WhiskerTree() : WhiskerTree(nullptr) {}
+  ~WhiskerTree() override;
+  explicit PROTOBUF_CONSTEXPR WhiskerTree(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WhiskerTree(const WhiskerTree& from);
   WhiskerTree(WhiskerTree&& from) noexcept
@@ -158,8 +149,13 @@ class WhiskerTree PROTOBUF_FINAL :
     return *this;
   }
   inline WhiskerTree& operator=(WhiskerTree&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -177,14 +173,14 @@ class WhiskerTree PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WhiskerTree& default_instance() {
+    return *internal_default_instance();
   }
-  static const WhiskerTree& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const WhiskerTree* internal_default_instance() {
     return reinterpret_cast<const WhiskerTree*>(
                &_WhiskerTree_default_instance_);
@@ -197,7 +193,12 @@ class WhiskerTree PROTOBUF_FINAL :
   }
   inline void Swap(WhiskerTree* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -205,56 +206,53 @@ class WhiskerTree PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(WhiskerTree* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WhiskerTree* New() const final {
-    return CreateMaybeMessage<WhiskerTree>(nullptr);
-  }
-
-  WhiskerTree* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  WhiskerTree* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WhiskerTree>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WhiskerTree& from);
-  void MergeFrom(const WhiskerTree& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WhiskerTree& from) {
+    WhiskerTree::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WhiskerTree* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.WhiskerTree";
   }
   protected:
-  explicit WhiskerTree(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit WhiskerTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -293,7 +291,7 @@ class WhiskerTree PROTOBUF_FINAL :
   public:
   void clear_domain();
   const ::RemyBuffers::MemoryRange& domain() const;
-  ::RemyBuffers::MemoryRange* release_domain();
+  PROTOBUF_NODISCARD ::RemyBuffers::MemoryRange* release_domain();
   ::RemyBuffers::MemoryRange* mutable_domain();
   void set_allocated_domain(::RemyBuffers::MemoryRange* domain);
   private:
@@ -311,7 +309,7 @@ class WhiskerTree PROTOBUF_FINAL :
   public:
   void clear_leaf();
   const ::RemyBuffers::Whisker& leaf() const;
-  ::RemyBuffers::Whisker* release_leaf();
+  PROTOBUF_NODISCARD ::RemyBuffers::Whisker* release_leaf();
   ::RemyBuffers::Whisker* mutable_leaf();
   void set_allocated_leaf(::RemyBuffers::Whisker* leaf);
   private:
@@ -329,7 +327,7 @@ class WhiskerTree PROTOBUF_FINAL :
   public:
   void clear_config();
   const ::RemyBuffers::ConfigRange& config() const;
-  ::RemyBuffers::ConfigRange* release_config();
+  PROTOBUF_NODISCARD ::RemyBuffers::ConfigRange* release_config();
   ::RemyBuffers::ConfigRange* mutable_config();
   void set_allocated_config(::RemyBuffers::ConfigRange* config);
   private:
@@ -347,7 +345,7 @@ class WhiskerTree PROTOBUF_FINAL :
   public:
   void clear_optimizer();
   const ::RemyBuffers::OptimizationSettings& optimizer() const;
-  ::RemyBuffers::OptimizationSettings* release_optimizer();
+  PROTOBUF_NODISCARD ::RemyBuffers::OptimizationSettings* release_optimizer();
   ::RemyBuffers::OptimizationSettings* mutable_optimizer();
   void set_allocated_optimizer(::RemyBuffers::OptimizationSettings* optimizer);
   private:
@@ -365,7 +363,7 @@ class WhiskerTree PROTOBUF_FINAL :
   public:
   void clear_configvector();
   const ::RemyBuffers::ConfigVector& configvector() const;
-  ::RemyBuffers::ConfigVector* release_configvector();
+  PROTOBUF_NODISCARD ::RemyBuffers::ConfigVector* release_configvector();
   ::RemyBuffers::ConfigVector* mutable_configvector();
   void set_allocated_configvector(::RemyBuffers::ConfigVector* configvector);
   private:
@@ -383,23 +381,27 @@ class WhiskerTree PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::WhiskerTree > children_;
-  ::RemyBuffers::MemoryRange* domain_;
-  ::RemyBuffers::Whisker* leaf_;
-  ::RemyBuffers::ConfigRange* config_;
-  ::RemyBuffers::OptimizationSettings* optimizer_;
-  ::RemyBuffers::ConfigVector* configvector_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::WhiskerTree > children_;
+    ::RemyBuffers::MemoryRange* domain_;
+    ::RemyBuffers::Whisker* leaf_;
+    ::RemyBuffers::ConfigRange* config_;
+    ::RemyBuffers::OptimizationSettings* optimizer_;
+    ::RemyBuffers::ConfigVector* configvector_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FinTree PROTOBUF_FINAL :
+class FinTree final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.FinTree) */ {
  public:
-  inline FinTree() : FinTree(nullptr) {};
-  virtual ~FinTree();
+  inline FinTree() : FinTree(nullptr) {}
+  ~FinTree() override;
+  explicit PROTOBUF_CONSTEXPR FinTree(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FinTree(const FinTree& from);
   FinTree(FinTree&& from) noexcept
@@ -412,8 +414,13 @@ class FinTree PROTOBUF_FINAL :
     return *this;
   }
   inline FinTree& operator=(FinTree&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -431,14 +438,14 @@ class FinTree PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FinTree& default_instance() {
+    return *internal_default_instance();
   }
-  static const FinTree& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const FinTree* internal_default_instance() {
     return reinterpret_cast<const FinTree*>(
                &_FinTree_default_instance_);
@@ -451,7 +458,12 @@ class FinTree PROTOBUF_FINAL :
   }
   inline void Swap(FinTree* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -459,56 +471,53 @@ class FinTree PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(FinTree* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline FinTree* New() const final {
-    return CreateMaybeMessage<FinTree>(nullptr);
-  }
-
-  FinTree* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  FinTree* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FinTree>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const FinTree& from);
-  void MergeFrom(const FinTree& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FinTree& from) {
+    FinTree::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(FinTree* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.FinTree";
   }
   protected:
-  explicit FinTree(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit FinTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -547,7 +556,7 @@ class FinTree PROTOBUF_FINAL :
   public:
   void clear_domain();
   const ::RemyBuffers::MemoryRange& domain() const;
-  ::RemyBuffers::MemoryRange* release_domain();
+  PROTOBUF_NODISCARD ::RemyBuffers::MemoryRange* release_domain();
   ::RemyBuffers::MemoryRange* mutable_domain();
   void set_allocated_domain(::RemyBuffers::MemoryRange* domain);
   private:
@@ -565,7 +574,7 @@ class FinTree PROTOBUF_FINAL :
   public:
   void clear_leaf();
   const ::RemyBuffers::Fin& leaf() const;
-  ::RemyBuffers::Fin* release_leaf();
+  PROTOBUF_NODISCARD ::RemyBuffers::Fin* release_leaf();
   ::RemyBuffers::Fin* mutable_leaf();
   void set_allocated_leaf(::RemyBuffers::Fin* leaf);
   private:
@@ -583,7 +592,7 @@ class FinTree PROTOBUF_FINAL :
   public:
   void clear_config();
   const ::RemyBuffers::ConfigRange& config() const;
-  ::RemyBuffers::ConfigRange* release_config();
+  PROTOBUF_NODISCARD ::RemyBuffers::ConfigRange* release_config();
   ::RemyBuffers::ConfigRange* mutable_config();
   void set_allocated_config(::RemyBuffers::ConfigRange* config);
   private:
@@ -601,7 +610,7 @@ class FinTree PROTOBUF_FINAL :
   public:
   void clear_optimizer();
   const ::RemyBuffers::OptimizationSettings& optimizer() const;
-  ::RemyBuffers::OptimizationSettings* release_optimizer();
+  PROTOBUF_NODISCARD ::RemyBuffers::OptimizationSettings* release_optimizer();
   ::RemyBuffers::OptimizationSettings* mutable_optimizer();
   void set_allocated_optimizer(::RemyBuffers::OptimizationSettings* optimizer);
   private:
@@ -619,7 +628,7 @@ class FinTree PROTOBUF_FINAL :
   public:
   void clear_configvector();
   const ::RemyBuffers::ConfigVector& configvector() const;
-  ::RemyBuffers::ConfigVector* release_configvector();
+  PROTOBUF_NODISCARD ::RemyBuffers::ConfigVector* release_configvector();
   ::RemyBuffers::ConfigVector* mutable_configvector();
   void set_allocated_configvector(::RemyBuffers::ConfigVector* configvector);
   private:
@@ -637,23 +646,27 @@ class FinTree PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::FinTree > children_;
-  ::RemyBuffers::MemoryRange* domain_;
-  ::RemyBuffers::Fin* leaf_;
-  ::RemyBuffers::ConfigRange* config_;
-  ::RemyBuffers::OptimizationSettings* optimizer_;
-  ::RemyBuffers::ConfigVector* configvector_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::FinTree > children_;
+    ::RemyBuffers::MemoryRange* domain_;
+    ::RemyBuffers::Fin* leaf_;
+    ::RemyBuffers::ConfigRange* config_;
+    ::RemyBuffers::OptimizationSettings* optimizer_;
+    ::RemyBuffers::ConfigVector* configvector_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MemoryRange PROTOBUF_FINAL :
+class MemoryRange final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.MemoryRange) */ {
  public:
-  inline MemoryRange() : MemoryRange(nullptr) {};
-  virtual ~MemoryRange();
+  inline MemoryRange() : MemoryRange(nullptr) {}
+  ~MemoryRange() override;
+  explicit PROTOBUF_CONSTEXPR MemoryRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MemoryRange(const MemoryRange& from);
   MemoryRange(MemoryRange&& from) noexcept
@@ -666,8 +679,13 @@ class MemoryRange PROTOBUF_FINAL :
     return *this;
   }
   inline MemoryRange& operator=(MemoryRange&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -685,14 +703,14 @@ class MemoryRange PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MemoryRange& default_instance() {
+    return *internal_default_instance();
   }
-  static const MemoryRange& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const MemoryRange* internal_default_instance() {
     return reinterpret_cast<const MemoryRange*>(
                &_MemoryRange_default_instance_);
@@ -705,7 +723,12 @@ class MemoryRange PROTOBUF_FINAL :
   }
   inline void Swap(MemoryRange* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -713,56 +736,53 @@ class MemoryRange PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(MemoryRange* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline MemoryRange* New() const final {
-    return CreateMaybeMessage<MemoryRange>(nullptr);
-  }
-
-  MemoryRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  MemoryRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<MemoryRange>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MemoryRange& from);
-  void MergeFrom(const MemoryRange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MemoryRange& from) {
+    MemoryRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(MemoryRange* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.MemoryRange";
   }
   protected:
-  explicit MemoryRange(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit MemoryRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -805,7 +825,7 @@ class MemoryRange PROTOBUF_FINAL :
       "Incorrect type passed to function Axis_Name.");
     return MemoryRange_Axis_Name(enum_t_value);
   }
-  static inline bool Axis_Parse(const std::string& name,
+  static inline bool Axis_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Axis* value) {
     return MemoryRange_Axis_Parse(name, value);
   }
@@ -841,7 +861,7 @@ class MemoryRange PROTOBUF_FINAL :
   public:
   void clear_lower();
   const ::RemyBuffers::Memory& lower() const;
-  ::RemyBuffers::Memory* release_lower();
+  PROTOBUF_NODISCARD ::RemyBuffers::Memory* release_lower();
   ::RemyBuffers::Memory* mutable_lower();
   void set_allocated_lower(::RemyBuffers::Memory* lower);
   private:
@@ -859,7 +879,7 @@ class MemoryRange PROTOBUF_FINAL :
   public:
   void clear_upper();
   const ::RemyBuffers::Memory& upper() const;
-  ::RemyBuffers::Memory* release_upper();
+  PROTOBUF_NODISCARD ::RemyBuffers::Memory* release_upper();
   ::RemyBuffers::Memory* mutable_upper();
   void set_allocated_upper(::RemyBuffers::Memory* upper);
   private:
@@ -877,20 +897,24 @@ class MemoryRange PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> active_axis_;
-  ::RemyBuffers::Memory* lower_;
-  ::RemyBuffers::Memory* upper_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> active_axis_;
+    ::RemyBuffers::Memory* lower_;
+    ::RemyBuffers::Memory* upper_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Memory PROTOBUF_FINAL :
+class Memory final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.Memory) */ {
  public:
-  inline Memory() : Memory(nullptr) {};
-  virtual ~Memory();
+  inline Memory() : Memory(nullptr) {}
+  ~Memory() override;
+  explicit PROTOBUF_CONSTEXPR Memory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Memory(const Memory& from);
   Memory(Memory&& from) noexcept
@@ -903,8 +927,13 @@ class Memory PROTOBUF_FINAL :
     return *this;
   }
   inline Memory& operator=(Memory&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -922,14 +951,14 @@ class Memory PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Memory& default_instance() {
+    return *internal_default_instance();
   }
-  static const Memory& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Memory* internal_default_instance() {
     return reinterpret_cast<const Memory*>(
                &_Memory_default_instance_);
@@ -942,7 +971,12 @@ class Memory PROTOBUF_FINAL :
   }
   inline void Swap(Memory* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -950,56 +984,53 @@ class Memory PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Memory* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Memory* New() const final {
-    return CreateMaybeMessage<Memory>(nullptr);
-  }
-
-  Memory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Memory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Memory>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Memory& from);
-  void MergeFrom(const Memory& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Memory& from) {
+    Memory::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Memory* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.Memory";
   }
   protected:
-  explicit Memory(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Memory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1140,26 +1171,30 @@ class Memory PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  double rec_send_ewma_;
-  double rec_rec_ewma_;
-  double rtt_ratio_;
-  double slow_rec_rec_ewma_;
-  double rtt_diff_;
-  double queueing_delay_;
-  double recent_loss_;
-  double int_queue_;
-  double int_link_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double rec_send_ewma_;
+    double rec_rec_ewma_;
+    double rtt_ratio_;
+    double slow_rec_rec_ewma_;
+    double rtt_diff_;
+    double queueing_delay_;
+    double recent_loss_;
+    double int_queue_;
+    double int_link_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Whisker PROTOBUF_FINAL :
+class Whisker final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.Whisker) */ {
  public:
-  inline Whisker() : Whisker(nullptr) {};
-  virtual ~Whisker();
+  inline Whisker() : Whisker(nullptr) {}
+  ~Whisker() override;
+  explicit PROTOBUF_CONSTEXPR Whisker(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Whisker(const Whisker& from);
   Whisker(Whisker&& from) noexcept
@@ -1172,8 +1207,13 @@ class Whisker PROTOBUF_FINAL :
     return *this;
   }
   inline Whisker& operator=(Whisker&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1191,14 +1231,14 @@ class Whisker PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Whisker& default_instance() {
+    return *internal_default_instance();
   }
-  static const Whisker& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Whisker* internal_default_instance() {
     return reinterpret_cast<const Whisker*>(
                &_Whisker_default_instance_);
@@ -1211,7 +1251,12 @@ class Whisker PROTOBUF_FINAL :
   }
   inline void Swap(Whisker* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1219,56 +1264,53 @@ class Whisker PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Whisker* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Whisker* New() const final {
-    return CreateMaybeMessage<Whisker>(nullptr);
-  }
-
-  Whisker* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Whisker* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Whisker>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Whisker& from);
-  void MergeFrom(const Whisker& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Whisker& from) {
+    Whisker::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Whisker* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.Whisker";
   }
   protected:
-  explicit Whisker(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Whisker(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1276,9 +1318,9 @@ class Whisker PROTOBUF_FINAL :
 
   enum : int {
     kDomainFieldNumber = 34,
-    kWindowIncrementFieldNumber = 31,
     kWindowMultipleFieldNumber = 32,
     kIntersendFieldNumber = 33,
+    kWindowIncrementFieldNumber = 31,
   };
   // optional .RemyBuffers.MemoryRange domain = 34;
   bool has_domain() const;
@@ -1287,7 +1329,7 @@ class Whisker PROTOBUF_FINAL :
   public:
   void clear_domain();
   const ::RemyBuffers::MemoryRange& domain() const;
-  ::RemyBuffers::MemoryRange* release_domain();
+  PROTOBUF_NODISCARD ::RemyBuffers::MemoryRange* release_domain();
   ::RemyBuffers::MemoryRange* mutable_domain();
   void set_allocated_domain(::RemyBuffers::MemoryRange* domain);
   private:
@@ -1298,19 +1340,6 @@ class Whisker PROTOBUF_FINAL :
       ::RemyBuffers::MemoryRange* domain);
   ::RemyBuffers::MemoryRange* unsafe_arena_release_domain();
 
-  // optional sint32 window_increment = 31;
-  bool has_window_increment() const;
-  private:
-  bool _internal_has_window_increment() const;
-  public:
-  void clear_window_increment();
-  ::PROTOBUF_NAMESPACE_ID::int32 window_increment() const;
-  void set_window_increment(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_window_increment() const;
-  void _internal_set_window_increment(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
   // optional double window_multiple = 32;
   bool has_window_multiple() const;
   private:
@@ -1337,6 +1366,19 @@ class Whisker PROTOBUF_FINAL :
   void _internal_set_intersend(double value);
   public:
 
+  // optional sint32 window_increment = 31;
+  bool has_window_increment() const;
+  private:
+  bool _internal_has_window_increment() const;
+  public:
+  void clear_window_increment();
+  int32_t window_increment() const;
+  void set_window_increment(int32_t value);
+  private:
+  int32_t _internal_window_increment() const;
+  void _internal_set_window_increment(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:RemyBuffers.Whisker)
  private:
   class _Internal;
@@ -1344,21 +1386,25 @@ class Whisker PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::RemyBuffers::MemoryRange* domain_;
-  ::PROTOBUF_NAMESPACE_ID::int32 window_increment_;
-  double window_multiple_;
-  double intersend_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::RemyBuffers::MemoryRange* domain_;
+    double window_multiple_;
+    double intersend_;
+    int32_t window_increment_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Fin PROTOBUF_FINAL :
+class Fin final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.Fin) */ {
  public:
-  inline Fin() : Fin(nullptr) {};
-  virtual ~Fin();
+  inline Fin() : Fin(nullptr) {}
+  ~Fin() override;
+  explicit PROTOBUF_CONSTEXPR Fin(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Fin(const Fin& from);
   Fin(Fin&& from) noexcept
@@ -1371,8 +1417,13 @@ class Fin PROTOBUF_FINAL :
     return *this;
   }
   inline Fin& operator=(Fin&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1390,14 +1441,14 @@ class Fin PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Fin& default_instance() {
+    return *internal_default_instance();
   }
-  static const Fin& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Fin* internal_default_instance() {
     return reinterpret_cast<const Fin*>(
                &_Fin_default_instance_);
@@ -1410,7 +1461,12 @@ class Fin PROTOBUF_FINAL :
   }
   inline void Swap(Fin* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1418,56 +1474,53 @@ class Fin PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Fin* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Fin* New() const final {
-    return CreateMaybeMessage<Fin>(nullptr);
-  }
-
-  Fin* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Fin* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Fin>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Fin& from);
-  void MergeFrom(const Fin& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Fin& from) {
+    Fin::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Fin* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.Fin";
   }
   protected:
-  explicit Fin(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Fin(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1484,7 +1537,7 @@ class Fin PROTOBUF_FINAL :
   public:
   void clear_domain();
   const ::RemyBuffers::MemoryRange& domain() const;
-  ::RemyBuffers::MemoryRange* release_domain();
+  PROTOBUF_NODISCARD ::RemyBuffers::MemoryRange* release_domain();
   ::RemyBuffers::MemoryRange* mutable_domain();
   void set_allocated_domain(::RemyBuffers::MemoryRange* domain);
   private:
@@ -1515,19 +1568,23 @@ class Fin PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::RemyBuffers::MemoryRange* domain_;
-  double lambda_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::RemyBuffers::MemoryRange* domain_;
+    double lambda_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OptimizationSetting PROTOBUF_FINAL :
+class OptimizationSetting final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.OptimizationSetting) */ {
  public:
-  inline OptimizationSetting() : OptimizationSetting(nullptr) {};
-  virtual ~OptimizationSetting();
+  inline OptimizationSetting() : OptimizationSetting(nullptr) {}
+  ~OptimizationSetting() override;
+  explicit PROTOBUF_CONSTEXPR OptimizationSetting(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   OptimizationSetting(const OptimizationSetting& from);
   OptimizationSetting(OptimizationSetting&& from) noexcept
@@ -1540,8 +1597,13 @@ class OptimizationSetting PROTOBUF_FINAL :
     return *this;
   }
   inline OptimizationSetting& operator=(OptimizationSetting&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1559,14 +1621,14 @@ class OptimizationSetting PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OptimizationSetting& default_instance() {
+    return *internal_default_instance();
   }
-  static const OptimizationSetting& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const OptimizationSetting* internal_default_instance() {
     return reinterpret_cast<const OptimizationSetting*>(
                &_OptimizationSetting_default_instance_);
@@ -1579,7 +1641,12 @@ class OptimizationSetting PROTOBUF_FINAL :
   }
   inline void Swap(OptimizationSetting* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1587,56 +1654,53 @@ class OptimizationSetting PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(OptimizationSetting* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline OptimizationSetting* New() const final {
-    return CreateMaybeMessage<OptimizationSetting>(nullptr);
-  }
-
-  OptimizationSetting* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  OptimizationSetting* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<OptimizationSetting>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const OptimizationSetting& from);
-  void MergeFrom(const OptimizationSetting& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OptimizationSetting& from) {
+    OptimizationSetting::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(OptimizationSetting* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.OptimizationSetting";
   }
   protected:
-  explicit OptimizationSetting(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit OptimizationSetting(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1735,23 +1799,27 @@ class OptimizationSetting PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  double min_value_;
-  double max_value_;
-  double min_change_;
-  double max_change_;
-  double multiplier_;
-  double default_value_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double min_value_;
+    double max_value_;
+    double min_change_;
+    double max_change_;
+    double multiplier_;
+    double default_value_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OptimizationSettings PROTOBUF_FINAL :
+class OptimizationSettings final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.OptimizationSettings) */ {
  public:
-  inline OptimizationSettings() : OptimizationSettings(nullptr) {};
-  virtual ~OptimizationSettings();
+  inline OptimizationSettings() : OptimizationSettings(nullptr) {}
+  ~OptimizationSettings() override;
+  explicit PROTOBUF_CONSTEXPR OptimizationSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   OptimizationSettings(const OptimizationSettings& from);
   OptimizationSettings(OptimizationSettings&& from) noexcept
@@ -1764,8 +1832,13 @@ class OptimizationSettings PROTOBUF_FINAL :
     return *this;
   }
   inline OptimizationSettings& operator=(OptimizationSettings&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1783,14 +1856,14 @@ class OptimizationSettings PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OptimizationSettings& default_instance() {
+    return *internal_default_instance();
   }
-  static const OptimizationSettings& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const OptimizationSettings* internal_default_instance() {
     return reinterpret_cast<const OptimizationSettings*>(
                &_OptimizationSettings_default_instance_);
@@ -1803,7 +1876,12 @@ class OptimizationSettings PROTOBUF_FINAL :
   }
   inline void Swap(OptimizationSettings* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1811,56 +1889,53 @@ class OptimizationSettings PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(OptimizationSettings* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline OptimizationSettings* New() const final {
-    return CreateMaybeMessage<OptimizationSettings>(nullptr);
-  }
-
-  OptimizationSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  OptimizationSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<OptimizationSettings>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const OptimizationSettings& from);
-  void MergeFrom(const OptimizationSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OptimizationSettings& from) {
+    OptimizationSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(OptimizationSettings* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.OptimizationSettings";
   }
   protected:
-  explicit OptimizationSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit OptimizationSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1879,7 +1954,7 @@ class OptimizationSettings PROTOBUF_FINAL :
   public:
   void clear_window_increment();
   const ::RemyBuffers::OptimizationSetting& window_increment() const;
-  ::RemyBuffers::OptimizationSetting* release_window_increment();
+  PROTOBUF_NODISCARD ::RemyBuffers::OptimizationSetting* release_window_increment();
   ::RemyBuffers::OptimizationSetting* mutable_window_increment();
   void set_allocated_window_increment(::RemyBuffers::OptimizationSetting* window_increment);
   private:
@@ -1897,7 +1972,7 @@ class OptimizationSettings PROTOBUF_FINAL :
   public:
   void clear_window_multiple();
   const ::RemyBuffers::OptimizationSetting& window_multiple() const;
-  ::RemyBuffers::OptimizationSetting* release_window_multiple();
+  PROTOBUF_NODISCARD ::RemyBuffers::OptimizationSetting* release_window_multiple();
   ::RemyBuffers::OptimizationSetting* mutable_window_multiple();
   void set_allocated_window_multiple(::RemyBuffers::OptimizationSetting* window_multiple);
   private:
@@ -1915,7 +1990,7 @@ class OptimizationSettings PROTOBUF_FINAL :
   public:
   void clear_intersend();
   const ::RemyBuffers::OptimizationSetting& intersend() const;
-  ::RemyBuffers::OptimizationSetting* release_intersend();
+  PROTOBUF_NODISCARD ::RemyBuffers::OptimizationSetting* release_intersend();
   ::RemyBuffers::OptimizationSetting* mutable_intersend();
   void set_allocated_intersend(::RemyBuffers::OptimizationSetting* intersend);
   private:
@@ -1933,7 +2008,7 @@ class OptimizationSettings PROTOBUF_FINAL :
   public:
   void clear_lambda();
   const ::RemyBuffers::OptimizationSetting& lambda() const;
-  ::RemyBuffers::OptimizationSetting* release_lambda();
+  PROTOBUF_NODISCARD ::RemyBuffers::OptimizationSetting* release_lambda();
   ::RemyBuffers::OptimizationSetting* mutable_lambda();
   void set_allocated_lambda(::RemyBuffers::OptimizationSetting* lambda);
   private:
@@ -1951,21 +2026,25 @@ class OptimizationSettings PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::RemyBuffers::OptimizationSetting* window_increment_;
-  ::RemyBuffers::OptimizationSetting* window_multiple_;
-  ::RemyBuffers::OptimizationSetting* intersend_;
-  ::RemyBuffers::OptimizationSetting* lambda_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::RemyBuffers::OptimizationSetting* window_increment_;
+    ::RemyBuffers::OptimizationSetting* window_multiple_;
+    ::RemyBuffers::OptimizationSetting* intersend_;
+    ::RemyBuffers::OptimizationSetting* lambda_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Range PROTOBUF_FINAL :
+class Range final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.Range) */ {
  public:
-  inline Range() : Range(nullptr) {};
-  virtual ~Range();
+  inline Range() : Range(nullptr) {}
+  ~Range() override;
+  explicit PROTOBUF_CONSTEXPR Range(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Range(const Range& from);
   Range(Range&& from) noexcept
@@ -1978,8 +2057,13 @@ class Range PROTOBUF_FINAL :
     return *this;
   }
   inline Range& operator=(Range&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1997,14 +2081,14 @@ class Range PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Range& default_instance() {
+    return *internal_default_instance();
   }
-  static const Range& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Range* internal_default_instance() {
     return reinterpret_cast<const Range*>(
                &_Range_default_instance_);
@@ -2017,7 +2101,12 @@ class Range PROTOBUF_FINAL :
   }
   inline void Swap(Range* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2025,56 +2114,53 @@ class Range PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Range* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Range* New() const final {
-    return CreateMaybeMessage<Range>(nullptr);
-  }
-
-  Range* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Range* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Range>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Range& from);
-  void MergeFrom(const Range& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Range& from) {
+    Range::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Range* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.Range";
   }
   protected:
-  explicit Range(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Range(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2131,20 +2217,24 @@ class Range PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  double low_;
-  double high_;
-  double incr_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double low_;
+    double high_;
+    double incr_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfigRange PROTOBUF_FINAL :
+class ConfigRange final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.ConfigRange) */ {
  public:
-  inline ConfigRange() : ConfigRange(nullptr) {};
-  virtual ~ConfigRange();
+  inline ConfigRange() : ConfigRange(nullptr) {}
+  ~ConfigRange() override;
+  explicit PROTOBUF_CONSTEXPR ConfigRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ConfigRange(const ConfigRange& from);
   ConfigRange(ConfigRange&& from) noexcept
@@ -2157,8 +2247,13 @@ class ConfigRange PROTOBUF_FINAL :
     return *this;
   }
   inline ConfigRange& operator=(ConfigRange&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2176,14 +2271,14 @@ class ConfigRange PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfigRange& default_instance() {
+    return *internal_default_instance();
   }
-  static const ConfigRange& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ConfigRange* internal_default_instance() {
     return reinterpret_cast<const ConfigRange*>(
                &_ConfigRange_default_instance_);
@@ -2196,7 +2291,12 @@ class ConfigRange PROTOBUF_FINAL :
   }
   inline void Swap(ConfigRange* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2204,56 +2304,53 @@ class ConfigRange PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ConfigRange* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ConfigRange* New() const final {
-    return CreateMaybeMessage<ConfigRange>(nullptr);
-  }
-
-  ConfigRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ConfigRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ConfigRange>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ConfigRange& from);
-  void MergeFrom(const ConfigRange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfigRange& from) {
+    ConfigRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ConfigRange* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.ConfigRange";
   }
   protected:
-  explicit ConfigRange(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ConfigRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2276,7 +2373,7 @@ class ConfigRange PROTOBUF_FINAL :
   public:
   void clear_link_packets_per_ms();
   const ::RemyBuffers::Range& link_packets_per_ms() const;
-  ::RemyBuffers::Range* release_link_packets_per_ms();
+  PROTOBUF_NODISCARD ::RemyBuffers::Range* release_link_packets_per_ms();
   ::RemyBuffers::Range* mutable_link_packets_per_ms();
   void set_allocated_link_packets_per_ms(::RemyBuffers::Range* link_packets_per_ms);
   private:
@@ -2294,7 +2391,7 @@ class ConfigRange PROTOBUF_FINAL :
   public:
   void clear_rtt();
   const ::RemyBuffers::Range& rtt() const;
-  ::RemyBuffers::Range* release_rtt();
+  PROTOBUF_NODISCARD ::RemyBuffers::Range* release_rtt();
   ::RemyBuffers::Range* mutable_rtt();
   void set_allocated_rtt(::RemyBuffers::Range* rtt);
   private:
@@ -2312,7 +2409,7 @@ class ConfigRange PROTOBUF_FINAL :
   public:
   void clear_num_senders();
   const ::RemyBuffers::Range& num_senders() const;
-  ::RemyBuffers::Range* release_num_senders();
+  PROTOBUF_NODISCARD ::RemyBuffers::Range* release_num_senders();
   ::RemyBuffers::Range* mutable_num_senders();
   void set_allocated_num_senders(::RemyBuffers::Range* num_senders);
   private:
@@ -2330,7 +2427,7 @@ class ConfigRange PROTOBUF_FINAL :
   public:
   void clear_buffer_size();
   const ::RemyBuffers::Range& buffer_size() const;
-  ::RemyBuffers::Range* release_buffer_size();
+  PROTOBUF_NODISCARD ::RemyBuffers::Range* release_buffer_size();
   ::RemyBuffers::Range* mutable_buffer_size();
   void set_allocated_buffer_size(::RemyBuffers::Range* buffer_size);
   private:
@@ -2348,7 +2445,7 @@ class ConfigRange PROTOBUF_FINAL :
   public:
   void clear_mean_off_duration();
   const ::RemyBuffers::Range& mean_off_duration() const;
-  ::RemyBuffers::Range* release_mean_off_duration();
+  PROTOBUF_NODISCARD ::RemyBuffers::Range* release_mean_off_duration();
   ::RemyBuffers::Range* mutable_mean_off_duration();
   void set_allocated_mean_off_duration(::RemyBuffers::Range* mean_off_duration);
   private:
@@ -2366,7 +2463,7 @@ class ConfigRange PROTOBUF_FINAL :
   public:
   void clear_mean_on_duration();
   const ::RemyBuffers::Range& mean_on_duration() const;
-  ::RemyBuffers::Range* release_mean_on_duration();
+  PROTOBUF_NODISCARD ::RemyBuffers::Range* release_mean_on_duration();
   ::RemyBuffers::Range* mutable_mean_on_duration();
   void set_allocated_mean_on_duration(::RemyBuffers::Range* mean_on_duration);
   private:
@@ -2384,7 +2481,7 @@ class ConfigRange PROTOBUF_FINAL :
   public:
   void clear_stochastic_loss_rate();
   const ::RemyBuffers::Range& stochastic_loss_rate() const;
-  ::RemyBuffers::Range* release_stochastic_loss_rate();
+  PROTOBUF_NODISCARD ::RemyBuffers::Range* release_stochastic_loss_rate();
   ::RemyBuffers::Range* mutable_stochastic_loss_rate();
   void set_allocated_stochastic_loss_rate(::RemyBuffers::Range* stochastic_loss_rate);
   private:
@@ -2401,11 +2498,11 @@ class ConfigRange PROTOBUF_FINAL :
   bool _internal_has_simulation_ticks() const;
   public:
   void clear_simulation_ticks();
-  ::PROTOBUF_NAMESPACE_ID::uint32 simulation_ticks() const;
-  void set_simulation_ticks(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t simulation_ticks() const;
+  void set_simulation_ticks(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_simulation_ticks() const;
-  void _internal_set_simulation_ticks(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_simulation_ticks() const;
+  void _internal_set_simulation_ticks(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:RemyBuffers.ConfigRange)
@@ -2415,25 +2512,29 @@ class ConfigRange PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::RemyBuffers::Range* link_packets_per_ms_;
-  ::RemyBuffers::Range* rtt_;
-  ::RemyBuffers::Range* num_senders_;
-  ::RemyBuffers::Range* buffer_size_;
-  ::RemyBuffers::Range* mean_off_duration_;
-  ::RemyBuffers::Range* mean_on_duration_;
-  ::RemyBuffers::Range* stochastic_loss_rate_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 simulation_ticks_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::RemyBuffers::Range* link_packets_per_ms_;
+    ::RemyBuffers::Range* rtt_;
+    ::RemyBuffers::Range* num_senders_;
+    ::RemyBuffers::Range* buffer_size_;
+    ::RemyBuffers::Range* mean_off_duration_;
+    ::RemyBuffers::Range* mean_on_duration_;
+    ::RemyBuffers::Range* stochastic_loss_rate_;
+    uint32_t simulation_ticks_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NetConfig PROTOBUF_FINAL :
+class NetConfig final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.NetConfig) */ {
  public:
-  inline NetConfig() : NetConfig(nullptr) {};
-  virtual ~NetConfig();
+  inline NetConfig() : NetConfig(nullptr) {}
+  ~NetConfig() override;
+  explicit PROTOBUF_CONSTEXPR NetConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NetConfig(const NetConfig& from);
   NetConfig(NetConfig&& from) noexcept
@@ -2446,8 +2547,13 @@ class NetConfig PROTOBUF_FINAL :
     return *this;
   }
   inline NetConfig& operator=(NetConfig&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2465,14 +2571,14 @@ class NetConfig PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NetConfig& default_instance() {
+    return *internal_default_instance();
   }
-  static const NetConfig& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NetConfig* internal_default_instance() {
     return reinterpret_cast<const NetConfig*>(
                &_NetConfig_default_instance_);
@@ -2485,7 +2591,12 @@ class NetConfig PROTOBUF_FINAL :
   }
   inline void Swap(NetConfig* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2493,56 +2604,53 @@ class NetConfig PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(NetConfig* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NetConfig* New() const final {
-    return CreateMaybeMessage<NetConfig>(nullptr);
-  }
-
-  NetConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NetConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NetConfig>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NetConfig& from);
-  void MergeFrom(const NetConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NetConfig& from) {
+    NetConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NetConfig* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.NetConfig";
   }
   protected:
-  explicit NetConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit NetConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2602,11 +2710,11 @@ class NetConfig PROTOBUF_FINAL :
   bool _internal_has_num_senders() const;
   public:
   void clear_num_senders();
-  ::PROTOBUF_NAMESPACE_ID::uint32 num_senders() const;
-  void set_num_senders(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t num_senders() const;
+  void set_num_senders(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_num_senders() const;
-  void _internal_set_num_senders(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_num_senders() const;
+  void _internal_set_num_senders(uint32_t value);
   public:
 
   // optional uint32 buffer_size = 6;
@@ -2615,11 +2723,11 @@ class NetConfig PROTOBUF_FINAL :
   bool _internal_has_buffer_size() const;
   public:
   void clear_buffer_size();
-  ::PROTOBUF_NAMESPACE_ID::uint32 buffer_size() const;
-  void set_buffer_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t buffer_size() const;
+  void set_buffer_size(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_buffer_size() const;
-  void _internal_set_buffer_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_buffer_size() const;
+  void _internal_set_buffer_size(uint32_t value);
   public:
 
   // optional double delay = 5;
@@ -2655,24 +2763,28 @@ class NetConfig PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  double mean_on_duration_;
-  double mean_off_duration_;
-  double link_ppt_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 num_senders_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 buffer_size_;
-  double delay_;
-  double stochastic_loss_rate_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double mean_on_duration_;
+    double mean_off_duration_;
+    double link_ppt_;
+    uint32_t num_senders_;
+    uint32_t buffer_size_;
+    double delay_;
+    double stochastic_loss_rate_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfigVector PROTOBUF_FINAL :
+class ConfigVector final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RemyBuffers.ConfigVector) */ {
  public:
-  inline ConfigVector() : ConfigVector(nullptr) {};
-  virtual ~ConfigVector();
+  inline ConfigVector() : ConfigVector(nullptr) {}
+  ~ConfigVector() override;
+  explicit PROTOBUF_CONSTEXPR ConfigVector(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ConfigVector(const ConfigVector& from);
   ConfigVector(ConfigVector&& from) noexcept
@@ -2685,8 +2797,13 @@ class ConfigVector PROTOBUF_FINAL :
     return *this;
   }
   inline ConfigVector& operator=(ConfigVector&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2704,14 +2821,14 @@ class ConfigVector PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfigVector& default_instance() {
+    return *internal_default_instance();
   }
-  static const ConfigVector& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ConfigVector* internal_default_instance() {
     return reinterpret_cast<const ConfigVector*>(
                &_ConfigVector_default_instance_);
@@ -2724,7 +2841,12 @@ class ConfigVector PROTOBUF_FINAL :
   }
   inline void Swap(ConfigVector* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2732,56 +2854,53 @@ class ConfigVector PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ConfigVector* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ConfigVector* New() const final {
-    return CreateMaybeMessage<ConfigVector>(nullptr);
-  }
-
-  ConfigVector* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ConfigVector* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ConfigVector>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ConfigVector& from);
-  void MergeFrom(const ConfigVector& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfigVector& from) {
+    ConfigVector::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ConfigVector* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RemyBuffers.ConfigVector";
   }
   protected:
-  explicit ConfigVector(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ConfigVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_dna_2eproto);
-    return ::descriptor_table_dna_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2815,8 +2934,11 @@ class ConfigVector PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::NetConfig > config_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::NetConfig > config_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_dna_2eproto;
 };
 // ===================================================================
@@ -2832,21 +2954,21 @@ class ConfigVector PROTOBUF_FINAL :
 
 // optional .RemyBuffers.MemoryRange domain = 1;
 inline bool WhiskerTree::_internal_has_domain() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || domain_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.domain_ != nullptr);
   return value;
 }
 inline bool WhiskerTree::has_domain() const {
   return _internal_has_domain();
 }
 inline void WhiskerTree::clear_domain() {
-  if (domain_ != nullptr) domain_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.domain_ != nullptr) _impl_.domain_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::RemyBuffers::MemoryRange& WhiskerTree::_internal_domain() const {
-  const ::RemyBuffers::MemoryRange* p = domain_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::MemoryRange*>(
-      &::RemyBuffers::_MemoryRange_default_instance_);
+  const ::RemyBuffers::MemoryRange* p = _impl_.domain_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::MemoryRange&>(
+      ::RemyBuffers::_MemoryRange_default_instance_);
 }
 inline const ::RemyBuffers::MemoryRange& WhiskerTree::domain() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.WhiskerTree.domain)
@@ -2854,119 +2976,129 @@ inline const ::RemyBuffers::MemoryRange& WhiskerTree::domain() const {
 }
 inline void WhiskerTree::unsafe_arena_set_allocated_domain(
     ::RemyBuffers::MemoryRange* domain) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(domain_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.domain_);
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   if (domain) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.WhiskerTree.domain)
 }
 inline ::RemyBuffers::MemoryRange* WhiskerTree::release_domain() {
-  auto temp = unsafe_arena_release_domain();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* WhiskerTree::unsafe_arena_release_domain() {
   // @@protoc_insertion_point(field_release:RemyBuffers.WhiskerTree.domain)
-  _has_bits_[0] &= ~0x00000001u;
-  ::RemyBuffers::MemoryRange* temp = domain_;
-  domain_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* WhiskerTree::_internal_mutable_domain() {
-  _has_bits_[0] |= 0x00000001u;
-  if (domain_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArena());
-    domain_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.domain_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArenaForAllocation());
+    _impl_.domain_ = p;
   }
-  return domain_;
+  return _impl_.domain_;
 }
 inline ::RemyBuffers::MemoryRange* WhiskerTree::mutable_domain() {
+  ::RemyBuffers::MemoryRange* _msg = _internal_mutable_domain();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.WhiskerTree.domain)
-  return _internal_mutable_domain();
+  return _msg;
 }
 inline void WhiskerTree::set_allocated_domain(::RemyBuffers::MemoryRange* domain) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete domain_;
+    delete _impl_.domain_;
   }
   if (domain) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(domain);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(domain);
     if (message_arena != submessage_arena) {
       domain = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, domain, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.WhiskerTree.domain)
 }
 
 // repeated .RemyBuffers.WhiskerTree children = 2;
 inline int WhiskerTree::_internal_children_size() const {
-  return children_.size();
+  return _impl_.children_.size();
 }
 inline int WhiskerTree::children_size() const {
   return _internal_children_size();
 }
 inline void WhiskerTree::clear_children() {
-  children_.Clear();
+  _impl_.children_.Clear();
 }
 inline ::RemyBuffers::WhiskerTree* WhiskerTree::mutable_children(int index) {
   // @@protoc_insertion_point(field_mutable:RemyBuffers.WhiskerTree.children)
-  return children_.Mutable(index);
+  return _impl_.children_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::WhiskerTree >*
 WhiskerTree::mutable_children() {
   // @@protoc_insertion_point(field_mutable_list:RemyBuffers.WhiskerTree.children)
-  return &children_;
+  return &_impl_.children_;
 }
 inline const ::RemyBuffers::WhiskerTree& WhiskerTree::_internal_children(int index) const {
-  return children_.Get(index);
+  return _impl_.children_.Get(index);
 }
 inline const ::RemyBuffers::WhiskerTree& WhiskerTree::children(int index) const {
   // @@protoc_insertion_point(field_get:RemyBuffers.WhiskerTree.children)
   return _internal_children(index);
 }
 inline ::RemyBuffers::WhiskerTree* WhiskerTree::_internal_add_children() {
-  return children_.Add();
+  return _impl_.children_.Add();
 }
 inline ::RemyBuffers::WhiskerTree* WhiskerTree::add_children() {
+  ::RemyBuffers::WhiskerTree* _add = _internal_add_children();
   // @@protoc_insertion_point(field_add:RemyBuffers.WhiskerTree.children)
-  return _internal_add_children();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::WhiskerTree >&
 WhiskerTree::children() const {
   // @@protoc_insertion_point(field_list:RemyBuffers.WhiskerTree.children)
-  return children_;
+  return _impl_.children_;
 }
 
 // optional .RemyBuffers.Whisker leaf = 3;
 inline bool WhiskerTree::_internal_has_leaf() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || leaf_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.leaf_ != nullptr);
   return value;
 }
 inline bool WhiskerTree::has_leaf() const {
   return _internal_has_leaf();
 }
 inline void WhiskerTree::clear_leaf() {
-  if (leaf_ != nullptr) leaf_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.leaf_ != nullptr) _impl_.leaf_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const ::RemyBuffers::Whisker& WhiskerTree::_internal_leaf() const {
-  const ::RemyBuffers::Whisker* p = leaf_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Whisker*>(
-      &::RemyBuffers::_Whisker_default_instance_);
+  const ::RemyBuffers::Whisker* p = _impl_.leaf_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Whisker&>(
+      ::RemyBuffers::_Whisker_default_instance_);
 }
 inline const ::RemyBuffers::Whisker& WhiskerTree::leaf() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.WhiskerTree.leaf)
@@ -2974,80 +3106,89 @@ inline const ::RemyBuffers::Whisker& WhiskerTree::leaf() const {
 }
 inline void WhiskerTree::unsafe_arena_set_allocated_leaf(
     ::RemyBuffers::Whisker* leaf) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(leaf_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leaf_);
   }
-  leaf_ = leaf;
+  _impl_.leaf_ = leaf;
   if (leaf) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.WhiskerTree.leaf)
 }
 inline ::RemyBuffers::Whisker* WhiskerTree::release_leaf() {
-  auto temp = unsafe_arena_release_leaf();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Whisker* temp = _impl_.leaf_;
+  _impl_.leaf_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Whisker* WhiskerTree::unsafe_arena_release_leaf() {
   // @@protoc_insertion_point(field_release:RemyBuffers.WhiskerTree.leaf)
-  _has_bits_[0] &= ~0x00000002u;
-  ::RemyBuffers::Whisker* temp = leaf_;
-  leaf_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Whisker* temp = _impl_.leaf_;
+  _impl_.leaf_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Whisker* WhiskerTree::_internal_mutable_leaf() {
-  _has_bits_[0] |= 0x00000002u;
-  if (leaf_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Whisker>(GetArena());
-    leaf_ = p;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.leaf_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Whisker>(GetArenaForAllocation());
+    _impl_.leaf_ = p;
   }
-  return leaf_;
+  return _impl_.leaf_;
 }
 inline ::RemyBuffers::Whisker* WhiskerTree::mutable_leaf() {
+  ::RemyBuffers::Whisker* _msg = _internal_mutable_leaf();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.WhiskerTree.leaf)
-  return _internal_mutable_leaf();
+  return _msg;
 }
 inline void WhiskerTree::set_allocated_leaf(::RemyBuffers::Whisker* leaf) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete leaf_;
+    delete _impl_.leaf_;
   }
   if (leaf) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(leaf);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(leaf);
     if (message_arena != submessage_arena) {
       leaf = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, leaf, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  leaf_ = leaf;
+  _impl_.leaf_ = leaf;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.WhiskerTree.leaf)
 }
 
 // optional .RemyBuffers.ConfigRange config = 4;
 inline bool WhiskerTree::_internal_has_config() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
-  PROTOBUF_ASSUME(!value || config_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.config_ != nullptr);
   return value;
 }
 inline bool WhiskerTree::has_config() const {
   return _internal_has_config();
 }
 inline void WhiskerTree::clear_config() {
-  if (config_ != nullptr) config_->Clear();
-  _has_bits_[0] &= ~0x00000004u;
+  if (_impl_.config_ != nullptr) _impl_.config_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const ::RemyBuffers::ConfigRange& WhiskerTree::_internal_config() const {
-  const ::RemyBuffers::ConfigRange* p = config_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::ConfigRange*>(
-      &::RemyBuffers::_ConfigRange_default_instance_);
+  const ::RemyBuffers::ConfigRange* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::ConfigRange&>(
+      ::RemyBuffers::_ConfigRange_default_instance_);
 }
 inline const ::RemyBuffers::ConfigRange& WhiskerTree::config() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.WhiskerTree.config)
@@ -3055,80 +3196,89 @@ inline const ::RemyBuffers::ConfigRange& WhiskerTree::config() const {
 }
 inline void WhiskerTree::unsafe_arena_set_allocated_config(
     ::RemyBuffers::ConfigRange* config) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(config_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
   }
-  config_ = config;
+  _impl_.config_ = config;
   if (config) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.WhiskerTree.config)
 }
 inline ::RemyBuffers::ConfigRange* WhiskerTree::release_config() {
-  auto temp = unsafe_arena_release_config();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::ConfigRange* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::ConfigRange* WhiskerTree::unsafe_arena_release_config() {
   // @@protoc_insertion_point(field_release:RemyBuffers.WhiskerTree.config)
-  _has_bits_[0] &= ~0x00000004u;
-  ::RemyBuffers::ConfigRange* temp = config_;
-  config_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::ConfigRange* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::ConfigRange* WhiskerTree::_internal_mutable_config() {
-  _has_bits_[0] |= 0x00000004u;
-  if (config_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigRange>(GetArena());
-    config_ = p;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigRange>(GetArenaForAllocation());
+    _impl_.config_ = p;
   }
-  return config_;
+  return _impl_.config_;
 }
 inline ::RemyBuffers::ConfigRange* WhiskerTree::mutable_config() {
+  ::RemyBuffers::ConfigRange* _msg = _internal_mutable_config();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.WhiskerTree.config)
-  return _internal_mutable_config();
+  return _msg;
 }
 inline void WhiskerTree::set_allocated_config(::RemyBuffers::ConfigRange* config) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete config_;
+    delete _impl_.config_;
   }
   if (config) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(config);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
     if (message_arena != submessage_arena) {
       config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, config, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  config_ = config;
+  _impl_.config_ = config;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.WhiskerTree.config)
 }
 
 // optional .RemyBuffers.OptimizationSettings optimizer = 5;
 inline bool WhiskerTree::_internal_has_optimizer() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
-  PROTOBUF_ASSUME(!value || optimizer_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optimizer_ != nullptr);
   return value;
 }
 inline bool WhiskerTree::has_optimizer() const {
   return _internal_has_optimizer();
 }
 inline void WhiskerTree::clear_optimizer() {
-  if (optimizer_ != nullptr) optimizer_->Clear();
-  _has_bits_[0] &= ~0x00000008u;
+  if (_impl_.optimizer_ != nullptr) _impl_.optimizer_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const ::RemyBuffers::OptimizationSettings& WhiskerTree::_internal_optimizer() const {
-  const ::RemyBuffers::OptimizationSettings* p = optimizer_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::OptimizationSettings*>(
-      &::RemyBuffers::_OptimizationSettings_default_instance_);
+  const ::RemyBuffers::OptimizationSettings* p = _impl_.optimizer_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::OptimizationSettings&>(
+      ::RemyBuffers::_OptimizationSettings_default_instance_);
 }
 inline const ::RemyBuffers::OptimizationSettings& WhiskerTree::optimizer() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.WhiskerTree.optimizer)
@@ -3136,80 +3286,89 @@ inline const ::RemyBuffers::OptimizationSettings& WhiskerTree::optimizer() const
 }
 inline void WhiskerTree::unsafe_arena_set_allocated_optimizer(
     ::RemyBuffers::OptimizationSettings* optimizer) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optimizer_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.optimizer_);
   }
-  optimizer_ = optimizer;
+  _impl_.optimizer_ = optimizer;
   if (optimizer) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.WhiskerTree.optimizer)
 }
 inline ::RemyBuffers::OptimizationSettings* WhiskerTree::release_optimizer() {
-  auto temp = unsafe_arena_release_optimizer();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::OptimizationSettings* temp = _impl_.optimizer_;
+  _impl_.optimizer_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::OptimizationSettings* WhiskerTree::unsafe_arena_release_optimizer() {
   // @@protoc_insertion_point(field_release:RemyBuffers.WhiskerTree.optimizer)
-  _has_bits_[0] &= ~0x00000008u;
-  ::RemyBuffers::OptimizationSettings* temp = optimizer_;
-  optimizer_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::OptimizationSettings* temp = _impl_.optimizer_;
+  _impl_.optimizer_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::OptimizationSettings* WhiskerTree::_internal_mutable_optimizer() {
-  _has_bits_[0] |= 0x00000008u;
-  if (optimizer_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSettings>(GetArena());
-    optimizer_ = p;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.optimizer_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSettings>(GetArenaForAllocation());
+    _impl_.optimizer_ = p;
   }
-  return optimizer_;
+  return _impl_.optimizer_;
 }
 inline ::RemyBuffers::OptimizationSettings* WhiskerTree::mutable_optimizer() {
+  ::RemyBuffers::OptimizationSettings* _msg = _internal_mutable_optimizer();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.WhiskerTree.optimizer)
-  return _internal_mutable_optimizer();
+  return _msg;
 }
 inline void WhiskerTree::set_allocated_optimizer(::RemyBuffers::OptimizationSettings* optimizer) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete optimizer_;
+    delete _impl_.optimizer_;
   }
   if (optimizer) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(optimizer);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(optimizer);
     if (message_arena != submessage_arena) {
       optimizer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, optimizer, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  optimizer_ = optimizer;
+  _impl_.optimizer_ = optimizer;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.WhiskerTree.optimizer)
 }
 
 // optional .RemyBuffers.ConfigVector configvector = 6;
 inline bool WhiskerTree::_internal_has_configvector() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
-  PROTOBUF_ASSUME(!value || configvector_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.configvector_ != nullptr);
   return value;
 }
 inline bool WhiskerTree::has_configvector() const {
   return _internal_has_configvector();
 }
 inline void WhiskerTree::clear_configvector() {
-  if (configvector_ != nullptr) configvector_->Clear();
-  _has_bits_[0] &= ~0x00000010u;
+  if (_impl_.configvector_ != nullptr) _impl_.configvector_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const ::RemyBuffers::ConfigVector& WhiskerTree::_internal_configvector() const {
-  const ::RemyBuffers::ConfigVector* p = configvector_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::ConfigVector*>(
-      &::RemyBuffers::_ConfigVector_default_instance_);
+  const ::RemyBuffers::ConfigVector* p = _impl_.configvector_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::ConfigVector&>(
+      ::RemyBuffers::_ConfigVector_default_instance_);
 }
 inline const ::RemyBuffers::ConfigVector& WhiskerTree::configvector() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.WhiskerTree.configvector)
@@ -3217,60 +3376,69 @@ inline const ::RemyBuffers::ConfigVector& WhiskerTree::configvector() const {
 }
 inline void WhiskerTree::unsafe_arena_set_allocated_configvector(
     ::RemyBuffers::ConfigVector* configvector) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(configvector_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.configvector_);
   }
-  configvector_ = configvector;
+  _impl_.configvector_ = configvector;
   if (configvector) {
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.WhiskerTree.configvector)
 }
 inline ::RemyBuffers::ConfigVector* WhiskerTree::release_configvector() {
-  auto temp = unsafe_arena_release_configvector();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::RemyBuffers::ConfigVector* temp = _impl_.configvector_;
+  _impl_.configvector_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::ConfigVector* WhiskerTree::unsafe_arena_release_configvector() {
   // @@protoc_insertion_point(field_release:RemyBuffers.WhiskerTree.configvector)
-  _has_bits_[0] &= ~0x00000010u;
-  ::RemyBuffers::ConfigVector* temp = configvector_;
-  configvector_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::RemyBuffers::ConfigVector* temp = _impl_.configvector_;
+  _impl_.configvector_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::ConfigVector* WhiskerTree::_internal_mutable_configvector() {
-  _has_bits_[0] |= 0x00000010u;
-  if (configvector_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigVector>(GetArena());
-    configvector_ = p;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.configvector_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigVector>(GetArenaForAllocation());
+    _impl_.configvector_ = p;
   }
-  return configvector_;
+  return _impl_.configvector_;
 }
 inline ::RemyBuffers::ConfigVector* WhiskerTree::mutable_configvector() {
+  ::RemyBuffers::ConfigVector* _msg = _internal_mutable_configvector();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.WhiskerTree.configvector)
-  return _internal_mutable_configvector();
+  return _msg;
 }
 inline void WhiskerTree::set_allocated_configvector(::RemyBuffers::ConfigVector* configvector) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete configvector_;
+    delete _impl_.configvector_;
   }
   if (configvector) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(configvector);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(configvector);
     if (message_arena != submessage_arena) {
       configvector = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, configvector, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  configvector_ = configvector;
+  _impl_.configvector_ = configvector;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.WhiskerTree.configvector)
 }
 
@@ -3280,21 +3448,21 @@ inline void WhiskerTree::set_allocated_configvector(::RemyBuffers::ConfigVector*
 
 // optional .RemyBuffers.MemoryRange domain = 90;
 inline bool FinTree::_internal_has_domain() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || domain_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.domain_ != nullptr);
   return value;
 }
 inline bool FinTree::has_domain() const {
   return _internal_has_domain();
 }
 inline void FinTree::clear_domain() {
-  if (domain_ != nullptr) domain_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.domain_ != nullptr) _impl_.domain_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::RemyBuffers::MemoryRange& FinTree::_internal_domain() const {
-  const ::RemyBuffers::MemoryRange* p = domain_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::MemoryRange*>(
-      &::RemyBuffers::_MemoryRange_default_instance_);
+  const ::RemyBuffers::MemoryRange* p = _impl_.domain_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::MemoryRange&>(
+      ::RemyBuffers::_MemoryRange_default_instance_);
 }
 inline const ::RemyBuffers::MemoryRange& FinTree::domain() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.FinTree.domain)
@@ -3302,119 +3470,129 @@ inline const ::RemyBuffers::MemoryRange& FinTree::domain() const {
 }
 inline void FinTree::unsafe_arena_set_allocated_domain(
     ::RemyBuffers::MemoryRange* domain) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(domain_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.domain_);
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   if (domain) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.FinTree.domain)
 }
 inline ::RemyBuffers::MemoryRange* FinTree::release_domain() {
-  auto temp = unsafe_arena_release_domain();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* FinTree::unsafe_arena_release_domain() {
   // @@protoc_insertion_point(field_release:RemyBuffers.FinTree.domain)
-  _has_bits_[0] &= ~0x00000001u;
-  ::RemyBuffers::MemoryRange* temp = domain_;
-  domain_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* FinTree::_internal_mutable_domain() {
-  _has_bits_[0] |= 0x00000001u;
-  if (domain_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArena());
-    domain_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.domain_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArenaForAllocation());
+    _impl_.domain_ = p;
   }
-  return domain_;
+  return _impl_.domain_;
 }
 inline ::RemyBuffers::MemoryRange* FinTree::mutable_domain() {
+  ::RemyBuffers::MemoryRange* _msg = _internal_mutable_domain();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.FinTree.domain)
-  return _internal_mutable_domain();
+  return _msg;
 }
 inline void FinTree::set_allocated_domain(::RemyBuffers::MemoryRange* domain) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete domain_;
+    delete _impl_.domain_;
   }
   if (domain) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(domain);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(domain);
     if (message_arena != submessage_arena) {
       domain = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, domain, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.FinTree.domain)
 }
 
 // repeated .RemyBuffers.FinTree children = 91;
 inline int FinTree::_internal_children_size() const {
-  return children_.size();
+  return _impl_.children_.size();
 }
 inline int FinTree::children_size() const {
   return _internal_children_size();
 }
 inline void FinTree::clear_children() {
-  children_.Clear();
+  _impl_.children_.Clear();
 }
 inline ::RemyBuffers::FinTree* FinTree::mutable_children(int index) {
   // @@protoc_insertion_point(field_mutable:RemyBuffers.FinTree.children)
-  return children_.Mutable(index);
+  return _impl_.children_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::FinTree >*
 FinTree::mutable_children() {
   // @@protoc_insertion_point(field_mutable_list:RemyBuffers.FinTree.children)
-  return &children_;
+  return &_impl_.children_;
 }
 inline const ::RemyBuffers::FinTree& FinTree::_internal_children(int index) const {
-  return children_.Get(index);
+  return _impl_.children_.Get(index);
 }
 inline const ::RemyBuffers::FinTree& FinTree::children(int index) const {
   // @@protoc_insertion_point(field_get:RemyBuffers.FinTree.children)
   return _internal_children(index);
 }
 inline ::RemyBuffers::FinTree* FinTree::_internal_add_children() {
-  return children_.Add();
+  return _impl_.children_.Add();
 }
 inline ::RemyBuffers::FinTree* FinTree::add_children() {
+  ::RemyBuffers::FinTree* _add = _internal_add_children();
   // @@protoc_insertion_point(field_add:RemyBuffers.FinTree.children)
-  return _internal_add_children();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::FinTree >&
 FinTree::children() const {
   // @@protoc_insertion_point(field_list:RemyBuffers.FinTree.children)
-  return children_;
+  return _impl_.children_;
 }
 
 // optional .RemyBuffers.Fin leaf = 92;
 inline bool FinTree::_internal_has_leaf() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || leaf_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.leaf_ != nullptr);
   return value;
 }
 inline bool FinTree::has_leaf() const {
   return _internal_has_leaf();
 }
 inline void FinTree::clear_leaf() {
-  if (leaf_ != nullptr) leaf_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.leaf_ != nullptr) _impl_.leaf_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const ::RemyBuffers::Fin& FinTree::_internal_leaf() const {
-  const ::RemyBuffers::Fin* p = leaf_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Fin*>(
-      &::RemyBuffers::_Fin_default_instance_);
+  const ::RemyBuffers::Fin* p = _impl_.leaf_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Fin&>(
+      ::RemyBuffers::_Fin_default_instance_);
 }
 inline const ::RemyBuffers::Fin& FinTree::leaf() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.FinTree.leaf)
@@ -3422,80 +3600,89 @@ inline const ::RemyBuffers::Fin& FinTree::leaf() const {
 }
 inline void FinTree::unsafe_arena_set_allocated_leaf(
     ::RemyBuffers::Fin* leaf) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(leaf_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leaf_);
   }
-  leaf_ = leaf;
+  _impl_.leaf_ = leaf;
   if (leaf) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.FinTree.leaf)
 }
 inline ::RemyBuffers::Fin* FinTree::release_leaf() {
-  auto temp = unsafe_arena_release_leaf();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Fin* temp = _impl_.leaf_;
+  _impl_.leaf_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Fin* FinTree::unsafe_arena_release_leaf() {
   // @@protoc_insertion_point(field_release:RemyBuffers.FinTree.leaf)
-  _has_bits_[0] &= ~0x00000002u;
-  ::RemyBuffers::Fin* temp = leaf_;
-  leaf_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Fin* temp = _impl_.leaf_;
+  _impl_.leaf_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Fin* FinTree::_internal_mutable_leaf() {
-  _has_bits_[0] |= 0x00000002u;
-  if (leaf_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Fin>(GetArena());
-    leaf_ = p;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.leaf_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Fin>(GetArenaForAllocation());
+    _impl_.leaf_ = p;
   }
-  return leaf_;
+  return _impl_.leaf_;
 }
 inline ::RemyBuffers::Fin* FinTree::mutable_leaf() {
+  ::RemyBuffers::Fin* _msg = _internal_mutable_leaf();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.FinTree.leaf)
-  return _internal_mutable_leaf();
+  return _msg;
 }
 inline void FinTree::set_allocated_leaf(::RemyBuffers::Fin* leaf) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete leaf_;
+    delete _impl_.leaf_;
   }
   if (leaf) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(leaf);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(leaf);
     if (message_arena != submessage_arena) {
       leaf = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, leaf, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  leaf_ = leaf;
+  _impl_.leaf_ = leaf;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.FinTree.leaf)
 }
 
 // optional .RemyBuffers.ConfigRange config = 93;
 inline bool FinTree::_internal_has_config() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
-  PROTOBUF_ASSUME(!value || config_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.config_ != nullptr);
   return value;
 }
 inline bool FinTree::has_config() const {
   return _internal_has_config();
 }
 inline void FinTree::clear_config() {
-  if (config_ != nullptr) config_->Clear();
-  _has_bits_[0] &= ~0x00000004u;
+  if (_impl_.config_ != nullptr) _impl_.config_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const ::RemyBuffers::ConfigRange& FinTree::_internal_config() const {
-  const ::RemyBuffers::ConfigRange* p = config_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::ConfigRange*>(
-      &::RemyBuffers::_ConfigRange_default_instance_);
+  const ::RemyBuffers::ConfigRange* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::ConfigRange&>(
+      ::RemyBuffers::_ConfigRange_default_instance_);
 }
 inline const ::RemyBuffers::ConfigRange& FinTree::config() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.FinTree.config)
@@ -3503,80 +3690,89 @@ inline const ::RemyBuffers::ConfigRange& FinTree::config() const {
 }
 inline void FinTree::unsafe_arena_set_allocated_config(
     ::RemyBuffers::ConfigRange* config) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(config_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
   }
-  config_ = config;
+  _impl_.config_ = config;
   if (config) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.FinTree.config)
 }
 inline ::RemyBuffers::ConfigRange* FinTree::release_config() {
-  auto temp = unsafe_arena_release_config();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::ConfigRange* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::ConfigRange* FinTree::unsafe_arena_release_config() {
   // @@protoc_insertion_point(field_release:RemyBuffers.FinTree.config)
-  _has_bits_[0] &= ~0x00000004u;
-  ::RemyBuffers::ConfigRange* temp = config_;
-  config_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::ConfigRange* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::ConfigRange* FinTree::_internal_mutable_config() {
-  _has_bits_[0] |= 0x00000004u;
-  if (config_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigRange>(GetArena());
-    config_ = p;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigRange>(GetArenaForAllocation());
+    _impl_.config_ = p;
   }
-  return config_;
+  return _impl_.config_;
 }
 inline ::RemyBuffers::ConfigRange* FinTree::mutable_config() {
+  ::RemyBuffers::ConfigRange* _msg = _internal_mutable_config();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.FinTree.config)
-  return _internal_mutable_config();
+  return _msg;
 }
 inline void FinTree::set_allocated_config(::RemyBuffers::ConfigRange* config) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete config_;
+    delete _impl_.config_;
   }
   if (config) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(config);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
     if (message_arena != submessage_arena) {
       config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, config, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  config_ = config;
+  _impl_.config_ = config;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.FinTree.config)
 }
 
 // optional .RemyBuffers.OptimizationSettings optimizer = 94;
 inline bool FinTree::_internal_has_optimizer() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
-  PROTOBUF_ASSUME(!value || optimizer_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.optimizer_ != nullptr);
   return value;
 }
 inline bool FinTree::has_optimizer() const {
   return _internal_has_optimizer();
 }
 inline void FinTree::clear_optimizer() {
-  if (optimizer_ != nullptr) optimizer_->Clear();
-  _has_bits_[0] &= ~0x00000008u;
+  if (_impl_.optimizer_ != nullptr) _impl_.optimizer_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const ::RemyBuffers::OptimizationSettings& FinTree::_internal_optimizer() const {
-  const ::RemyBuffers::OptimizationSettings* p = optimizer_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::OptimizationSettings*>(
-      &::RemyBuffers::_OptimizationSettings_default_instance_);
+  const ::RemyBuffers::OptimizationSettings* p = _impl_.optimizer_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::OptimizationSettings&>(
+      ::RemyBuffers::_OptimizationSettings_default_instance_);
 }
 inline const ::RemyBuffers::OptimizationSettings& FinTree::optimizer() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.FinTree.optimizer)
@@ -3584,80 +3780,89 @@ inline const ::RemyBuffers::OptimizationSettings& FinTree::optimizer() const {
 }
 inline void FinTree::unsafe_arena_set_allocated_optimizer(
     ::RemyBuffers::OptimizationSettings* optimizer) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optimizer_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.optimizer_);
   }
-  optimizer_ = optimizer;
+  _impl_.optimizer_ = optimizer;
   if (optimizer) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.FinTree.optimizer)
 }
 inline ::RemyBuffers::OptimizationSettings* FinTree::release_optimizer() {
-  auto temp = unsafe_arena_release_optimizer();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::OptimizationSettings* temp = _impl_.optimizer_;
+  _impl_.optimizer_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::OptimizationSettings* FinTree::unsafe_arena_release_optimizer() {
   // @@protoc_insertion_point(field_release:RemyBuffers.FinTree.optimizer)
-  _has_bits_[0] &= ~0x00000008u;
-  ::RemyBuffers::OptimizationSettings* temp = optimizer_;
-  optimizer_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::OptimizationSettings* temp = _impl_.optimizer_;
+  _impl_.optimizer_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::OptimizationSettings* FinTree::_internal_mutable_optimizer() {
-  _has_bits_[0] |= 0x00000008u;
-  if (optimizer_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSettings>(GetArena());
-    optimizer_ = p;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.optimizer_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSettings>(GetArenaForAllocation());
+    _impl_.optimizer_ = p;
   }
-  return optimizer_;
+  return _impl_.optimizer_;
 }
 inline ::RemyBuffers::OptimizationSettings* FinTree::mutable_optimizer() {
+  ::RemyBuffers::OptimizationSettings* _msg = _internal_mutable_optimizer();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.FinTree.optimizer)
-  return _internal_mutable_optimizer();
+  return _msg;
 }
 inline void FinTree::set_allocated_optimizer(::RemyBuffers::OptimizationSettings* optimizer) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete optimizer_;
+    delete _impl_.optimizer_;
   }
   if (optimizer) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(optimizer);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(optimizer);
     if (message_arena != submessage_arena) {
       optimizer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, optimizer, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  optimizer_ = optimizer;
+  _impl_.optimizer_ = optimizer;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.FinTree.optimizer)
 }
 
 // optional .RemyBuffers.ConfigVector configvector = 95;
 inline bool FinTree::_internal_has_configvector() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
-  PROTOBUF_ASSUME(!value || configvector_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.configvector_ != nullptr);
   return value;
 }
 inline bool FinTree::has_configvector() const {
   return _internal_has_configvector();
 }
 inline void FinTree::clear_configvector() {
-  if (configvector_ != nullptr) configvector_->Clear();
-  _has_bits_[0] &= ~0x00000010u;
+  if (_impl_.configvector_ != nullptr) _impl_.configvector_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const ::RemyBuffers::ConfigVector& FinTree::_internal_configvector() const {
-  const ::RemyBuffers::ConfigVector* p = configvector_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::ConfigVector*>(
-      &::RemyBuffers::_ConfigVector_default_instance_);
+  const ::RemyBuffers::ConfigVector* p = _impl_.configvector_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::ConfigVector&>(
+      ::RemyBuffers::_ConfigVector_default_instance_);
 }
 inline const ::RemyBuffers::ConfigVector& FinTree::configvector() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.FinTree.configvector)
@@ -3665,60 +3870,69 @@ inline const ::RemyBuffers::ConfigVector& FinTree::configvector() const {
 }
 inline void FinTree::unsafe_arena_set_allocated_configvector(
     ::RemyBuffers::ConfigVector* configvector) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(configvector_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.configvector_);
   }
-  configvector_ = configvector;
+  _impl_.configvector_ = configvector;
   if (configvector) {
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.FinTree.configvector)
 }
 inline ::RemyBuffers::ConfigVector* FinTree::release_configvector() {
-  auto temp = unsafe_arena_release_configvector();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::RemyBuffers::ConfigVector* temp = _impl_.configvector_;
+  _impl_.configvector_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::ConfigVector* FinTree::unsafe_arena_release_configvector() {
   // @@protoc_insertion_point(field_release:RemyBuffers.FinTree.configvector)
-  _has_bits_[0] &= ~0x00000010u;
-  ::RemyBuffers::ConfigVector* temp = configvector_;
-  configvector_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::RemyBuffers::ConfigVector* temp = _impl_.configvector_;
+  _impl_.configvector_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::ConfigVector* FinTree::_internal_mutable_configvector() {
-  _has_bits_[0] |= 0x00000010u;
-  if (configvector_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigVector>(GetArena());
-    configvector_ = p;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.configvector_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::ConfigVector>(GetArenaForAllocation());
+    _impl_.configvector_ = p;
   }
-  return configvector_;
+  return _impl_.configvector_;
 }
 inline ::RemyBuffers::ConfigVector* FinTree::mutable_configvector() {
+  ::RemyBuffers::ConfigVector* _msg = _internal_mutable_configvector();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.FinTree.configvector)
-  return _internal_mutable_configvector();
+  return _msg;
 }
 inline void FinTree::set_allocated_configvector(::RemyBuffers::ConfigVector* configvector) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete configvector_;
+    delete _impl_.configvector_;
   }
   if (configvector) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(configvector);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(configvector);
     if (message_arena != submessage_arena) {
       configvector = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, configvector, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  configvector_ = configvector;
+  _impl_.configvector_ = configvector;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.FinTree.configvector)
 }
 
@@ -3728,21 +3942,21 @@ inline void FinTree::set_allocated_configvector(::RemyBuffers::ConfigVector* con
 
 // optional .RemyBuffers.Memory lower = 11;
 inline bool MemoryRange::_internal_has_lower() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || lower_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.lower_ != nullptr);
   return value;
 }
 inline bool MemoryRange::has_lower() const {
   return _internal_has_lower();
 }
 inline void MemoryRange::clear_lower() {
-  if (lower_ != nullptr) lower_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.lower_ != nullptr) _impl_.lower_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::RemyBuffers::Memory& MemoryRange::_internal_lower() const {
-  const ::RemyBuffers::Memory* p = lower_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Memory*>(
-      &::RemyBuffers::_Memory_default_instance_);
+  const ::RemyBuffers::Memory* p = _impl_.lower_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Memory&>(
+      ::RemyBuffers::_Memory_default_instance_);
 }
 inline const ::RemyBuffers::Memory& MemoryRange::lower() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.MemoryRange.lower)
@@ -3750,80 +3964,89 @@ inline const ::RemyBuffers::Memory& MemoryRange::lower() const {
 }
 inline void MemoryRange::unsafe_arena_set_allocated_lower(
     ::RemyBuffers::Memory* lower) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(lower_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lower_);
   }
-  lower_ = lower;
+  _impl_.lower_ = lower;
   if (lower) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.MemoryRange.lower)
 }
 inline ::RemyBuffers::Memory* MemoryRange::release_lower() {
-  auto temp = unsafe_arena_release_lower();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::Memory* temp = _impl_.lower_;
+  _impl_.lower_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Memory* MemoryRange::unsafe_arena_release_lower() {
   // @@protoc_insertion_point(field_release:RemyBuffers.MemoryRange.lower)
-  _has_bits_[0] &= ~0x00000001u;
-  ::RemyBuffers::Memory* temp = lower_;
-  lower_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::Memory* temp = _impl_.lower_;
+  _impl_.lower_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Memory* MemoryRange::_internal_mutable_lower() {
-  _has_bits_[0] |= 0x00000001u;
-  if (lower_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Memory>(GetArena());
-    lower_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.lower_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Memory>(GetArenaForAllocation());
+    _impl_.lower_ = p;
   }
-  return lower_;
+  return _impl_.lower_;
 }
 inline ::RemyBuffers::Memory* MemoryRange::mutable_lower() {
+  ::RemyBuffers::Memory* _msg = _internal_mutable_lower();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.MemoryRange.lower)
-  return _internal_mutable_lower();
+  return _msg;
 }
 inline void MemoryRange::set_allocated_lower(::RemyBuffers::Memory* lower) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete lower_;
+    delete _impl_.lower_;
   }
   if (lower) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(lower);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lower);
     if (message_arena != submessage_arena) {
       lower = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, lower, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  lower_ = lower;
+  _impl_.lower_ = lower;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.MemoryRange.lower)
 }
 
 // optional .RemyBuffers.Memory upper = 12;
 inline bool MemoryRange::_internal_has_upper() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || upper_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.upper_ != nullptr);
   return value;
 }
 inline bool MemoryRange::has_upper() const {
   return _internal_has_upper();
 }
 inline void MemoryRange::clear_upper() {
-  if (upper_ != nullptr) upper_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.upper_ != nullptr) _impl_.upper_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const ::RemyBuffers::Memory& MemoryRange::_internal_upper() const {
-  const ::RemyBuffers::Memory* p = upper_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Memory*>(
-      &::RemyBuffers::_Memory_default_instance_);
+  const ::RemyBuffers::Memory* p = _impl_.upper_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Memory&>(
+      ::RemyBuffers::_Memory_default_instance_);
 }
 inline const ::RemyBuffers::Memory& MemoryRange::upper() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.MemoryRange.upper)
@@ -3831,75 +4054,84 @@ inline const ::RemyBuffers::Memory& MemoryRange::upper() const {
 }
 inline void MemoryRange::unsafe_arena_set_allocated_upper(
     ::RemyBuffers::Memory* upper) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(upper_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.upper_);
   }
-  upper_ = upper;
+  _impl_.upper_ = upper;
   if (upper) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.MemoryRange.upper)
 }
 inline ::RemyBuffers::Memory* MemoryRange::release_upper() {
-  auto temp = unsafe_arena_release_upper();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Memory* temp = _impl_.upper_;
+  _impl_.upper_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Memory* MemoryRange::unsafe_arena_release_upper() {
   // @@protoc_insertion_point(field_release:RemyBuffers.MemoryRange.upper)
-  _has_bits_[0] &= ~0x00000002u;
-  ::RemyBuffers::Memory* temp = upper_;
-  upper_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Memory* temp = _impl_.upper_;
+  _impl_.upper_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Memory* MemoryRange::_internal_mutable_upper() {
-  _has_bits_[0] |= 0x00000002u;
-  if (upper_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Memory>(GetArena());
-    upper_ = p;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.upper_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Memory>(GetArenaForAllocation());
+    _impl_.upper_ = p;
   }
-  return upper_;
+  return _impl_.upper_;
 }
 inline ::RemyBuffers::Memory* MemoryRange::mutable_upper() {
+  ::RemyBuffers::Memory* _msg = _internal_mutable_upper();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.MemoryRange.upper)
-  return _internal_mutable_upper();
+  return _msg;
 }
 inline void MemoryRange::set_allocated_upper(::RemyBuffers::Memory* upper) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete upper_;
+    delete _impl_.upper_;
   }
   if (upper) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(upper);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(upper);
     if (message_arena != submessage_arena) {
       upper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, upper, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  upper_ = upper;
+  _impl_.upper_ = upper;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.MemoryRange.upper)
 }
 
 // repeated .RemyBuffers.MemoryRange.Axis active_axis = 13;
 inline int MemoryRange::_internal_active_axis_size() const {
-  return active_axis_.size();
+  return _impl_.active_axis_.size();
 }
 inline int MemoryRange::active_axis_size() const {
   return _internal_active_axis_size();
 }
 inline void MemoryRange::clear_active_axis() {
-  active_axis_.Clear();
+  _impl_.active_axis_.Clear();
 }
 inline ::RemyBuffers::MemoryRange_Axis MemoryRange::_internal_active_axis(int index) const {
-  return static_cast< ::RemyBuffers::MemoryRange_Axis >(active_axis_.Get(index));
+  return static_cast< ::RemyBuffers::MemoryRange_Axis >(_impl_.active_axis_.Get(index));
 }
 inline ::RemyBuffers::MemoryRange_Axis MemoryRange::active_axis(int index) const {
   // @@protoc_insertion_point(field_get:RemyBuffers.MemoryRange.active_axis)
@@ -3907,25 +4139,25 @@ inline ::RemyBuffers::MemoryRange_Axis MemoryRange::active_axis(int index) const
 }
 inline void MemoryRange::set_active_axis(int index, ::RemyBuffers::MemoryRange_Axis value) {
   assert(::RemyBuffers::MemoryRange_Axis_IsValid(value));
-  active_axis_.Set(index, value);
+  _impl_.active_axis_.Set(index, value);
   // @@protoc_insertion_point(field_set:RemyBuffers.MemoryRange.active_axis)
 }
 inline void MemoryRange::_internal_add_active_axis(::RemyBuffers::MemoryRange_Axis value) {
   assert(::RemyBuffers::MemoryRange_Axis_IsValid(value));
-  active_axis_.Add(value);
+  _impl_.active_axis_.Add(value);
 }
 inline void MemoryRange::add_active_axis(::RemyBuffers::MemoryRange_Axis value) {
-  // @@protoc_insertion_point(field_add:RemyBuffers.MemoryRange.active_axis)
   _internal_add_active_axis(value);
+  // @@protoc_insertion_point(field_add:RemyBuffers.MemoryRange.active_axis)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
 MemoryRange::active_axis() const {
   // @@protoc_insertion_point(field_list:RemyBuffers.MemoryRange.active_axis)
-  return active_axis_;
+  return _impl_.active_axis_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
 MemoryRange::_internal_mutable_active_axis() {
-  return &active_axis_;
+  return &_impl_.active_axis_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
 MemoryRange::mutable_active_axis() {
@@ -3939,26 +4171,26 @@ MemoryRange::mutable_active_axis() {
 
 // optional double rec_send_ewma = 21;
 inline bool Memory::_internal_has_rec_send_ewma() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool Memory::has_rec_send_ewma() const {
   return _internal_has_rec_send_ewma();
 }
 inline void Memory::clear_rec_send_ewma() {
-  rec_send_ewma_ = 0;
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.rec_send_ewma_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline double Memory::_internal_rec_send_ewma() const {
-  return rec_send_ewma_;
+  return _impl_.rec_send_ewma_;
 }
 inline double Memory::rec_send_ewma() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.rec_send_ewma)
   return _internal_rec_send_ewma();
 }
 inline void Memory::_internal_set_rec_send_ewma(double value) {
-  _has_bits_[0] |= 0x00000001u;
-  rec_send_ewma_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.rec_send_ewma_ = value;
 }
 inline void Memory::set_rec_send_ewma(double value) {
   _internal_set_rec_send_ewma(value);
@@ -3967,26 +4199,26 @@ inline void Memory::set_rec_send_ewma(double value) {
 
 // optional double rec_rec_ewma = 22;
 inline bool Memory::_internal_has_rec_rec_ewma() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool Memory::has_rec_rec_ewma() const {
   return _internal_has_rec_rec_ewma();
 }
 inline void Memory::clear_rec_rec_ewma() {
-  rec_rec_ewma_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.rec_rec_ewma_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline double Memory::_internal_rec_rec_ewma() const {
-  return rec_rec_ewma_;
+  return _impl_.rec_rec_ewma_;
 }
 inline double Memory::rec_rec_ewma() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.rec_rec_ewma)
   return _internal_rec_rec_ewma();
 }
 inline void Memory::_internal_set_rec_rec_ewma(double value) {
-  _has_bits_[0] |= 0x00000002u;
-  rec_rec_ewma_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.rec_rec_ewma_ = value;
 }
 inline void Memory::set_rec_rec_ewma(double value) {
   _internal_set_rec_rec_ewma(value);
@@ -3995,26 +4227,26 @@ inline void Memory::set_rec_rec_ewma(double value) {
 
 // optional double rtt_ratio = 23;
 inline bool Memory::_internal_has_rtt_ratio() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool Memory::has_rtt_ratio() const {
   return _internal_has_rtt_ratio();
 }
 inline void Memory::clear_rtt_ratio() {
-  rtt_ratio_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.rtt_ratio_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline double Memory::_internal_rtt_ratio() const {
-  return rtt_ratio_;
+  return _impl_.rtt_ratio_;
 }
 inline double Memory::rtt_ratio() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.rtt_ratio)
   return _internal_rtt_ratio();
 }
 inline void Memory::_internal_set_rtt_ratio(double value) {
-  _has_bits_[0] |= 0x00000004u;
-  rtt_ratio_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.rtt_ratio_ = value;
 }
 inline void Memory::set_rtt_ratio(double value) {
   _internal_set_rtt_ratio(value);
@@ -4023,26 +4255,26 @@ inline void Memory::set_rtt_ratio(double value) {
 
 // optional double slow_rec_rec_ewma = 24;
 inline bool Memory::_internal_has_slow_rec_rec_ewma() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool Memory::has_slow_rec_rec_ewma() const {
   return _internal_has_slow_rec_rec_ewma();
 }
 inline void Memory::clear_slow_rec_rec_ewma() {
-  slow_rec_rec_ewma_ = 0;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.slow_rec_rec_ewma_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline double Memory::_internal_slow_rec_rec_ewma() const {
-  return slow_rec_rec_ewma_;
+  return _impl_.slow_rec_rec_ewma_;
 }
 inline double Memory::slow_rec_rec_ewma() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.slow_rec_rec_ewma)
   return _internal_slow_rec_rec_ewma();
 }
 inline void Memory::_internal_set_slow_rec_rec_ewma(double value) {
-  _has_bits_[0] |= 0x00000008u;
-  slow_rec_rec_ewma_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.slow_rec_rec_ewma_ = value;
 }
 inline void Memory::set_slow_rec_rec_ewma(double value) {
   _internal_set_slow_rec_rec_ewma(value);
@@ -4051,26 +4283,26 @@ inline void Memory::set_slow_rec_rec_ewma(double value) {
 
 // optional double rtt_diff = 25;
 inline bool Memory::_internal_has_rtt_diff() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool Memory::has_rtt_diff() const {
   return _internal_has_rtt_diff();
 }
 inline void Memory::clear_rtt_diff() {
-  rtt_diff_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.rtt_diff_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline double Memory::_internal_rtt_diff() const {
-  return rtt_diff_;
+  return _impl_.rtt_diff_;
 }
 inline double Memory::rtt_diff() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.rtt_diff)
   return _internal_rtt_diff();
 }
 inline void Memory::_internal_set_rtt_diff(double value) {
-  _has_bits_[0] |= 0x00000010u;
-  rtt_diff_ = value;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.rtt_diff_ = value;
 }
 inline void Memory::set_rtt_diff(double value) {
   _internal_set_rtt_diff(value);
@@ -4079,26 +4311,26 @@ inline void Memory::set_rtt_diff(double value) {
 
 // optional double queueing_delay = 26;
 inline bool Memory::_internal_has_queueing_delay() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
 inline bool Memory::has_queueing_delay() const {
   return _internal_has_queueing_delay();
 }
 inline void Memory::clear_queueing_delay() {
-  queueing_delay_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.queueing_delay_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
 inline double Memory::_internal_queueing_delay() const {
-  return queueing_delay_;
+  return _impl_.queueing_delay_;
 }
 inline double Memory::queueing_delay() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.queueing_delay)
   return _internal_queueing_delay();
 }
 inline void Memory::_internal_set_queueing_delay(double value) {
-  _has_bits_[0] |= 0x00000020u;
-  queueing_delay_ = value;
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.queueing_delay_ = value;
 }
 inline void Memory::set_queueing_delay(double value) {
   _internal_set_queueing_delay(value);
@@ -4107,26 +4339,26 @@ inline void Memory::set_queueing_delay(double value) {
 
 // optional double recent_loss = 27;
 inline bool Memory::_internal_has_recent_loss() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
   return value;
 }
 inline bool Memory::has_recent_loss() const {
   return _internal_has_recent_loss();
 }
 inline void Memory::clear_recent_loss() {
-  recent_loss_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.recent_loss_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
 inline double Memory::_internal_recent_loss() const {
-  return recent_loss_;
+  return _impl_.recent_loss_;
 }
 inline double Memory::recent_loss() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.recent_loss)
   return _internal_recent_loss();
 }
 inline void Memory::_internal_set_recent_loss(double value) {
-  _has_bits_[0] |= 0x00000040u;
-  recent_loss_ = value;
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.recent_loss_ = value;
 }
 inline void Memory::set_recent_loss(double value) {
   _internal_set_recent_loss(value);
@@ -4135,26 +4367,26 @@ inline void Memory::set_recent_loss(double value) {
 
 // optional double int_queue = 28;
 inline bool Memory::_internal_has_int_queue() const {
-  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
 inline bool Memory::has_int_queue() const {
   return _internal_has_int_queue();
 }
 inline void Memory::clear_int_queue() {
-  int_queue_ = 0;
-  _has_bits_[0] &= ~0x00000080u;
+  _impl_.int_queue_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
 inline double Memory::_internal_int_queue() const {
-  return int_queue_;
+  return _impl_.int_queue_;
 }
 inline double Memory::int_queue() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.int_queue)
   return _internal_int_queue();
 }
 inline void Memory::_internal_set_int_queue(double value) {
-  _has_bits_[0] |= 0x00000080u;
-  int_queue_ = value;
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.int_queue_ = value;
 }
 inline void Memory::set_int_queue(double value) {
   _internal_set_int_queue(value);
@@ -4163,26 +4395,26 @@ inline void Memory::set_int_queue(double value) {
 
 // optional double int_link = 29;
 inline bool Memory::_internal_has_int_link() const {
-  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
   return value;
 }
 inline bool Memory::has_int_link() const {
   return _internal_has_int_link();
 }
 inline void Memory::clear_int_link() {
-  int_link_ = 0;
-  _has_bits_[0] &= ~0x00000100u;
+  _impl_.int_link_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
 inline double Memory::_internal_int_link() const {
-  return int_link_;
+  return _impl_.int_link_;
 }
 inline double Memory::int_link() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Memory.int_link)
   return _internal_int_link();
 }
 inline void Memory::_internal_set_int_link(double value) {
-  _has_bits_[0] |= 0x00000100u;
-  int_link_ = value;
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.int_link_ = value;
 }
 inline void Memory::set_int_link(double value) {
   _internal_set_int_link(value);
@@ -4195,54 +4427,54 @@ inline void Memory::set_int_link(double value) {
 
 // optional sint32 window_increment = 31;
 inline bool Whisker::_internal_has_window_increment() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool Whisker::has_window_increment() const {
   return _internal_has_window_increment();
 }
 inline void Whisker::clear_window_increment() {
-  window_increment_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.window_increment_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Whisker::_internal_window_increment() const {
-  return window_increment_;
+inline int32_t Whisker::_internal_window_increment() const {
+  return _impl_.window_increment_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Whisker::window_increment() const {
+inline int32_t Whisker::window_increment() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Whisker.window_increment)
   return _internal_window_increment();
 }
-inline void Whisker::_internal_set_window_increment(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000002u;
-  window_increment_ = value;
+inline void Whisker::_internal_set_window_increment(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.window_increment_ = value;
 }
-inline void Whisker::set_window_increment(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Whisker::set_window_increment(int32_t value) {
   _internal_set_window_increment(value);
   // @@protoc_insertion_point(field_set:RemyBuffers.Whisker.window_increment)
 }
 
 // optional double window_multiple = 32;
 inline bool Whisker::_internal_has_window_multiple() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool Whisker::has_window_multiple() const {
   return _internal_has_window_multiple();
 }
 inline void Whisker::clear_window_multiple() {
-  window_multiple_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.window_multiple_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline double Whisker::_internal_window_multiple() const {
-  return window_multiple_;
+  return _impl_.window_multiple_;
 }
 inline double Whisker::window_multiple() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Whisker.window_multiple)
   return _internal_window_multiple();
 }
 inline void Whisker::_internal_set_window_multiple(double value) {
-  _has_bits_[0] |= 0x00000004u;
-  window_multiple_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.window_multiple_ = value;
 }
 inline void Whisker::set_window_multiple(double value) {
   _internal_set_window_multiple(value);
@@ -4251,26 +4483,26 @@ inline void Whisker::set_window_multiple(double value) {
 
 // optional double intersend = 33;
 inline bool Whisker::_internal_has_intersend() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool Whisker::has_intersend() const {
   return _internal_has_intersend();
 }
 inline void Whisker::clear_intersend() {
-  intersend_ = 0;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.intersend_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline double Whisker::_internal_intersend() const {
-  return intersend_;
+  return _impl_.intersend_;
 }
 inline double Whisker::intersend() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Whisker.intersend)
   return _internal_intersend();
 }
 inline void Whisker::_internal_set_intersend(double value) {
-  _has_bits_[0] |= 0x00000008u;
-  intersend_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.intersend_ = value;
 }
 inline void Whisker::set_intersend(double value) {
   _internal_set_intersend(value);
@@ -4279,21 +4511,21 @@ inline void Whisker::set_intersend(double value) {
 
 // optional .RemyBuffers.MemoryRange domain = 34;
 inline bool Whisker::_internal_has_domain() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || domain_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.domain_ != nullptr);
   return value;
 }
 inline bool Whisker::has_domain() const {
   return _internal_has_domain();
 }
 inline void Whisker::clear_domain() {
-  if (domain_ != nullptr) domain_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.domain_ != nullptr) _impl_.domain_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::RemyBuffers::MemoryRange& Whisker::_internal_domain() const {
-  const ::RemyBuffers::MemoryRange* p = domain_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::MemoryRange*>(
-      &::RemyBuffers::_MemoryRange_default_instance_);
+  const ::RemyBuffers::MemoryRange* p = _impl_.domain_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::MemoryRange&>(
+      ::RemyBuffers::_MemoryRange_default_instance_);
 }
 inline const ::RemyBuffers::MemoryRange& Whisker::domain() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Whisker.domain)
@@ -4301,60 +4533,69 @@ inline const ::RemyBuffers::MemoryRange& Whisker::domain() const {
 }
 inline void Whisker::unsafe_arena_set_allocated_domain(
     ::RemyBuffers::MemoryRange* domain) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(domain_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.domain_);
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   if (domain) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.Whisker.domain)
 }
 inline ::RemyBuffers::MemoryRange* Whisker::release_domain() {
-  auto temp = unsafe_arena_release_domain();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* Whisker::unsafe_arena_release_domain() {
   // @@protoc_insertion_point(field_release:RemyBuffers.Whisker.domain)
-  _has_bits_[0] &= ~0x00000001u;
-  ::RemyBuffers::MemoryRange* temp = domain_;
-  domain_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* Whisker::_internal_mutable_domain() {
-  _has_bits_[0] |= 0x00000001u;
-  if (domain_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArena());
-    domain_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.domain_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArenaForAllocation());
+    _impl_.domain_ = p;
   }
-  return domain_;
+  return _impl_.domain_;
 }
 inline ::RemyBuffers::MemoryRange* Whisker::mutable_domain() {
+  ::RemyBuffers::MemoryRange* _msg = _internal_mutable_domain();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.Whisker.domain)
-  return _internal_mutable_domain();
+  return _msg;
 }
 inline void Whisker::set_allocated_domain(::RemyBuffers::MemoryRange* domain) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete domain_;
+    delete _impl_.domain_;
   }
   if (domain) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(domain);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(domain);
     if (message_arena != submessage_arena) {
       domain = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, domain, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.Whisker.domain)
 }
 
@@ -4364,26 +4605,26 @@ inline void Whisker::set_allocated_domain(::RemyBuffers::MemoryRange* domain) {
 
 // optional double lambda = 37;
 inline bool Fin::_internal_has_lambda() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool Fin::has_lambda() const {
   return _internal_has_lambda();
 }
 inline void Fin::clear_lambda() {
-  lambda_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.lambda_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline double Fin::_internal_lambda() const {
-  return lambda_;
+  return _impl_.lambda_;
 }
 inline double Fin::lambda() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Fin.lambda)
   return _internal_lambda();
 }
 inline void Fin::_internal_set_lambda(double value) {
-  _has_bits_[0] |= 0x00000002u;
-  lambda_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lambda_ = value;
 }
 inline void Fin::set_lambda(double value) {
   _internal_set_lambda(value);
@@ -4392,21 +4633,21 @@ inline void Fin::set_lambda(double value) {
 
 // optional .RemyBuffers.MemoryRange domain = 38;
 inline bool Fin::_internal_has_domain() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || domain_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.domain_ != nullptr);
   return value;
 }
 inline bool Fin::has_domain() const {
   return _internal_has_domain();
 }
 inline void Fin::clear_domain() {
-  if (domain_ != nullptr) domain_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.domain_ != nullptr) _impl_.domain_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::RemyBuffers::MemoryRange& Fin::_internal_domain() const {
-  const ::RemyBuffers::MemoryRange* p = domain_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::MemoryRange*>(
-      &::RemyBuffers::_MemoryRange_default_instance_);
+  const ::RemyBuffers::MemoryRange* p = _impl_.domain_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::MemoryRange&>(
+      ::RemyBuffers::_MemoryRange_default_instance_);
 }
 inline const ::RemyBuffers::MemoryRange& Fin::domain() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Fin.domain)
@@ -4414,60 +4655,69 @@ inline const ::RemyBuffers::MemoryRange& Fin::domain() const {
 }
 inline void Fin::unsafe_arena_set_allocated_domain(
     ::RemyBuffers::MemoryRange* domain) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(domain_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.domain_);
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   if (domain) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.Fin.domain)
 }
 inline ::RemyBuffers::MemoryRange* Fin::release_domain() {
-  auto temp = unsafe_arena_release_domain();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* Fin::unsafe_arena_release_domain() {
   // @@protoc_insertion_point(field_release:RemyBuffers.Fin.domain)
-  _has_bits_[0] &= ~0x00000001u;
-  ::RemyBuffers::MemoryRange* temp = domain_;
-  domain_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::MemoryRange* temp = _impl_.domain_;
+  _impl_.domain_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::MemoryRange* Fin::_internal_mutable_domain() {
-  _has_bits_[0] |= 0x00000001u;
-  if (domain_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArena());
-    domain_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.domain_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::MemoryRange>(GetArenaForAllocation());
+    _impl_.domain_ = p;
   }
-  return domain_;
+  return _impl_.domain_;
 }
 inline ::RemyBuffers::MemoryRange* Fin::mutable_domain() {
+  ::RemyBuffers::MemoryRange* _msg = _internal_mutable_domain();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.Fin.domain)
-  return _internal_mutable_domain();
+  return _msg;
 }
 inline void Fin::set_allocated_domain(::RemyBuffers::MemoryRange* domain) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete domain_;
+    delete _impl_.domain_;
   }
   if (domain) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(domain);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(domain);
     if (message_arena != submessage_arena) {
       domain = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, domain, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  domain_ = domain;
+  _impl_.domain_ = domain;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.Fin.domain)
 }
 
@@ -4477,26 +4727,26 @@ inline void Fin::set_allocated_domain(::RemyBuffers::MemoryRange* domain) {
 
 // optional double min_value = 41;
 inline bool OptimizationSetting::_internal_has_min_value() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool OptimizationSetting::has_min_value() const {
   return _internal_has_min_value();
 }
 inline void OptimizationSetting::clear_min_value() {
-  min_value_ = 0;
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.min_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline double OptimizationSetting::_internal_min_value() const {
-  return min_value_;
+  return _impl_.min_value_;
 }
 inline double OptimizationSetting::min_value() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSetting.min_value)
   return _internal_min_value();
 }
 inline void OptimizationSetting::_internal_set_min_value(double value) {
-  _has_bits_[0] |= 0x00000001u;
-  min_value_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_value_ = value;
 }
 inline void OptimizationSetting::set_min_value(double value) {
   _internal_set_min_value(value);
@@ -4505,26 +4755,26 @@ inline void OptimizationSetting::set_min_value(double value) {
 
 // optional double max_value = 42;
 inline bool OptimizationSetting::_internal_has_max_value() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool OptimizationSetting::has_max_value() const {
   return _internal_has_max_value();
 }
 inline void OptimizationSetting::clear_max_value() {
-  max_value_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.max_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline double OptimizationSetting::_internal_max_value() const {
-  return max_value_;
+  return _impl_.max_value_;
 }
 inline double OptimizationSetting::max_value() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSetting.max_value)
   return _internal_max_value();
 }
 inline void OptimizationSetting::_internal_set_max_value(double value) {
-  _has_bits_[0] |= 0x00000002u;
-  max_value_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_value_ = value;
 }
 inline void OptimizationSetting::set_max_value(double value) {
   _internal_set_max_value(value);
@@ -4533,26 +4783,26 @@ inline void OptimizationSetting::set_max_value(double value) {
 
 // optional double min_change = 43;
 inline bool OptimizationSetting::_internal_has_min_change() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool OptimizationSetting::has_min_change() const {
   return _internal_has_min_change();
 }
 inline void OptimizationSetting::clear_min_change() {
-  min_change_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.min_change_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline double OptimizationSetting::_internal_min_change() const {
-  return min_change_;
+  return _impl_.min_change_;
 }
 inline double OptimizationSetting::min_change() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSetting.min_change)
   return _internal_min_change();
 }
 inline void OptimizationSetting::_internal_set_min_change(double value) {
-  _has_bits_[0] |= 0x00000004u;
-  min_change_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.min_change_ = value;
 }
 inline void OptimizationSetting::set_min_change(double value) {
   _internal_set_min_change(value);
@@ -4561,26 +4811,26 @@ inline void OptimizationSetting::set_min_change(double value) {
 
 // optional double max_change = 44;
 inline bool OptimizationSetting::_internal_has_max_change() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool OptimizationSetting::has_max_change() const {
   return _internal_has_max_change();
 }
 inline void OptimizationSetting::clear_max_change() {
-  max_change_ = 0;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.max_change_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline double OptimizationSetting::_internal_max_change() const {
-  return max_change_;
+  return _impl_.max_change_;
 }
 inline double OptimizationSetting::max_change() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSetting.max_change)
   return _internal_max_change();
 }
 inline void OptimizationSetting::_internal_set_max_change(double value) {
-  _has_bits_[0] |= 0x00000008u;
-  max_change_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.max_change_ = value;
 }
 inline void OptimizationSetting::set_max_change(double value) {
   _internal_set_max_change(value);
@@ -4589,26 +4839,26 @@ inline void OptimizationSetting::set_max_change(double value) {
 
 // optional double multiplier = 45;
 inline bool OptimizationSetting::_internal_has_multiplier() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool OptimizationSetting::has_multiplier() const {
   return _internal_has_multiplier();
 }
 inline void OptimizationSetting::clear_multiplier() {
-  multiplier_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.multiplier_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline double OptimizationSetting::_internal_multiplier() const {
-  return multiplier_;
+  return _impl_.multiplier_;
 }
 inline double OptimizationSetting::multiplier() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSetting.multiplier)
   return _internal_multiplier();
 }
 inline void OptimizationSetting::_internal_set_multiplier(double value) {
-  _has_bits_[0] |= 0x00000010u;
-  multiplier_ = value;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.multiplier_ = value;
 }
 inline void OptimizationSetting::set_multiplier(double value) {
   _internal_set_multiplier(value);
@@ -4617,26 +4867,26 @@ inline void OptimizationSetting::set_multiplier(double value) {
 
 // optional double default_value = 46;
 inline bool OptimizationSetting::_internal_has_default_value() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
 inline bool OptimizationSetting::has_default_value() const {
   return _internal_has_default_value();
 }
 inline void OptimizationSetting::clear_default_value() {
-  default_value_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.default_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
 inline double OptimizationSetting::_internal_default_value() const {
-  return default_value_;
+  return _impl_.default_value_;
 }
 inline double OptimizationSetting::default_value() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSetting.default_value)
   return _internal_default_value();
 }
 inline void OptimizationSetting::_internal_set_default_value(double value) {
-  _has_bits_[0] |= 0x00000020u;
-  default_value_ = value;
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.default_value_ = value;
 }
 inline void OptimizationSetting::set_default_value(double value) {
   _internal_set_default_value(value);
@@ -4649,21 +4899,21 @@ inline void OptimizationSetting::set_default_value(double value) {
 
 // optional .RemyBuffers.OptimizationSetting window_increment = 51;
 inline bool OptimizationSettings::_internal_has_window_increment() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || window_increment_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.window_increment_ != nullptr);
   return value;
 }
 inline bool OptimizationSettings::has_window_increment() const {
   return _internal_has_window_increment();
 }
 inline void OptimizationSettings::clear_window_increment() {
-  if (window_increment_ != nullptr) window_increment_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.window_increment_ != nullptr) _impl_.window_increment_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::_internal_window_increment() const {
-  const ::RemyBuffers::OptimizationSetting* p = window_increment_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::OptimizationSetting*>(
-      &::RemyBuffers::_OptimizationSetting_default_instance_);
+  const ::RemyBuffers::OptimizationSetting* p = _impl_.window_increment_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::OptimizationSetting&>(
+      ::RemyBuffers::_OptimizationSetting_default_instance_);
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::window_increment() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSettings.window_increment)
@@ -4671,80 +4921,89 @@ inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::window_in
 }
 inline void OptimizationSettings::unsafe_arena_set_allocated_window_increment(
     ::RemyBuffers::OptimizationSetting* window_increment) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(window_increment_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.window_increment_);
   }
-  window_increment_ = window_increment;
+  _impl_.window_increment_ = window_increment;
   if (window_increment) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.OptimizationSettings.window_increment)
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::release_window_increment() {
-  auto temp = unsafe_arena_release_window_increment();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.window_increment_;
+  _impl_.window_increment_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::unsafe_arena_release_window_increment() {
   // @@protoc_insertion_point(field_release:RemyBuffers.OptimizationSettings.window_increment)
-  _has_bits_[0] &= ~0x00000001u;
-  ::RemyBuffers::OptimizationSetting* temp = window_increment_;
-  window_increment_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.window_increment_;
+  _impl_.window_increment_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::_internal_mutable_window_increment() {
-  _has_bits_[0] |= 0x00000001u;
-  if (window_increment_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArena());
-    window_increment_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.window_increment_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArenaForAllocation());
+    _impl_.window_increment_ = p;
   }
-  return window_increment_;
+  return _impl_.window_increment_;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::mutable_window_increment() {
+  ::RemyBuffers::OptimizationSetting* _msg = _internal_mutable_window_increment();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.OptimizationSettings.window_increment)
-  return _internal_mutable_window_increment();
+  return _msg;
 }
 inline void OptimizationSettings::set_allocated_window_increment(::RemyBuffers::OptimizationSetting* window_increment) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete window_increment_;
+    delete _impl_.window_increment_;
   }
   if (window_increment) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(window_increment);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(window_increment);
     if (message_arena != submessage_arena) {
       window_increment = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, window_increment, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  window_increment_ = window_increment;
+  _impl_.window_increment_ = window_increment;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.OptimizationSettings.window_increment)
 }
 
 // optional .RemyBuffers.OptimizationSetting window_multiple = 52;
 inline bool OptimizationSettings::_internal_has_window_multiple() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || window_multiple_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.window_multiple_ != nullptr);
   return value;
 }
 inline bool OptimizationSettings::has_window_multiple() const {
   return _internal_has_window_multiple();
 }
 inline void OptimizationSettings::clear_window_multiple() {
-  if (window_multiple_ != nullptr) window_multiple_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.window_multiple_ != nullptr) _impl_.window_multiple_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::_internal_window_multiple() const {
-  const ::RemyBuffers::OptimizationSetting* p = window_multiple_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::OptimizationSetting*>(
-      &::RemyBuffers::_OptimizationSetting_default_instance_);
+  const ::RemyBuffers::OptimizationSetting* p = _impl_.window_multiple_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::OptimizationSetting&>(
+      ::RemyBuffers::_OptimizationSetting_default_instance_);
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::window_multiple() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSettings.window_multiple)
@@ -4752,80 +5011,89 @@ inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::window_mu
 }
 inline void OptimizationSettings::unsafe_arena_set_allocated_window_multiple(
     ::RemyBuffers::OptimizationSetting* window_multiple) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(window_multiple_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.window_multiple_);
   }
-  window_multiple_ = window_multiple;
+  _impl_.window_multiple_ = window_multiple;
   if (window_multiple) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.OptimizationSettings.window_multiple)
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::release_window_multiple() {
-  auto temp = unsafe_arena_release_window_multiple();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.window_multiple_;
+  _impl_.window_multiple_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::unsafe_arena_release_window_multiple() {
   // @@protoc_insertion_point(field_release:RemyBuffers.OptimizationSettings.window_multiple)
-  _has_bits_[0] &= ~0x00000002u;
-  ::RemyBuffers::OptimizationSetting* temp = window_multiple_;
-  window_multiple_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.window_multiple_;
+  _impl_.window_multiple_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::_internal_mutable_window_multiple() {
-  _has_bits_[0] |= 0x00000002u;
-  if (window_multiple_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArena());
-    window_multiple_ = p;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.window_multiple_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArenaForAllocation());
+    _impl_.window_multiple_ = p;
   }
-  return window_multiple_;
+  return _impl_.window_multiple_;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::mutable_window_multiple() {
+  ::RemyBuffers::OptimizationSetting* _msg = _internal_mutable_window_multiple();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.OptimizationSettings.window_multiple)
-  return _internal_mutable_window_multiple();
+  return _msg;
 }
 inline void OptimizationSettings::set_allocated_window_multiple(::RemyBuffers::OptimizationSetting* window_multiple) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete window_multiple_;
+    delete _impl_.window_multiple_;
   }
   if (window_multiple) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(window_multiple);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(window_multiple);
     if (message_arena != submessage_arena) {
       window_multiple = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, window_multiple, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  window_multiple_ = window_multiple;
+  _impl_.window_multiple_ = window_multiple;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.OptimizationSettings.window_multiple)
 }
 
 // optional .RemyBuffers.OptimizationSetting intersend = 53;
 inline bool OptimizationSettings::_internal_has_intersend() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
-  PROTOBUF_ASSUME(!value || intersend_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.intersend_ != nullptr);
   return value;
 }
 inline bool OptimizationSettings::has_intersend() const {
   return _internal_has_intersend();
 }
 inline void OptimizationSettings::clear_intersend() {
-  if (intersend_ != nullptr) intersend_->Clear();
-  _has_bits_[0] &= ~0x00000004u;
+  if (_impl_.intersend_ != nullptr) _impl_.intersend_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::_internal_intersend() const {
-  const ::RemyBuffers::OptimizationSetting* p = intersend_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::OptimizationSetting*>(
-      &::RemyBuffers::_OptimizationSetting_default_instance_);
+  const ::RemyBuffers::OptimizationSetting* p = _impl_.intersend_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::OptimizationSetting&>(
+      ::RemyBuffers::_OptimizationSetting_default_instance_);
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::intersend() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSettings.intersend)
@@ -4833,80 +5101,89 @@ inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::intersend
 }
 inline void OptimizationSettings::unsafe_arena_set_allocated_intersend(
     ::RemyBuffers::OptimizationSetting* intersend) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(intersend_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.intersend_);
   }
-  intersend_ = intersend;
+  _impl_.intersend_ = intersend;
   if (intersend) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.OptimizationSettings.intersend)
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::release_intersend() {
-  auto temp = unsafe_arena_release_intersend();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.intersend_;
+  _impl_.intersend_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::unsafe_arena_release_intersend() {
   // @@protoc_insertion_point(field_release:RemyBuffers.OptimizationSettings.intersend)
-  _has_bits_[0] &= ~0x00000004u;
-  ::RemyBuffers::OptimizationSetting* temp = intersend_;
-  intersend_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.intersend_;
+  _impl_.intersend_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::_internal_mutable_intersend() {
-  _has_bits_[0] |= 0x00000004u;
-  if (intersend_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArena());
-    intersend_ = p;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.intersend_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArenaForAllocation());
+    _impl_.intersend_ = p;
   }
-  return intersend_;
+  return _impl_.intersend_;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::mutable_intersend() {
+  ::RemyBuffers::OptimizationSetting* _msg = _internal_mutable_intersend();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.OptimizationSettings.intersend)
-  return _internal_mutable_intersend();
+  return _msg;
 }
 inline void OptimizationSettings::set_allocated_intersend(::RemyBuffers::OptimizationSetting* intersend) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete intersend_;
+    delete _impl_.intersend_;
   }
   if (intersend) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(intersend);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(intersend);
     if (message_arena != submessage_arena) {
       intersend = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, intersend, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  intersend_ = intersend;
+  _impl_.intersend_ = intersend;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.OptimizationSettings.intersend)
 }
 
 // optional .RemyBuffers.OptimizationSetting lambda = 54;
 inline bool OptimizationSettings::_internal_has_lambda() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
-  PROTOBUF_ASSUME(!value || lambda_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.lambda_ != nullptr);
   return value;
 }
 inline bool OptimizationSettings::has_lambda() const {
   return _internal_has_lambda();
 }
 inline void OptimizationSettings::clear_lambda() {
-  if (lambda_ != nullptr) lambda_->Clear();
-  _has_bits_[0] &= ~0x00000008u;
+  if (_impl_.lambda_ != nullptr) _impl_.lambda_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::_internal_lambda() const {
-  const ::RemyBuffers::OptimizationSetting* p = lambda_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::OptimizationSetting*>(
-      &::RemyBuffers::_OptimizationSetting_default_instance_);
+  const ::RemyBuffers::OptimizationSetting* p = _impl_.lambda_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::OptimizationSetting&>(
+      ::RemyBuffers::_OptimizationSetting_default_instance_);
 }
 inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::lambda() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.OptimizationSettings.lambda)
@@ -4914,60 +5191,69 @@ inline const ::RemyBuffers::OptimizationSetting& OptimizationSettings::lambda()
 }
 inline void OptimizationSettings::unsafe_arena_set_allocated_lambda(
     ::RemyBuffers::OptimizationSetting* lambda) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(lambda_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lambda_);
   }
-  lambda_ = lambda;
+  _impl_.lambda_ = lambda;
   if (lambda) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.OptimizationSettings.lambda)
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::release_lambda() {
-  auto temp = unsafe_arena_release_lambda();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.lambda_;
+  _impl_.lambda_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::unsafe_arena_release_lambda() {
   // @@protoc_insertion_point(field_release:RemyBuffers.OptimizationSettings.lambda)
-  _has_bits_[0] &= ~0x00000008u;
-  ::RemyBuffers::OptimizationSetting* temp = lambda_;
-  lambda_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::OptimizationSetting* temp = _impl_.lambda_;
+  _impl_.lambda_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::_internal_mutable_lambda() {
-  _has_bits_[0] |= 0x00000008u;
-  if (lambda_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArena());
-    lambda_ = p;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.lambda_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::OptimizationSetting>(GetArenaForAllocation());
+    _impl_.lambda_ = p;
   }
-  return lambda_;
+  return _impl_.lambda_;
 }
 inline ::RemyBuffers::OptimizationSetting* OptimizationSettings::mutable_lambda() {
+  ::RemyBuffers::OptimizationSetting* _msg = _internal_mutable_lambda();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.OptimizationSettings.lambda)
-  return _internal_mutable_lambda();
+  return _msg;
 }
 inline void OptimizationSettings::set_allocated_lambda(::RemyBuffers::OptimizationSetting* lambda) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete lambda_;
+    delete _impl_.lambda_;
   }
   if (lambda) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(lambda);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lambda);
     if (message_arena != submessage_arena) {
       lambda = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, lambda, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  lambda_ = lambda;
+  _impl_.lambda_ = lambda;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.OptimizationSettings.lambda)
 }
 
@@ -4977,26 +5263,26 @@ inline void OptimizationSettings::set_allocated_lambda(::RemyBuffers::Optimizati
 
 // optional double low = 61;
 inline bool Range::_internal_has_low() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool Range::has_low() const {
   return _internal_has_low();
 }
 inline void Range::clear_low() {
-  low_ = 0;
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.low_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline double Range::_internal_low() const {
-  return low_;
+  return _impl_.low_;
 }
 inline double Range::low() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Range.low)
   return _internal_low();
 }
 inline void Range::_internal_set_low(double value) {
-  _has_bits_[0] |= 0x00000001u;
-  low_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.low_ = value;
 }
 inline void Range::set_low(double value) {
   _internal_set_low(value);
@@ -5005,26 +5291,26 @@ inline void Range::set_low(double value) {
 
 // optional double high = 62;
 inline bool Range::_internal_has_high() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool Range::has_high() const {
   return _internal_has_high();
 }
 inline void Range::clear_high() {
-  high_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.high_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline double Range::_internal_high() const {
-  return high_;
+  return _impl_.high_;
 }
 inline double Range::high() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Range.high)
   return _internal_high();
 }
 inline void Range::_internal_set_high(double value) {
-  _has_bits_[0] |= 0x00000002u;
-  high_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.high_ = value;
 }
 inline void Range::set_high(double value) {
   _internal_set_high(value);
@@ -5033,26 +5319,26 @@ inline void Range::set_high(double value) {
 
 // optional double incr = 63;
 inline bool Range::_internal_has_incr() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool Range::has_incr() const {
   return _internal_has_incr();
 }
 inline void Range::clear_incr() {
-  incr_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.incr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline double Range::_internal_incr() const {
-  return incr_;
+  return _impl_.incr_;
 }
 inline double Range::incr() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.Range.incr)
   return _internal_incr();
 }
 inline void Range::_internal_set_incr(double value) {
-  _has_bits_[0] |= 0x00000004u;
-  incr_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.incr_ = value;
 }
 inline void Range::set_incr(double value) {
   _internal_set_incr(value);
@@ -5065,21 +5351,21 @@ inline void Range::set_incr(double value) {
 
 // optional .RemyBuffers.Range link_packets_per_ms = 71;
 inline bool ConfigRange::_internal_has_link_packets_per_ms() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || link_packets_per_ms_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.link_packets_per_ms_ != nullptr);
   return value;
 }
 inline bool ConfigRange::has_link_packets_per_ms() const {
   return _internal_has_link_packets_per_ms();
 }
 inline void ConfigRange::clear_link_packets_per_ms() {
-  if (link_packets_per_ms_ != nullptr) link_packets_per_ms_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.link_packets_per_ms_ != nullptr) _impl_.link_packets_per_ms_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::RemyBuffers::Range& ConfigRange::_internal_link_packets_per_ms() const {
-  const ::RemyBuffers::Range* p = link_packets_per_ms_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Range*>(
-      &::RemyBuffers::_Range_default_instance_);
+  const ::RemyBuffers::Range* p = _impl_.link_packets_per_ms_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Range&>(
+      ::RemyBuffers::_Range_default_instance_);
 }
 inline const ::RemyBuffers::Range& ConfigRange::link_packets_per_ms() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.link_packets_per_ms)
@@ -5087,80 +5373,89 @@ inline const ::RemyBuffers::Range& ConfigRange::link_packets_per_ms() const {
 }
 inline void ConfigRange::unsafe_arena_set_allocated_link_packets_per_ms(
     ::RemyBuffers::Range* link_packets_per_ms) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(link_packets_per_ms_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.link_packets_per_ms_);
   }
-  link_packets_per_ms_ = link_packets_per_ms;
+  _impl_.link_packets_per_ms_ = link_packets_per_ms;
   if (link_packets_per_ms) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.ConfigRange.link_packets_per_ms)
 }
 inline ::RemyBuffers::Range* ConfigRange::release_link_packets_per_ms() {
-  auto temp = unsafe_arena_release_link_packets_per_ms();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::Range* temp = _impl_.link_packets_per_ms_;
+  _impl_.link_packets_per_ms_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::unsafe_arena_release_link_packets_per_ms() {
   // @@protoc_insertion_point(field_release:RemyBuffers.ConfigRange.link_packets_per_ms)
-  _has_bits_[0] &= ~0x00000001u;
-  ::RemyBuffers::Range* temp = link_packets_per_ms_;
-  link_packets_per_ms_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RemyBuffers::Range* temp = _impl_.link_packets_per_ms_;
+  _impl_.link_packets_per_ms_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::_internal_mutable_link_packets_per_ms() {
-  _has_bits_[0] |= 0x00000001u;
-  if (link_packets_per_ms_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArena());
-    link_packets_per_ms_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.link_packets_per_ms_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArenaForAllocation());
+    _impl_.link_packets_per_ms_ = p;
   }
-  return link_packets_per_ms_;
+  return _impl_.link_packets_per_ms_;
 }
 inline ::RemyBuffers::Range* ConfigRange::mutable_link_packets_per_ms() {
+  ::RemyBuffers::Range* _msg = _internal_mutable_link_packets_per_ms();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigRange.link_packets_per_ms)
-  return _internal_mutable_link_packets_per_ms();
+  return _msg;
 }
 inline void ConfigRange::set_allocated_link_packets_per_ms(::RemyBuffers::Range* link_packets_per_ms) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete link_packets_per_ms_;
+    delete _impl_.link_packets_per_ms_;
   }
   if (link_packets_per_ms) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(link_packets_per_ms);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(link_packets_per_ms);
     if (message_arena != submessage_arena) {
       link_packets_per_ms = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, link_packets_per_ms, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  link_packets_per_ms_ = link_packets_per_ms;
+  _impl_.link_packets_per_ms_ = link_packets_per_ms;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.ConfigRange.link_packets_per_ms)
 }
 
 // optional .RemyBuffers.Range rtt = 72;
 inline bool ConfigRange::_internal_has_rtt() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || rtt_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rtt_ != nullptr);
   return value;
 }
 inline bool ConfigRange::has_rtt() const {
   return _internal_has_rtt();
 }
 inline void ConfigRange::clear_rtt() {
-  if (rtt_ != nullptr) rtt_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.rtt_ != nullptr) _impl_.rtt_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const ::RemyBuffers::Range& ConfigRange::_internal_rtt() const {
-  const ::RemyBuffers::Range* p = rtt_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Range*>(
-      &::RemyBuffers::_Range_default_instance_);
+  const ::RemyBuffers::Range* p = _impl_.rtt_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Range&>(
+      ::RemyBuffers::_Range_default_instance_);
 }
 inline const ::RemyBuffers::Range& ConfigRange::rtt() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.rtt)
@@ -5168,80 +5463,89 @@ inline const ::RemyBuffers::Range& ConfigRange::rtt() const {
 }
 inline void ConfigRange::unsafe_arena_set_allocated_rtt(
     ::RemyBuffers::Range* rtt) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(rtt_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rtt_);
   }
-  rtt_ = rtt;
+  _impl_.rtt_ = rtt;
   if (rtt) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.ConfigRange.rtt)
 }
 inline ::RemyBuffers::Range* ConfigRange::release_rtt() {
-  auto temp = unsafe_arena_release_rtt();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Range* temp = _impl_.rtt_;
+  _impl_.rtt_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::unsafe_arena_release_rtt() {
   // @@protoc_insertion_point(field_release:RemyBuffers.ConfigRange.rtt)
-  _has_bits_[0] &= ~0x00000002u;
-  ::RemyBuffers::Range* temp = rtt_;
-  rtt_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RemyBuffers::Range* temp = _impl_.rtt_;
+  _impl_.rtt_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::_internal_mutable_rtt() {
-  _has_bits_[0] |= 0x00000002u;
-  if (rtt_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArena());
-    rtt_ = p;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.rtt_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArenaForAllocation());
+    _impl_.rtt_ = p;
   }
-  return rtt_;
+  return _impl_.rtt_;
 }
 inline ::RemyBuffers::Range* ConfigRange::mutable_rtt() {
+  ::RemyBuffers::Range* _msg = _internal_mutable_rtt();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigRange.rtt)
-  return _internal_mutable_rtt();
+  return _msg;
 }
 inline void ConfigRange::set_allocated_rtt(::RemyBuffers::Range* rtt) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete rtt_;
+    delete _impl_.rtt_;
   }
   if (rtt) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(rtt);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rtt);
     if (message_arena != submessage_arena) {
       rtt = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, rtt, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  rtt_ = rtt;
+  _impl_.rtt_ = rtt;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.ConfigRange.rtt)
 }
 
 // optional .RemyBuffers.Range num_senders = 73;
 inline bool ConfigRange::_internal_has_num_senders() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
-  PROTOBUF_ASSUME(!value || num_senders_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.num_senders_ != nullptr);
   return value;
 }
 inline bool ConfigRange::has_num_senders() const {
   return _internal_has_num_senders();
 }
 inline void ConfigRange::clear_num_senders() {
-  if (num_senders_ != nullptr) num_senders_->Clear();
-  _has_bits_[0] &= ~0x00000004u;
+  if (_impl_.num_senders_ != nullptr) _impl_.num_senders_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const ::RemyBuffers::Range& ConfigRange::_internal_num_senders() const {
-  const ::RemyBuffers::Range* p = num_senders_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Range*>(
-      &::RemyBuffers::_Range_default_instance_);
+  const ::RemyBuffers::Range* p = _impl_.num_senders_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Range&>(
+      ::RemyBuffers::_Range_default_instance_);
 }
 inline const ::RemyBuffers::Range& ConfigRange::num_senders() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.num_senders)
@@ -5249,80 +5553,89 @@ inline const ::RemyBuffers::Range& ConfigRange::num_senders() const {
 }
 inline void ConfigRange::unsafe_arena_set_allocated_num_senders(
     ::RemyBuffers::Range* num_senders) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(num_senders_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.num_senders_);
   }
-  num_senders_ = num_senders;
+  _impl_.num_senders_ = num_senders;
   if (num_senders) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.ConfigRange.num_senders)
 }
 inline ::RemyBuffers::Range* ConfigRange::release_num_senders() {
-  auto temp = unsafe_arena_release_num_senders();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::Range* temp = _impl_.num_senders_;
+  _impl_.num_senders_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::unsafe_arena_release_num_senders() {
   // @@protoc_insertion_point(field_release:RemyBuffers.ConfigRange.num_senders)
-  _has_bits_[0] &= ~0x00000004u;
-  ::RemyBuffers::Range* temp = num_senders_;
-  num_senders_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RemyBuffers::Range* temp = _impl_.num_senders_;
+  _impl_.num_senders_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::_internal_mutable_num_senders() {
-  _has_bits_[0] |= 0x00000004u;
-  if (num_senders_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArena());
-    num_senders_ = p;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.num_senders_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArenaForAllocation());
+    _impl_.num_senders_ = p;
   }
-  return num_senders_;
+  return _impl_.num_senders_;
 }
 inline ::RemyBuffers::Range* ConfigRange::mutable_num_senders() {
+  ::RemyBuffers::Range* _msg = _internal_mutable_num_senders();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigRange.num_senders)
-  return _internal_mutable_num_senders();
+  return _msg;
 }
 inline void ConfigRange::set_allocated_num_senders(::RemyBuffers::Range* num_senders) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete num_senders_;
+    delete _impl_.num_senders_;
   }
   if (num_senders) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(num_senders);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(num_senders);
     if (message_arena != submessage_arena) {
       num_senders = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, num_senders, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  num_senders_ = num_senders;
+  _impl_.num_senders_ = num_senders;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.ConfigRange.num_senders)
 }
 
 // optional .RemyBuffers.Range buffer_size = 74;
 inline bool ConfigRange::_internal_has_buffer_size() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
-  PROTOBUF_ASSUME(!value || buffer_size_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.buffer_size_ != nullptr);
   return value;
 }
 inline bool ConfigRange::has_buffer_size() const {
   return _internal_has_buffer_size();
 }
 inline void ConfigRange::clear_buffer_size() {
-  if (buffer_size_ != nullptr) buffer_size_->Clear();
-  _has_bits_[0] &= ~0x00000008u;
+  if (_impl_.buffer_size_ != nullptr) _impl_.buffer_size_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const ::RemyBuffers::Range& ConfigRange::_internal_buffer_size() const {
-  const ::RemyBuffers::Range* p = buffer_size_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Range*>(
-      &::RemyBuffers::_Range_default_instance_);
+  const ::RemyBuffers::Range* p = _impl_.buffer_size_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Range&>(
+      ::RemyBuffers::_Range_default_instance_);
 }
 inline const ::RemyBuffers::Range& ConfigRange::buffer_size() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.buffer_size)
@@ -5330,80 +5643,89 @@ inline const ::RemyBuffers::Range& ConfigRange::buffer_size() const {
 }
 inline void ConfigRange::unsafe_arena_set_allocated_buffer_size(
     ::RemyBuffers::Range* buffer_size) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(buffer_size_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.buffer_size_);
   }
-  buffer_size_ = buffer_size;
+  _impl_.buffer_size_ = buffer_size;
   if (buffer_size) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.ConfigRange.buffer_size)
 }
 inline ::RemyBuffers::Range* ConfigRange::release_buffer_size() {
-  auto temp = unsafe_arena_release_buffer_size();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::Range* temp = _impl_.buffer_size_;
+  _impl_.buffer_size_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::unsafe_arena_release_buffer_size() {
   // @@protoc_insertion_point(field_release:RemyBuffers.ConfigRange.buffer_size)
-  _has_bits_[0] &= ~0x00000008u;
-  ::RemyBuffers::Range* temp = buffer_size_;
-  buffer_size_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RemyBuffers::Range* temp = _impl_.buffer_size_;
+  _impl_.buffer_size_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::_internal_mutable_buffer_size() {
-  _has_bits_[0] |= 0x00000008u;
-  if (buffer_size_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArena());
-    buffer_size_ = p;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.buffer_size_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArenaForAllocation());
+    _impl_.buffer_size_ = p;
   }
-  return buffer_size_;
+  return _impl_.buffer_size_;
 }
 inline ::RemyBuffers::Range* ConfigRange::mutable_buffer_size() {
+  ::RemyBuffers::Range* _msg = _internal_mutable_buffer_size();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigRange.buffer_size)
-  return _internal_mutable_buffer_size();
+  return _msg;
 }
 inline void ConfigRange::set_allocated_buffer_size(::RemyBuffers::Range* buffer_size) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete buffer_size_;
+    delete _impl_.buffer_size_;
   }
   if (buffer_size) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(buffer_size);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(buffer_size);
     if (message_arena != submessage_arena) {
       buffer_size = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, buffer_size, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  buffer_size_ = buffer_size;
+  _impl_.buffer_size_ = buffer_size;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.ConfigRange.buffer_size)
 }
 
 // optional .RemyBuffers.Range mean_off_duration = 75;
 inline bool ConfigRange::_internal_has_mean_off_duration() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
-  PROTOBUF_ASSUME(!value || mean_off_duration_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mean_off_duration_ != nullptr);
   return value;
 }
 inline bool ConfigRange::has_mean_off_duration() const {
   return _internal_has_mean_off_duration();
 }
 inline void ConfigRange::clear_mean_off_duration() {
-  if (mean_off_duration_ != nullptr) mean_off_duration_->Clear();
-  _has_bits_[0] &= ~0x00000010u;
+  if (_impl_.mean_off_duration_ != nullptr) _impl_.mean_off_duration_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const ::RemyBuffers::Range& ConfigRange::_internal_mean_off_duration() const {
-  const ::RemyBuffers::Range* p = mean_off_duration_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Range*>(
-      &::RemyBuffers::_Range_default_instance_);
+  const ::RemyBuffers::Range* p = _impl_.mean_off_duration_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Range&>(
+      ::RemyBuffers::_Range_default_instance_);
 }
 inline const ::RemyBuffers::Range& ConfigRange::mean_off_duration() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.mean_off_duration)
@@ -5411,80 +5733,89 @@ inline const ::RemyBuffers::Range& ConfigRange::mean_off_duration() const {
 }
 inline void ConfigRange::unsafe_arena_set_allocated_mean_off_duration(
     ::RemyBuffers::Range* mean_off_duration) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mean_off_duration_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mean_off_duration_);
   }
-  mean_off_duration_ = mean_off_duration;
+  _impl_.mean_off_duration_ = mean_off_duration;
   if (mean_off_duration) {
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.ConfigRange.mean_off_duration)
 }
 inline ::RemyBuffers::Range* ConfigRange::release_mean_off_duration() {
-  auto temp = unsafe_arena_release_mean_off_duration();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::RemyBuffers::Range* temp = _impl_.mean_off_duration_;
+  _impl_.mean_off_duration_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::unsafe_arena_release_mean_off_duration() {
   // @@protoc_insertion_point(field_release:RemyBuffers.ConfigRange.mean_off_duration)
-  _has_bits_[0] &= ~0x00000010u;
-  ::RemyBuffers::Range* temp = mean_off_duration_;
-  mean_off_duration_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::RemyBuffers::Range* temp = _impl_.mean_off_duration_;
+  _impl_.mean_off_duration_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::_internal_mutable_mean_off_duration() {
-  _has_bits_[0] |= 0x00000010u;
-  if (mean_off_duration_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArena());
-    mean_off_duration_ = p;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.mean_off_duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArenaForAllocation());
+    _impl_.mean_off_duration_ = p;
   }
-  return mean_off_duration_;
+  return _impl_.mean_off_duration_;
 }
 inline ::RemyBuffers::Range* ConfigRange::mutable_mean_off_duration() {
+  ::RemyBuffers::Range* _msg = _internal_mutable_mean_off_duration();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigRange.mean_off_duration)
-  return _internal_mutable_mean_off_duration();
+  return _msg;
 }
 inline void ConfigRange::set_allocated_mean_off_duration(::RemyBuffers::Range* mean_off_duration) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete mean_off_duration_;
+    delete _impl_.mean_off_duration_;
   }
   if (mean_off_duration) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(mean_off_duration);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mean_off_duration);
     if (message_arena != submessage_arena) {
       mean_off_duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, mean_off_duration, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  mean_off_duration_ = mean_off_duration;
+  _impl_.mean_off_duration_ = mean_off_duration;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.ConfigRange.mean_off_duration)
 }
 
 // optional .RemyBuffers.Range mean_on_duration = 76;
 inline bool ConfigRange::_internal_has_mean_on_duration() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
-  PROTOBUF_ASSUME(!value || mean_on_duration_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mean_on_duration_ != nullptr);
   return value;
 }
 inline bool ConfigRange::has_mean_on_duration() const {
   return _internal_has_mean_on_duration();
 }
 inline void ConfigRange::clear_mean_on_duration() {
-  if (mean_on_duration_ != nullptr) mean_on_duration_->Clear();
-  _has_bits_[0] &= ~0x00000020u;
+  if (_impl_.mean_on_duration_ != nullptr) _impl_.mean_on_duration_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
 inline const ::RemyBuffers::Range& ConfigRange::_internal_mean_on_duration() const {
-  const ::RemyBuffers::Range* p = mean_on_duration_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Range*>(
-      &::RemyBuffers::_Range_default_instance_);
+  const ::RemyBuffers::Range* p = _impl_.mean_on_duration_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Range&>(
+      ::RemyBuffers::_Range_default_instance_);
 }
 inline const ::RemyBuffers::Range& ConfigRange::mean_on_duration() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.mean_on_duration)
@@ -5492,108 +5823,117 @@ inline const ::RemyBuffers::Range& ConfigRange::mean_on_duration() const {
 }
 inline void ConfigRange::unsafe_arena_set_allocated_mean_on_duration(
     ::RemyBuffers::Range* mean_on_duration) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mean_on_duration_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mean_on_duration_);
   }
-  mean_on_duration_ = mean_on_duration;
+  _impl_.mean_on_duration_ = mean_on_duration;
   if (mean_on_duration) {
-    _has_bits_[0] |= 0x00000020u;
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.ConfigRange.mean_on_duration)
 }
 inline ::RemyBuffers::Range* ConfigRange::release_mean_on_duration() {
-  auto temp = unsafe_arena_release_mean_on_duration();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::RemyBuffers::Range* temp = _impl_.mean_on_duration_;
+  _impl_.mean_on_duration_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::unsafe_arena_release_mean_on_duration() {
   // @@protoc_insertion_point(field_release:RemyBuffers.ConfigRange.mean_on_duration)
-  _has_bits_[0] &= ~0x00000020u;
-  ::RemyBuffers::Range* temp = mean_on_duration_;
-  mean_on_duration_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::RemyBuffers::Range* temp = _impl_.mean_on_duration_;
+  _impl_.mean_on_duration_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::_internal_mutable_mean_on_duration() {
-  _has_bits_[0] |= 0x00000020u;
-  if (mean_on_duration_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArena());
-    mean_on_duration_ = p;
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.mean_on_duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArenaForAllocation());
+    _impl_.mean_on_duration_ = p;
   }
-  return mean_on_duration_;
+  return _impl_.mean_on_duration_;
 }
 inline ::RemyBuffers::Range* ConfigRange::mutable_mean_on_duration() {
+  ::RemyBuffers::Range* _msg = _internal_mutable_mean_on_duration();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigRange.mean_on_duration)
-  return _internal_mutable_mean_on_duration();
+  return _msg;
 }
 inline void ConfigRange::set_allocated_mean_on_duration(::RemyBuffers::Range* mean_on_duration) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete mean_on_duration_;
+    delete _impl_.mean_on_duration_;
   }
   if (mean_on_duration) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(mean_on_duration);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mean_on_duration);
     if (message_arena != submessage_arena) {
       mean_on_duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, mean_on_duration, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000020u;
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
-  mean_on_duration_ = mean_on_duration;
+  _impl_.mean_on_duration_ = mean_on_duration;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.ConfigRange.mean_on_duration)
 }
 
 // optional uint32 simulation_ticks = 77;
 inline bool ConfigRange::_internal_has_simulation_ticks() const {
-  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
 inline bool ConfigRange::has_simulation_ticks() const {
   return _internal_has_simulation_ticks();
 }
 inline void ConfigRange::clear_simulation_ticks() {
-  simulation_ticks_ = 0u;
-  _has_bits_[0] &= ~0x00000080u;
+  _impl_.simulation_ticks_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ConfigRange::_internal_simulation_ticks() const {
-  return simulation_ticks_;
+inline uint32_t ConfigRange::_internal_simulation_ticks() const {
+  return _impl_.simulation_ticks_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ConfigRange::simulation_ticks() const {
+inline uint32_t ConfigRange::simulation_ticks() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.simulation_ticks)
   return _internal_simulation_ticks();
 }
-inline void ConfigRange::_internal_set_simulation_ticks(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _has_bits_[0] |= 0x00000080u;
-  simulation_ticks_ = value;
+inline void ConfigRange::_internal_set_simulation_ticks(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.simulation_ticks_ = value;
 }
-inline void ConfigRange::set_simulation_ticks(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void ConfigRange::set_simulation_ticks(uint32_t value) {
   _internal_set_simulation_ticks(value);
   // @@protoc_insertion_point(field_set:RemyBuffers.ConfigRange.simulation_ticks)
 }
 
 // optional .RemyBuffers.Range stochastic_loss_rate = 78;
 inline bool ConfigRange::_internal_has_stochastic_loss_rate() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
-  PROTOBUF_ASSUME(!value || stochastic_loss_rate_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.stochastic_loss_rate_ != nullptr);
   return value;
 }
 inline bool ConfigRange::has_stochastic_loss_rate() const {
   return _internal_has_stochastic_loss_rate();
 }
 inline void ConfigRange::clear_stochastic_loss_rate() {
-  if (stochastic_loss_rate_ != nullptr) stochastic_loss_rate_->Clear();
-  _has_bits_[0] &= ~0x00000040u;
+  if (_impl_.stochastic_loss_rate_ != nullptr) _impl_.stochastic_loss_rate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
 inline const ::RemyBuffers::Range& ConfigRange::_internal_stochastic_loss_rate() const {
-  const ::RemyBuffers::Range* p = stochastic_loss_rate_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::RemyBuffers::Range*>(
-      &::RemyBuffers::_Range_default_instance_);
+  const ::RemyBuffers::Range* p = _impl_.stochastic_loss_rate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RemyBuffers::Range&>(
+      ::RemyBuffers::_Range_default_instance_);
 }
 inline const ::RemyBuffers::Range& ConfigRange::stochastic_loss_rate() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigRange.stochastic_loss_rate)
@@ -5601,60 +5941,69 @@ inline const ::RemyBuffers::Range& ConfigRange::stochastic_loss_rate() const {
 }
 inline void ConfigRange::unsafe_arena_set_allocated_stochastic_loss_rate(
     ::RemyBuffers::Range* stochastic_loss_rate) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stochastic_loss_rate_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stochastic_loss_rate_);
   }
-  stochastic_loss_rate_ = stochastic_loss_rate;
+  _impl_.stochastic_loss_rate_ = stochastic_loss_rate;
   if (stochastic_loss_rate) {
-    _has_bits_[0] |= 0x00000040u;
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000040u;
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RemyBuffers.ConfigRange.stochastic_loss_rate)
 }
 inline ::RemyBuffers::Range* ConfigRange::release_stochastic_loss_rate() {
-  auto temp = unsafe_arena_release_stochastic_loss_rate();
-  if (GetArena() != nullptr) {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::RemyBuffers::Range* temp = _impl_.stochastic_loss_rate_;
+  _impl_.stochastic_loss_rate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::unsafe_arena_release_stochastic_loss_rate() {
   // @@protoc_insertion_point(field_release:RemyBuffers.ConfigRange.stochastic_loss_rate)
-  _has_bits_[0] &= ~0x00000040u;
-  ::RemyBuffers::Range* temp = stochastic_loss_rate_;
-  stochastic_loss_rate_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::RemyBuffers::Range* temp = _impl_.stochastic_loss_rate_;
+  _impl_.stochastic_loss_rate_ = nullptr;
   return temp;
 }
 inline ::RemyBuffers::Range* ConfigRange::_internal_mutable_stochastic_loss_rate() {
-  _has_bits_[0] |= 0x00000040u;
-  if (stochastic_loss_rate_ == nullptr) {
-    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArena());
-    stochastic_loss_rate_ = p;
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.stochastic_loss_rate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RemyBuffers::Range>(GetArenaForAllocation());
+    _impl_.stochastic_loss_rate_ = p;
   }
-  return stochastic_loss_rate_;
+  return _impl_.stochastic_loss_rate_;
 }
 inline ::RemyBuffers::Range* ConfigRange::mutable_stochastic_loss_rate() {
+  ::RemyBuffers::Range* _msg = _internal_mutable_stochastic_loss_rate();
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigRange.stochastic_loss_rate)
-  return _internal_mutable_stochastic_loss_rate();
+  return _msg;
 }
 inline void ConfigRange::set_allocated_stochastic_loss_rate(::RemyBuffers::Range* stochastic_loss_rate) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete stochastic_loss_rate_;
+    delete _impl_.stochastic_loss_rate_;
   }
   if (stochastic_loss_rate) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(stochastic_loss_rate);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stochastic_loss_rate);
     if (message_arena != submessage_arena) {
       stochastic_loss_rate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, stochastic_loss_rate, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000040u;
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000040u;
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
-  stochastic_loss_rate_ = stochastic_loss_rate;
+  _impl_.stochastic_loss_rate_ = stochastic_loss_rate;
   // @@protoc_insertion_point(field_set_allocated:RemyBuffers.ConfigRange.stochastic_loss_rate)
 }
 
@@ -5664,26 +6013,26 @@ inline void ConfigRange::set_allocated_stochastic_loss_rate(::RemyBuffers::Range
 
 // optional double mean_on_duration = 1;
 inline bool NetConfig::_internal_has_mean_on_duration() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool NetConfig::has_mean_on_duration() const {
   return _internal_has_mean_on_duration();
 }
 inline void NetConfig::clear_mean_on_duration() {
-  mean_on_duration_ = 0;
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.mean_on_duration_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline double NetConfig::_internal_mean_on_duration() const {
-  return mean_on_duration_;
+  return _impl_.mean_on_duration_;
 }
 inline double NetConfig::mean_on_duration() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.NetConfig.mean_on_duration)
   return _internal_mean_on_duration();
 }
 inline void NetConfig::_internal_set_mean_on_duration(double value) {
-  _has_bits_[0] |= 0x00000001u;
-  mean_on_duration_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.mean_on_duration_ = value;
 }
 inline void NetConfig::set_mean_on_duration(double value) {
   _internal_set_mean_on_duration(value);
@@ -5692,26 +6041,26 @@ inline void NetConfig::set_mean_on_duration(double value) {
 
 // optional double mean_off_duration = 2;
 inline bool NetConfig::_internal_has_mean_off_duration() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool NetConfig::has_mean_off_duration() const {
   return _internal_has_mean_off_duration();
 }
 inline void NetConfig::clear_mean_off_duration() {
-  mean_off_duration_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.mean_off_duration_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline double NetConfig::_internal_mean_off_duration() const {
-  return mean_off_duration_;
+  return _impl_.mean_off_duration_;
 }
 inline double NetConfig::mean_off_duration() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.NetConfig.mean_off_duration)
   return _internal_mean_off_duration();
 }
 inline void NetConfig::_internal_set_mean_off_duration(double value) {
-  _has_bits_[0] |= 0x00000002u;
-  mean_off_duration_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.mean_off_duration_ = value;
 }
 inline void NetConfig::set_mean_off_duration(double value) {
   _internal_set_mean_off_duration(value);
@@ -5720,54 +6069,54 @@ inline void NetConfig::set_mean_off_duration(double value) {
 
 // optional uint32 num_senders = 3;
 inline bool NetConfig::_internal_has_num_senders() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool NetConfig::has_num_senders() const {
   return _internal_has_num_senders();
 }
 inline void NetConfig::clear_num_senders() {
-  num_senders_ = 0u;
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.num_senders_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 NetConfig::_internal_num_senders() const {
-  return num_senders_;
+inline uint32_t NetConfig::_internal_num_senders() const {
+  return _impl_.num_senders_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 NetConfig::num_senders() const {
+inline uint32_t NetConfig::num_senders() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.NetConfig.num_senders)
   return _internal_num_senders();
 }
-inline void NetConfig::_internal_set_num_senders(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _has_bits_[0] |= 0x00000008u;
-  num_senders_ = value;
+inline void NetConfig::_internal_set_num_senders(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.num_senders_ = value;
 }
-inline void NetConfig::set_num_senders(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void NetConfig::set_num_senders(uint32_t value) {
   _internal_set_num_senders(value);
   // @@protoc_insertion_point(field_set:RemyBuffers.NetConfig.num_senders)
 }
 
 // optional double link_ppt = 4;
 inline bool NetConfig::_internal_has_link_ppt() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool NetConfig::has_link_ppt() const {
   return _internal_has_link_ppt();
 }
 inline void NetConfig::clear_link_ppt() {
-  link_ppt_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.link_ppt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline double NetConfig::_internal_link_ppt() const {
-  return link_ppt_;
+  return _impl_.link_ppt_;
 }
 inline double NetConfig::link_ppt() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.NetConfig.link_ppt)
   return _internal_link_ppt();
 }
 inline void NetConfig::_internal_set_link_ppt(double value) {
-  _has_bits_[0] |= 0x00000004u;
-  link_ppt_ = value;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.link_ppt_ = value;
 }
 inline void NetConfig::set_link_ppt(double value) {
   _internal_set_link_ppt(value);
@@ -5776,26 +6125,26 @@ inline void NetConfig::set_link_ppt(double value) {
 
 // optional double delay = 5;
 inline bool NetConfig::_internal_has_delay() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
 inline bool NetConfig::has_delay() const {
   return _internal_has_delay();
 }
 inline void NetConfig::clear_delay() {
-  delay_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.delay_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
 inline double NetConfig::_internal_delay() const {
-  return delay_;
+  return _impl_.delay_;
 }
 inline double NetConfig::delay() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.NetConfig.delay)
   return _internal_delay();
 }
 inline void NetConfig::_internal_set_delay(double value) {
-  _has_bits_[0] |= 0x00000020u;
-  delay_ = value;
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.delay_ = value;
 }
 inline void NetConfig::set_delay(double value) {
   _internal_set_delay(value);
@@ -5804,54 +6153,54 @@ inline void NetConfig::set_delay(double value) {
 
 // optional uint32 buffer_size = 6;
 inline bool NetConfig::_internal_has_buffer_size() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool NetConfig::has_buffer_size() const {
   return _internal_has_buffer_size();
 }
 inline void NetConfig::clear_buffer_size() {
-  buffer_size_ = 0u;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.buffer_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 NetConfig::_internal_buffer_size() const {
-  return buffer_size_;
+inline uint32_t NetConfig::_internal_buffer_size() const {
+  return _impl_.buffer_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 NetConfig::buffer_size() const {
+inline uint32_t NetConfig::buffer_size() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.NetConfig.buffer_size)
   return _internal_buffer_size();
 }
-inline void NetConfig::_internal_set_buffer_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _has_bits_[0] |= 0x00000010u;
-  buffer_size_ = value;
+inline void NetConfig::_internal_set_buffer_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.buffer_size_ = value;
 }
-inline void NetConfig::set_buffer_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void NetConfig::set_buffer_size(uint32_t value) {
   _internal_set_buffer_size(value);
   // @@protoc_insertion_point(field_set:RemyBuffers.NetConfig.buffer_size)
 }
 
 // optional double stochastic_loss_rate = 7;
 inline bool NetConfig::_internal_has_stochastic_loss_rate() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
   return value;
 }
 inline bool NetConfig::has_stochastic_loss_rate() const {
   return _internal_has_stochastic_loss_rate();
 }
 inline void NetConfig::clear_stochastic_loss_rate() {
-  stochastic_loss_rate_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.stochastic_loss_rate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
 inline double NetConfig::_internal_stochastic_loss_rate() const {
-  return stochastic_loss_rate_;
+  return _impl_.stochastic_loss_rate_;
 }
 inline double NetConfig::stochastic_loss_rate() const {
   // @@protoc_insertion_point(field_get:RemyBuffers.NetConfig.stochastic_loss_rate)
   return _internal_stochastic_loss_rate();
 }
 inline void NetConfig::_internal_set_stochastic_loss_rate(double value) {
-  _has_bits_[0] |= 0x00000040u;
-  stochastic_loss_rate_ = value;
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.stochastic_loss_rate_ = value;
 }
 inline void NetConfig::set_stochastic_loss_rate(double value) {
   _internal_set_stochastic_loss_rate(value);
@@ -5864,41 +6213,42 @@ inline void NetConfig::set_stochastic_loss_rate(double value) {
 
 // repeated .RemyBuffers.NetConfig config = 81;
 inline int ConfigVector::_internal_config_size() const {
-  return config_.size();
+  return _impl_.config_.size();
 }
 inline int ConfigVector::config_size() const {
   return _internal_config_size();
 }
 inline void ConfigVector::clear_config() {
-  config_.Clear();
+  _impl_.config_.Clear();
 }
 inline ::RemyBuffers::NetConfig* ConfigVector::mutable_config(int index) {
   // @@protoc_insertion_point(field_mutable:RemyBuffers.ConfigVector.config)
-  return config_.Mutable(index);
+  return _impl_.config_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::NetConfig >*
 ConfigVector::mutable_config() {
   // @@protoc_insertion_point(field_mutable_list:RemyBuffers.ConfigVector.config)
-  return &config_;
+  return &_impl_.config_;
 }
 inline const ::RemyBuffers::NetConfig& ConfigVector::_internal_config(int index) const {
-  return config_.Get(index);
+  return _impl_.config_.Get(index);
 }
 inline const ::RemyBuffers::NetConfig& ConfigVector::config(int index) const {
   // @@protoc_insertion_point(field_get:RemyBuffers.ConfigVector.config)
   return _internal_config(index);
 }
 inline ::RemyBuffers::NetConfig* ConfigVector::_internal_add_config() {
-  return config_.Add();
+  return _impl_.config_.Add();
 }
 inline ::RemyBuffers::NetConfig* ConfigVector::add_config() {
+  ::RemyBuffers::NetConfig* _add = _internal_add_config();
   // @@protoc_insertion_point(field_add:RemyBuffers.ConfigVector.config)
-  return _internal_add_config();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RemyBuffers::NetConfig >&
 ConfigVector::config() const {
   // @@protoc_insertion_point(field_list:RemyBuffers.ConfigVector.config)
-  return config_;
+  return _impl_.config_;
 }
 
 #ifdef __GNUC__
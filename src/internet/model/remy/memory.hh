@@ -4,6 +4,8 @@
 #include <vector>
 #include <string>
 #include <queue>
+#include <array>
+#include <cstdint>
 
 #include "dna.pb.h"
 #include "packet.hh"
@@ -12,84 +14,104 @@ class Memory {
 public:
   typedef double DataType;
 
+  static const unsigned int MAX_DATASIZE = 9;
+
+  /* bit mask with every signal set */
+  static const uint32_t ALL_AXES = ( 1u << MAX_DATASIZE ) - 1;
+
+  /* signal order, matching RemyBuffers::MemoryRange::Axis */
+  enum Axis {
+    SEND_EWMA = 0,
+    REC_EWMA,
+    RTT_RATIO,
+    SLOW_REC_EWMA,
+    RTT_DIFF,
+    QUEUEING_DELAY,
+    RECENT_LOSS,
+    INT_QUEUE,
+    INT_LINK
+  };
+
 private:
-  DataType _rec_send_ewma;
-  DataType _rec_rec_ewma;
-  DataType _rtt_ratio;
-  DataType _slow_rec_rec_ewma;
-  DataType _rtt_diff;
-  DataType _queueing_delay;
-  DataType _recent_loss;
-  DataType _int_queue;
-  DataType _int_link;
+  alignas( 16 ) std::array< DataType, MAX_DATASIZE > _data;
 
   double _last_tick_sent;
   double _last_tick_received;
   double _min_rtt;
   double _last_seq_no;
   std::queue< double > _losses;
-  const unsigned int _datasize;
+  unsigned int _datasize;
+  uint32_t _active_axes;
+
+  bool is_active( Axis axis ) const { return _active_axes & ( 1u << axis ); }
 
 public:
   Memory( const std::vector< DataType > & s_data )
-    : _rec_send_ewma( s_data.at( 0 ) ),
-      _rec_rec_ewma( s_data.at( 1 ) ),
-      _rtt_ratio( s_data.at( 2 ) ),
-      _slow_rec_rec_ewma( s_data.at( 3 ) ),
-      _rtt_diff( s_data.at(4) ),
-      _queueing_delay( s_data.at(5) ),
-      _recent_loss( s_data.at(6) ),
-      _int_queue( s_data.at(7) ),
-      _int_link( s_data.at(8) ),
+    : _data(),
       _last_tick_sent( 0 ),
       _last_tick_received( 0 ),
       _min_rtt( 0 ),
       _last_seq_no ( 0 ),
       _losses( ),
-      _datasize(atoi(getenv( "NUMDIMS" )))
-  {}
+      _datasize( MAX_DATASIZE ),
+      _active_axes( ALL_AXES )
+  {
+    for ( unsigned int i = 0; i < MAX_DATASIZE; i++ ) { _data[ i ] = s_data.at( i ); }
+  }
 
   Memory()
-    : _rec_send_ewma( 0 ),
-      _rec_rec_ewma( 0 ),
-      _rtt_ratio( 0.0 ),
-      _slow_rec_rec_ewma( 0 ),
-      _rtt_diff( 0 ),
-      _queueing_delay( 0 ),
-      _recent_loss( 0 ),
-      _int_queue( 0 ),
-      _int_link( 0 ),
+    : _data(),
       _last_tick_sent( 0 ),
       _last_tick_received( 0 ),
       _min_rtt( 0 ),
       _last_seq_no ( 0 ),
       _losses( ),
-      _datasize(atoi(getenv( "NUMDIMS" )))
+      _datasize( MAX_DATASIZE ),
+      _active_axes( ALL_AXES )
   {}
 
-  void reset( void ) { _rec_send_ewma = _rec_rec_ewma = _rtt_ratio = _slow_rec_rec_ewma = _rtt_diff = _queueing_delay = _recent_loss  = _int_queue = _int_link = _last_tick_sent = _last_tick_received = _min_rtt = _last_seq_no = 0; _losses = std::queue< double > (); }
+  void reset( void ) { _data.fill( 0 ); _last_tick_sent = _last_tick_received = _min_rtt = _last_seq_no = 0; _losses = std::queue< double > (); }
 
-  const DataType & field( unsigned int num ) const { return num == 0 ? _rec_send_ewma : num == 1 ? _rec_rec_ewma : num == 2 ? _rtt_ratio : num == 3 ? _slow_rec_rec_ewma : num == 4 ? _rtt_diff : num == 5 ? _queueing_delay : num == 6 ? _recent_loss : num == 7 ? _int_queue : _int_link ; }
-  DataType & mutable_field( unsigned int num )     { return num == 0 ? _rec_send_ewma : num == 1 ? _rec_rec_ewma : num == 2 ? _rtt_ratio : num == 3 ? _slow_rec_rec_ewma : num == 4 ? _rtt_diff : num == 5 ? _queueing_delay : num == 6 ? _recent_loss : num == 7 ? _int_queue : _int_link ; }
+  const DataType & field( unsigned int num ) const { return _data[ num ]; }
+  DataType & mutable_field( unsigned int num )     { return _data[ num ]; }
+  const DataType * data( void ) const { return _data.data(); }
 
   double min_rtt(void) {return _min_rtt;}
 
+  /* number of leading signals used in comparisons */
+  unsigned int datasize( void ) const { return _datasize; }
+  void set_datasize( unsigned int datasize ) { _datasize = datasize < MAX_DATASIZE ? datasize : MAX_DATASIZE; }
+
   void update( bool is_first, double sendrate, double deliveryrate, uint32_t losses, double minrtt, double lastrtt, uint32_t inflight );
+  /* signals updated by packets_received() (bit i set for axis i); the others keep their value.
+     the slow receive EWMA falls back on the receive EWMA, so it activates it too */
+  uint32_t active_axes( void ) const { return _active_axes; }
+  void set_active_axes( uint32_t axes )
+  {
+    if ( axes & ( 1u << SLOW_REC_EWMA ) ) { axes |= 1u << REC_EWMA; }
+    _active_axes = axes & ALL_AXES;
+  }
+
+  void packet_received( const RemyPacket & packet );
   void packets_received( const std::vector< RemyPacket > & packets );
 
   std::string str( void ) const;
 
-  bool operator>=( const Memory & other ) const { 
-    for (unsigned int i = 0; i < _datasize; i ++) { if ( field(i) < other.field(i) ) return false; }
-    return true;
+  /* comparisons run over every signal without early exit so they vectorize */
+  bool operator>=( const Memory & other ) const {
+    bool ret = true;
+    for (unsigned int i = 0; i < _datasize; i ++) { ret &= !( _data[ i ] < other._data[ i ] ); }
+    return ret;
   }
-  bool operator<( const Memory & other ) const { 
-    for (unsigned int i = 0; i < _datasize; i ++) { if ( field(i) >= other.field(i) ) return false; }
-    return true;
+  bool operator<( const Memory & other ) const {
+    bool ret = true;
+    for (unsigned int i = 0; i < _datasize; i ++) { ret &= !( _data[ i ] >= other._data[ i ] ); }
+    return ret;
   }
-  bool operator==( const Memory & other ) const { 
-    for (unsigned int i = 0; i < _datasize; i ++) { if ( field(i) != other.field(i) ) return false; }
-    return true;
+  bool operator==( const Memory & other ) const {
+    bool ret = true;
+    for (unsigned int i = 0; i < _datasize; i ++) { ret &= ( _data[ i ] == other._data[ i ] ); }
+    return ret;
   }
 
   Memory( const RemyBuffers::Memory & dna, unsigned int datasize );
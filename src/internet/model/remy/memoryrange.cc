@@ -4,7 +4,15 @@ using namespace std;
 
 bool MemoryRange::contains( const Memory & query ) const
 {
-  return (query >= _lower) && (query < _upper);
+  /* (query >= _lower) && (query < _upper) in a single pass */
+  const Memory::DataType * q = query.data();
+  const Memory::DataType * lo = _lower.data();
+  const Memory::DataType * hi = _upper.data();
+  bool ret = true;
+  for ( unsigned int i = 0; i < query.datasize(); i++ ) {
+    ret &= !( q[ i ] < lo[ i ] ) & !( q[ i ] >= hi[ i ] );
+  }
+  return ret;
 }
 
 bool MemoryRange::operator==( const MemoryRange & other ) const
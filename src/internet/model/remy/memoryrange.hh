@@ -9,15 +9,14 @@
 class MemoryRange {
 private:
   Memory _lower, _upper;
-  mutable unsigned int _count;  
 
 public:
   MemoryRange( const Memory & s_lower, const Memory & s_upper )
     : _lower( s_lower ), _upper( s_upper )
   {}
 
-  void use( void ) const {_count++;}
-  unsigned int count( void ) const { return _count; }
+  const Memory & lower( void ) const { return _lower; }
+  const Memory & upper( void ) const { return _upper; }
 
   bool contains( const Memory & query ) const;
 
@@ -14,14 +14,16 @@ private:
   double _window_multiple;
   double _intersend;
   MemoryRange _domain;
+  unsigned int _index; /* position among the leaves of the tree, set by WhiskerTree */
+
+  friend class WhiskerTree;
 
 public:
   unsigned int window( const unsigned int previous_window) const { return std::max( 0, (int)( (previous_window * _window_multiple) + _window_increment ) ); }
   const double & intersend( void ) const { return _intersend; }
   const MemoryRange & domain( void ) const { return _domain; }
 
-  void use( void ) const { _domain.use(); }
-  unsigned int count( void ) const { return _domain.count(); }
+  unsigned int index( void ) const { return _index; }
 
   Whisker( const RemyBuffers::Whisker & dna );
   std::string str( void ) const;
@@ -1,22 +1,23 @@
 #include <assert.h>
 #include <math.h>
 #include <algorithm>
+#include <limits>
 
 #include "whiskertree.hh"
 
 using namespace std;
 
+static const uint32_t NO_GRID = numeric_limits< uint32_t >::max();
+
 const Whisker & WhiskerTree::use_whisker( const Memory & _memory ) const
 {
-  const Whisker * ret( whisker( _memory ) );
+  const Whisker * ret( compiled_whisker( _memory ) );
 
   if ( !ret ) {
     fprintf( stderr, "ERROR: No whisker found for memory: %s\n", _memory.str().c_str() );
     exit( 1 );
   }
 
-  ret->use();
-
   assert( ret );
 
   return *ret;
@@ -44,25 +45,228 @@ const Whisker * WhiskerTree::whisker( const Memory & _memory ) const
   return nullptr;
 }
 
+static bool compiled_contains( const Memory::DataType * lower, const Memory::DataType * upper,
+                               const Memory::DataType * query, const unsigned int dims )
+{
+  /* same comparisons as Memory::operator>= and Memory::operator< */
+  for ( unsigned int i = 0; i < dims; i++ ) {
+    if ( query[ i ] < lower[ i ] ) return false;
+    if ( query[ i ] >= upper[ i ] ) return false;
+  }
+  return true;
+}
+
+const Whisker * WhiskerTree::compiled_whisker( const Memory & _memory ) const
+{
+  if ( _nodes.empty() ) {
+    return whisker( _memory );
+  }
+
+  const unsigned int dims = _memory.datasize();
+  const Memory::DataType * query = _memory.data();
+  bool ordered = true;
+  for ( unsigned int i = 0; i < dims; i++ ) {
+    ordered &= ( query[ i ] == query[ i ] );
+  }
+
+  const CompiledNode * node = &_nodes[ 0 ];
+  if ( !compiled_contains( node->lower, node->upper, query, dims ) ) {
+    return nullptr;
+  }
+
+  while ( !node->leaf ) {
+    if ( ordered && node->grid_offset != NO_GRID && node->max_split_axis < dims ) {
+      uint32_t cell = 0;
+      for ( unsigned int k = 0; k < node->num_splits; k++ ) {
+        cell |= uint32_t( query[ node->split_axis[ k ] ] >= node->split[ k ] ) << k;
+      }
+      node = &_nodes[ _grid[ node->grid_offset + cell ] ];
+      continue;
+    }
+
+    /* children do not tile the node: scan them in order like whisker() */
+    const CompiledNode * next = nullptr;
+    for ( uint32_t i = node->first_child; i < node->first_child + node->num_children; i++ ) {
+      if ( compiled_contains( _nodes[ i ].lower, _nodes[ i ].upper, query, dims ) ) {
+        next = &_nodes[ i ];
+        break;
+      }
+    }
+    if ( !next ) {
+      return nullptr;
+    }
+    node = next;
+  }
+
+  return node->leaf;
+}
+
 bool WhiskerTree::is_leaf( void ) const
 {
   return !_leaf.empty();
 }
 
 WhiskerTree::WhiskerTree( const RemyBuffers::WhiskerTree & dna )
+  : WhiskerTree( dna, true )
+{
+}
+
+WhiskerTree::WhiskerTree( const RemyBuffers::WhiskerTree & dna, bool compile_tree )
   : _domain( dna.domain() ),
+    _datasize( 0 ),
+    _active_axes( 0 ),
     _children(),
-    _leaf()
+    _leaf(),
+    _nodes(),
+    _grid()
 {
+  for ( const auto &axis : dna.domain().active_axis() ) {
+    _datasize = max( _datasize, (unsigned int) axis + 1 );
+    _active_axes |= 1u << axis;
+  }
+
   if ( dna.has_leaf() ) {
     assert( dna.children_size() == 0 );
     _leaf.emplace_back( dna.leaf() );
   } else {
     assert( dna.children_size() > 0 );
+    _children.reserve( dna.children_size() );
     for ( const auto &x : dna.children() ) {
-      _children.emplace_back( x );
+      _children.emplace_back( WhiskerTree( x, false ) );
+      _datasize = max( _datasize, _children.back()._datasize );
+      _active_axes |= _children.back()._active_axes;
     }
   }
+
+  /* trees without active axes predate the field and may split on any signal */
+  if ( _datasize == 0 ) {
+    _datasize = Memory::MAX_DATASIZE;
+    _active_axes = Memory::ALL_AXES;
+  }
+
+  if ( compile_tree ) {
+    compile();
+  }
+}
+
+void WhiskerTree::number_leaves( unsigned int & next )
+{
+  if ( is_leaf() ) {
+    _leaf[ 0 ]._index = next++;
+    return;
+  }
+
+  for ( auto &x : _children ) {
+    x.number_leaves( next );
+  }
+}
+
+void WhiskerTree::compile( void )
+{
+  unsigned int next = 0;
+  number_leaves( next );
+
+  _nodes.clear();
+  _grid.clear();
+
+  /* breadth-first, so the children of every node are contiguous */
+  vector< const WhiskerTree * > order( 1, this );
+  for ( size_t i = 0; i < order.size(); i++ ) {
+    const WhiskerTree * tree = order[ i ];
+
+    CompiledNode node;
+    for ( unsigned int j = 0; j < Memory::MAX_DATASIZE; j++ ) {
+      node.lower[ j ] = tree->_domain.lower().field( j );
+      node.upper[ j ] = tree->_domain.upper().field( j );
+    }
+    node.leaf = tree->leaf();
+    node.first_child = 0;
+    node.num_children = 0;
+    node.grid_offset = NO_GRID;
+    node.num_splits = 0;
+    node.max_split_axis = 0;
+
+    if ( !tree->is_leaf() ) {
+      node.first_child = order.size();
+      node.num_children = tree->_children.size();
+      for ( const auto &x : tree->_children ) {
+        order.push_back( &x );
+      }
+    }
+
+    _nodes.push_back( node );
+  }
+
+  for ( uint32_t i = 0; i < _nodes.size(); i++ ) {
+    compile_grid( i );
+  }
+}
+
+void WhiskerTree::compile_grid( uint32_t index )
+{
+  CompiledNode & node = _nodes[ index ];
+  if ( node.leaf || node.num_children == 0 ) {
+    return;
+  }
+
+  /* an axis is split if some child starts above the parent's lower bound */
+  uint8_t axes[ Memory::MAX_DATASIZE ];
+  Memory::DataType splits[ Memory::MAX_DATASIZE ];
+  int axis_bit[ Memory::MAX_DATASIZE ];
+  unsigned int num_splits = 0;
+  for ( unsigned int a = 0; a < Memory::MAX_DATASIZE; a++ ) {
+    axis_bit[ a ] = -1;
+    for ( uint32_t c = node.first_child; c < node.first_child + node.num_children; c++ ) {
+      const Memory::DataType lo = _nodes[ c ].lower[ a ];
+      if ( lo == node.lower[ a ] ) {
+        continue;
+      }
+      if ( axis_bit[ a ] < 0 ) {
+        axis_bit[ a ] = num_splits;
+        axes[ num_splits ] = a;
+        splits[ num_splits ] = lo;
+        num_splits++;
+      } else if ( lo != splits[ axis_bit[ a ] ] ) {
+        return; /* more than two intervals on this axis */
+      }
+    }
+  }
+
+  if ( ( 1u << num_splits ) != node.num_children ) {
+    return;
+  }
+
+  /* every child must be exactly one cell of the grid */
+  vector< uint32_t > cells( node.num_children, NO_GRID );
+  for ( uint32_t c = node.first_child; c < node.first_child + node.num_children; c++ ) {
+    uint32_t cell = 0;
+    for ( unsigned int a = 0; a < Memory::MAX_DATASIZE; a++ ) {
+      const Memory::DataType lo = _nodes[ c ].lower[ a ];
+      const Memory::DataType hi = _nodes[ c ].upper[ a ];
+      if ( axis_bit[ a ] < 0 ) {
+        if ( lo != node.lower[ a ] || hi != node.upper[ a ] ) return;
+      } else if ( lo == node.lower[ a ] && hi == splits[ axis_bit[ a ] ] ) {
+        /* lower half */
+      } else if ( lo == splits[ axis_bit[ a ] ] && hi == node.upper[ a ] ) {
+        cell |= 1u << axis_bit[ a ];
+      } else {
+        return;
+      }
+    }
+    if ( cells[ cell ] != NO_GRID ) {
+      return;
+    }
+    cells[ cell ] = c;
+  }
+
+  node.grid_offset = _grid.size();
+  node.num_splits = num_splits;
+  for ( unsigned int k = 0; k < num_splits; k++ ) {
+    node.split_axis[ k ] = axes[ k ];
+    node.split[ k ] = splits[ k ];
+    node.max_split_axis = max( node.max_split_axis, axes[ k ] );
+  }
+  _grid.insert( _grid.end(), cells.begin(), cells.end() );
 }
 
 string WhiskerTree::str() const
@@ -1,30 +1,84 @@
 #ifndef WHISKERTREE_HH
 #define WHISKERTREE_HH
 
+#include <vector>
+#include <cstdint>
+
 #include "whisker.hh"
 #include "memoryrange.hh"
 #include "dna.pb.h"
 
 class WhiskerTree {
 private:
+  /* flattened node of the compiled tree (children are contiguous) */
+  struct CompiledNode {
+    Memory::DataType lower[ Memory::MAX_DATASIZE ];
+    Memory::DataType upper[ Memory::MAX_DATASIZE ];
+    const Whisker * leaf;
+    uint32_t first_child;
+    uint32_t num_children;
+
+    /* children tile the node on a grid of bisected axes:
+       child index = sum over k of ( query[ split_axis[ k ] ] >= split[ k ] ) << k */
+    uint32_t grid_offset;
+    uint8_t num_splits;
+    uint8_t max_split_axis;
+    uint8_t split_axis[ Memory::MAX_DATASIZE ];
+    Memory::DataType split[ Memory::MAX_DATASIZE ];
+  };
+
   MemoryRange _domain;
+  unsigned int _datasize;
+  uint32_t _active_axes;
 
   std::vector< WhiskerTree > _children;
   std::vector< Whisker > _leaf;
 
-  const Whisker * whisker( const Memory & _memory ) const;
+  /* only populated on the root */
+  std::vector< CompiledNode > _nodes;
+  std::vector< uint32_t > _grid;
+
+  WhiskerTree( const RemyBuffers::WhiskerTree & dna, bool compile );
+
+  void number_leaves( unsigned int & next );
+  void compile( void );
+  void compile_grid( uint32_t index );
 
 public:
   const Whisker & use_whisker( const Memory & _memory ) const;
 
+  /* reference lookup: recursive scan of the children */
+  const Whisker * whisker( const Memory & _memory ) const;
+
+  /* flat lookup: same result as whisker(), without the recursion */
+  const Whisker * compiled_whisker( const Memory & _memory ) const;
+
   bool is_leaf( void ) const;
 
   WhiskerTree( const RemyBuffers::WhiskerTree & dna );
 
+  /* compiled nodes point into the leaves, so trees may move but not be copied */
+  WhiskerTree( const WhiskerTree & other ) = delete;
+  WhiskerTree & operator=( const WhiskerTree & other ) = delete;
+  WhiskerTree( WhiskerTree && other ) = default;
+  WhiskerTree & operator=( WhiskerTree && other ) = default;
+
   std::string str( void ) const;
 
+  /* number of leading signals the tree splits on */
+  unsigned int datasize( void ) const { return _datasize; }
+
+  /* axes any node of the tree splits on (bit i set for axis i), for Memory::set_active_axes() */
+  uint32_t active_axes( void ) const { return _active_axes; }
+
   unsigned int num_children( void ) const;
+
+  /* leaves are numbered 0 .. total_whiskers() - 1 (Whisker::index()) in the order str() prints them */
   unsigned int total_whiskers( void ) const;
+
+  const std::vector< WhiskerTree > & children( void ) const { return _children; }
+  const MemoryRange & domain( void ) const { return _domain; }
+  const Whisker * leaf( void ) const { return is_leaf() ? &_leaf[ 0 ] : nullptr; }
 };
 
 #endif
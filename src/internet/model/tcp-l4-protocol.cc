@@ -100,6 +100,7 @@ TcpL4Protocol::TcpL4Protocol ()
   : m_endPoints (new Ipv4EndPointDemux ()), m_endPoints6 (new Ipv6EndPointDemux ())
 {
   NS_LOG_FUNCTION (this);
+  m_socketFactory.SetTypeId (TcpSocketBase::GetTypeId ());
 }
 
 TcpL4Protocol::~TcpL4Protocol ()
@@ -199,7 +200,7 @@ TcpL4Protocol::CreateSocket (TypeId congestionTypeId, TypeId recoveryTypeId)
   recoveryAlgorithmFactory.SetTypeId (recoveryTypeId);
 
   Ptr<RttEstimator> rtt = rttFactory.Create<RttEstimator> ();
-  Ptr<TcpSocketBase> socket = CreateObject<TcpSocketBase> ();
+  Ptr<TcpSocketBase> socket = m_socketFactory.Create<TcpSocketBase> ();
   Ptr<TcpCongestionOps> algo = congestionAlgorithmFactory.Create<TcpCongestionOps> ();
   Ptr<TcpRecoveryOps> recovery = recoveryAlgorithmFactory.Create<TcpRecoveryOps> ();
 
@@ -219,6 +220,13 @@ TcpL4Protocol::CreateSocket (void)
   return CreateSocket (m_congestionTypeId, m_recoveryTypeId);
 }
 
+void
+TcpL4Protocol::SetSocketAttribute (std::string name, const AttributeValue &value)
+{
+  NS_LOG_FUNCTION (this << name);
+  m_socketFactory.Set (name, value);
+}
+
 Ipv4EndPoint *
 TcpL4Protocol::Allocate (void)
 {
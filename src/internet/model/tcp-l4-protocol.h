@@ -26,6 +26,7 @@
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv6-address.h"
 #include "ns3/sequence-number.h"
+#include "ns3/object-factory.h"
 #include "ip-l4-protocol.h"
 
 
@@ -132,6 +133,20 @@ public:
     */
   Ptr<Socket> CreateSocket (TypeId congestionTypeId);
 
+  /**
+   * \brief Set an attribute of every socket this protocol creates from now on
+   *
+   * The attributes are applied when CreateSocket constructs the socket, on
+   * top of the defaults set with Config::SetDefault, so sockets are never
+   * seen with their default values. Sockets forked by a listening socket
+   * copy its attributes, so they are covered too. Sockets that already
+   * exist are not changed.
+   *
+   * \param name the name of an attribute of ns3::TcpSocketBase (or its parents)
+   * \param value the value of the attribute
+   */
+  void SetSocketAttribute (std::string name, const AttributeValue &value);
+
   /**
    * \brief Allocate an IPv4 Endpoint
    * \return the Endpoint
@@ -325,6 +340,7 @@ private:
   TypeId m_congestionTypeId;       //!< The socket TypeId
   TypeId m_recoveryTypeId;         //!< The recovery TypeId
   std::vector<Ptr<TcpSocketBase> > m_sockets;      //!< list of sockets
+  ObjectFactory m_socketFactory;   //!< Socket template, with the attributes of SetSocketAttribute
   IpL4Protocol::DownTargetCallback m_downTarget;   //!< Callback to send packets over IPv4
   IpL4Protocol::DownTargetCallback6 m_downTarget6; //!< Callback to send packets over IPv6
 
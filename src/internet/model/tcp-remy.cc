@@ -1,4 +1,6 @@
 #include <stdlib.h>
+#include <errno.h>
+#include <string.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <iostream>
@@ -9,6 +11,10 @@
 #include <fstream>
 
 #include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 
 #include "tcp-remy.h"
 
@@ -20,54 +26,303 @@ NS_LOG_COMPONENT_DEFINE ("TcpRemy");
 
 namespace ns3 {
 
+std::mutex RemyWhiskerRegistry::m_mutex;
+std::map<std::string, std::shared_ptr<const WhiskerTree> > RemyWhiskerRegistry::m_trees;
+
+std::mutex RemyWhiskerUsage::m_mutex;
+std::vector<std::unique_ptr<RemyWhiskerUsage::Counters> > RemyWhiskerUsage::m_counters;
+std::vector<RemyWhiskerUsage::FlowCounters> RemyWhiskerUsage::m_flows;
+std::string RemyWhiskerUsage::m_filename;
+
+std::string RemyAckLog::m_filename;
+std::unique_ptr<AckLogWriter> RemyAckLog::m_writer;
+
+static uint32_t g_remyFlows = 0; //!< Ids handed out to TcpRemy instances
+
+std::shared_ptr<const WhiskerTree>
+RemyWhiskerRegistry::Get (const std::string &filename)
+{
+  NS_LOG_FUNCTION (filename);
+
+  /* key by canonical path so that different spellings share one tree */
+  std::string key = filename;
+  char *resolved = realpath (filename.c_str (), nullptr);
+  if (resolved)
+    {
+      key = resolved;
+      free (resolved);
+    }
+
+  std::lock_guard<std::mutex> lock (m_mutex);
+  auto it = m_trees.find (key);
+  if (it != m_trees.end ())
+    {
+      return it->second;
+    }
+
+  std::shared_ptr<const WhiskerTree> tree = Load (key);
+  m_trees.emplace (key, tree);
+  return tree;
+}
+
+std::string
+RemyWhiskerRegistry::GetFilename (const WhiskerTree *tree)
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  for (const auto &entry : m_trees)
+    {
+      if (entry.second.get () == tree)
+        {
+          return entry.first;
+        }
+    }
+  return "";
+}
+
+void
+RemyWhiskerRegistry::Clear (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  std::lock_guard<std::mutex> lock (m_mutex);
+  m_trees.clear ();
+}
+
+std::shared_ptr<const WhiskerTree>
+RemyWhiskerRegistry::Load (const std::string &filename)
+{
+  NS_LOG_FUNCTION (filename);
+
+  /* open file */
+  int fd = open (filename.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      NS_FATAL_ERROR ("RemyTCP: Could not open whiskers in \"" << filename << "\": " << strerror (errno));
+    }
+
+  /* parse whisker definition */
+  RemyBuffers::WhiskerTree tree;
+  if (!tree.ParseFromFileDescriptor (fd))
+    {
+      NS_FATAL_ERROR ("RemyTCP: Could not parse whiskers in \"" << filename << "\"");
+    }
+
+  /* close file */
+  if (::close (fd) < 0)
+    {
+      NS_FATAL_ERROR ("RemyTCP: Could not close whiskers in \"" << filename << "\": " << strerror (errno));
+    }
+
+  NS_LOG_INFO ("Loaded whiskers from " << filename);
+  return std::make_shared<const WhiskerTree> (tree);
+}
+
+void
+RemyWhiskerUsage::Enable (const std::string &filename)
+{
+  NS_LOG_FUNCTION (filename);
+  std::lock_guard<std::mutex> lock (m_mutex);
+  if (m_filename.empty ())
+    {
+      std::atexit (&RemyWhiskerUsage::Write);
+    }
+  m_filename = filename;
+}
+
+RemyWhiskerUsage::Counters *
+RemyWhiskerUsage::NewCounters (const std::shared_ptr<const WhiskerTree> &tree)
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  m_counters.emplace_back (new Counters);
+  m_counters.back ()->tree = tree;
+  m_counters.back ()->uses.assign (tree->total_whiskers (), 0);
+  return m_counters.back ().get ();
+}
+
+void
+RemyWhiskerUsage::Use (const std::shared_ptr<const WhiskerTree> &tree, uint32_t leaf)
+{
+  /* threads almost always use a single tree, so remember the last one */
+  static thread_local Counters *last = nullptr;
+  static thread_local std::map<const WhiskerTree *, Counters *> counters;
+  if (!last || last->tree != tree)
+    {
+      Counters *&entry = counters[tree.get ()];
+      if (!entry)
+        {
+          entry = NewCounters (tree);
+        }
+      last = entry;
+    }
+  last->uses[leaf]++;
+}
+
+void
+RemyWhiskerUsage::AddFlow (const std::shared_ptr<const WhiskerTree> &tree, uint32_t flow,
+                           const std::vector<uint64_t> &uses)
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  m_flows.push_back (FlowCounters {tree, flow, uses});
+}
+
+void
+RemyWhiskerUsage::Write (void)
+{
+  std::lock_guard<std::mutex> lock (m_mutex);
+  if (m_filename.empty ())
+    {
+      return;
+    }
+
+  /* merge the threads, keeping trees in order of first use */
+  std::vector<std::shared_ptr<const WhiskerTree> > trees;
+  std::vector<std::vector<uint64_t> > totals;
+  auto treeIndex = [&] (const std::shared_ptr<const WhiskerTree> &tree) -> uint32_t
+    {
+      for (uint32_t i = 0; i < trees.size (); i++)
+        {
+          if (trees[i] == tree)
+            {
+              return i;
+            }
+        }
+      trees.push_back (tree);
+      totals.emplace_back (tree->total_whiskers (), 0);
+      return trees.size () - 1;
+    };
+  for (const auto &counters : m_counters)
+    {
+      std::vector<uint64_t> &total = totals[treeIndex (counters->tree)];
+      for (uint32_t i = 0; i < total.size (); i++)
+        {
+          total[i] += counters->uses[i];
+        }
+    }
+  for (const auto &flow : m_flows)
+    {
+      treeIndex (flow.tree);
+    }
+
+  std::ofstream out (m_filename.c_str (), std::ios::binary | std::ios::trunc);
+  if (!out)
+    {
+      NS_LOG_ERROR ("RemyTCP: Could not write whisker usage to \"" << m_filename << "\"");
+      return;
+    }
+  auto writeU32 = [&out] (uint32_t value) { out.write ((const char *) &value, sizeof (value)); };
+  auto writeUses = [&out] (const std::vector<uint64_t> &uses)
+    {
+      out.write ((const char *) uses.data (), uses.size () * sizeof (uint64_t));
+    };
+
+  out.write ("REMYUSE1", 8);
+  writeU32 (trees.size ());
+  for (uint32_t i = 0; i < trees.size (); i++)
+    {
+      std::string name = RemyWhiskerRegistry::GetFilename (trees[i].get ());
+      writeU32 (name.size ());
+      out.write (name.data (), name.size ());
+      writeU32 (totals[i].size ());
+      writeUses (totals[i]);
+    }
+  writeU32 (m_flows.size ());
+  for (const auto &flow : m_flows)
+    {
+      writeU32 (treeIndex (flow.tree));
+      writeU32 (flow.flow);
+      writeUses (flow.uses);
+    }
+}
+
+void
+RemyAckLog::Open (const std::string &filename)
+{
+  NS_LOG_FUNCTION (filename);
+  if (m_writer && filename == m_filename)
+    {
+      return;
+    }
+  if (!m_writer && m_filename.empty ())
+    {
+      std::atexit (&RemyAckLog::Close);
+    }
+  m_writer.reset (new AckLogWriter (filename));
+  m_filename = filename;
+  if (!m_writer->is_open ())
+    {
+      NS_FATAL_ERROR ("RemyTCP: Could not open decision log \"" << filename << "\"");
+    }
+}
+
+void
+RemyAckLog::Write (const AckRecord &record)
+{
+  if (m_writer)
+    {
+      m_writer->write (record);
+    }
+}
+
+void
+RemyAckLog::Close (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  m_writer.reset ();
+}
+
 NS_OBJECT_ENSURE_REGISTERED (TcpRemy);
 
 TypeId
 TcpRemy::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::TcpRemy")
-    .SetParent<TcpSocketBase> ()
+    .SetParent<TcpCongestionOps> ()
     .AddConstructor<TcpRemy> ()
     .SetGroupName ("Internet")
+    .AddAttribute ("WhiskerFile",
+                   "Path to the serialized whisker tree. Trees are loaded once "
+                   "per process and shared by all sockets using the same file.",
+                   StringValue (""),
+                   MakeStringAccessor (&TcpRemy::SetWhiskerFile,
+                                       &TcpRemy::GetWhiskerFile),
+                   MakeStringChecker ())
+    .AddAttribute ("SignalDimensions",
+                   "Number of leading signals compared against the whisker "
+                   "tree (0 uses the dimensionality of the tree).",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TcpRemy::SetSignalDimensions,
+                                         &TcpRemy::GetSignalDimensions),
+                   MakeUintegerChecker<uint32_t> (0, Memory::MAX_DATASIZE))
+    .AddAttribute ("UsageStatsFile",
+                   "If set, count how often each whisker is used and write the "
+                   "counts of the whole process to this file (see RemyWhiskerUsage).",
+                   StringValue (""),
+                   MakeStringAccessor (&TcpRemy::SetUsageStatsFile,
+                                       &TcpRemy::GetUsageStatsFile),
+                   MakeStringChecker ())
+    .AddAttribute ("AckLogFile",
+                   "If set, log every decision with its input to this file "
+                   "for offline replay (see RemyAckLog).",
+                   StringValue (""),
+                   MakeStringAccessor (&TcpRemy::SetAckLogFile,
+                                       &TcpRemy::GetAckLogFile),
+                   MakeStringChecker ())
+    .AddAttribute ("UsageStatsPerFlow",
+                   "Also record the whisker usage of each flow in the usage statistics.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&TcpRemy::_usage_per_flow),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
 
 TcpRemy::TcpRemy ()
-  : TcpCongestionOps ()
+  : TcpCongestionOps (),
+    _signal_dims (0),
+    _usage_per_flow (false),
+    _ack_record ()
 {
   NS_LOG_FUNCTION (this);
-  id = rand() % 1000;
-  
-  /* get whisker filename */
-	const char *filename = getenv( "WHISKERS" );
-	if ( !filename ) {
-		fprintf( stderr, "RemyTCP: Missing WHISKERS environment variable.\n" );
-		throw 1;
-	}
-
-	/* open file */
-	int fd = open( filename, O_RDONLY );
-	if ( fd < 0 ) {
-		perror( "open" );
-		throw 1;
-	}
-
-	/* parse whisker definition */
-	RemyBuffers::WhiskerTree tree;
-	if ( !tree.ParseFromFileDescriptor( fd ) ) {
-		fprintf( stderr, "RemyTCP: Could not parse whiskers in \"%s\".\n", filename );
-		throw 1;
-	}
-
-	/* close file */
-	if ( ::close( fd ) < 0 ) {
-		perror( "close" );
-		throw 1;
-	}
-
-	/* store whiskers */
-	_whiskers = new WhiskerTree( tree );
+  id = g_remyFlows++;
 
 	_pkts_acked = false;
 	_acks = 0;
@@ -80,34 +335,28 @@ TcpRemy::~TcpRemy ()
 {
 	NS_LOG_FUNCTION (this);
 	
-	int save_whiskers = atoi(getenv( "SAVEWHISKERS" ));
-
-	if (save_whiskers == 1) {
-		/* dump whiskers to file */
-		/* open file */
-		std::ofstream fd;
-		std::ostringstream oss;
-  		oss << "./whiskers-" << id << ".txt";
-		fd.open( oss.str().c_str() );
 
-		/* parse whisker definition */
-		fd << _whiskers->str();
-
-		/* close file */
-		fd.close();
+	if (!_usage.empty ()) {
+		RemyWhiskerUsage::AddFlow (_whiskers, id, _usage);
 	}
 }
 
 
 TcpRemy::TcpRemy (const TcpRemy &sock)
   : TcpCongestionOps (sock),
+    _whisker_file (sock._whisker_file),
     _whiskers (sock._whiskers),
+    _signal_dims (sock._signal_dims),
+    _usage_file (sock._usage_file),
+    _usage_per_flow (sock._usage_per_flow),
+    _ack_log_file (sock._ack_log_file),
+    _ack_record (),
     _memory (sock._memory),
     _intersend_time (sock._intersend_time),
 	_last_last_send_attempt (sock._last_last_send_attempt),
 	_pkts_acked (sock._pkts_acked),
 	_cwnd (sock._cwnd),
-	id(sock.id),
+	id(g_remyFlows++),
 	_acks(sock._acks),
 	_pkts(sock._pkts),
 	_reset(sock._reset),
@@ -122,28 +371,120 @@ TcpRemy::GetName () const
 	return "TcpRemy";
 }
 
+void
+TcpRemy::SetWhiskerFile (const std::string &filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  _whisker_file = filename;
+  _whiskers = filename.empty () ? nullptr : RemyWhiskerRegistry::Get (filename);
+  update_datasize ();
+}
+
+std::string
+TcpRemy::GetWhiskerFile (void) const
+{
+  return _whisker_file;
+}
+
+void
+TcpRemy::SetSignalDimensions (uint32_t dims)
+{
+  NS_LOG_FUNCTION (this << dims);
+  _signal_dims = dims;
+  update_datasize ();
+}
+
+uint32_t
+TcpRemy::GetSignalDimensions (void) const
+{
+  return _signal_dims;
+}
+
+void
+TcpRemy::SetUsageStatsFile (const std::string &filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  _usage_file = filename;
+  if (!filename.empty ())
+    {
+      RemyWhiskerUsage::Enable (filename);
+    }
+}
+
+std::string
+TcpRemy::GetUsageStatsFile (void) const
+{
+  return _usage_file;
+}
+
+void
+TcpRemy::SetAckLogFile (const std::string &filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  _ack_log_file = filename;
+  if (!filename.empty ())
+    {
+      RemyAckLog::Open (filename);
+    }
+}
+
+std::string
+TcpRemy::GetAckLogFile (void) const
+{
+  return _ack_log_file;
+}
+
+void
+TcpRemy::update_datasize( void )
+{
+  if (_signal_dims != 0)
+    {
+      _memory.set_datasize (_signal_dims);
+    }
+  else if (_whiskers)
+    {
+      _memory.set_datasize (_whiskers->datasize ());
+    }
+
+  // Only compute the signals the tree splits on; the pacing rate always
+  // needs the receive EWMA
+  _memory.set_active_axes ((_whiskers ? _whiskers->active_axes () : Memory::ALL_AXES)
+                           | (1u << Memory::REC_EWMA));
+}
+
 void
 TcpRemy::update_cwnd_and_pacing( Ptr<TcpSocketState> tcb )
 {
 	NS_LOG_FUNCTION (this << tcb);
 	NS_LOG_DEBUG ("Updating CWND and pacing for Remy ID " << id);
+	NS_ABORT_MSG_UNLESS (_whiskers, "RemyTCP: no whisker tree; set ns3::TcpRemy::WhiskerFile");
 
 	const Whisker & current_whisker( _whiskers->use_whisker( _memory ) );
+	if (!_usage_file.empty ()) {
+		RemyWhiskerUsage::Use (_whiskers, current_whisker.index ());
+		if (_usage_per_flow) {
+			_usage.resize (_whiskers->total_whiskers (), 0);
+			_usage[current_whisker.index ()]++;
+		}
+	}
 	NS_LOG_DEBUG ("Current memory: " << _memory.str());
 	NS_LOG_DEBUG ("Whisker: " << current_whisker.str());
 	
-	unsigned int new_cwnd = current_whisker.window( _cwnd );
-
-	if (new_cwnd > 16384)
-	{
-		new_cwnd = 16384;
-	}
-	_cwnd = new_cwnd;
-	tcb->m_cWnd = (new_cwnd) * tcb->m_segmentSize;
+	AckReplay::Decision decision = AckReplay::decide( current_whisker, _cwnd, _memory );
+	_cwnd = decision.window;
+	tcb->m_cWnd = (decision.window) * tcb->m_segmentSize;
 
 	NS_LOG_DEBUG("Intersend: " << current_whisker.intersend());
 
-	_intersend_time =  current_whisker.intersend() * _memory.field(1); //
+	_intersend_time = decision.intersend;
+
+	if (!_ack_log_file.empty ()) {
+		_ack_record.flow = id;
+		_ack_record.datasize = _memory.datasize ();
+		_ack_record.window = decision.window;
+		_ack_record.intersend = decision.intersend;
+		RemyAckLog::Write (_ack_record);
+	}
 
 	if (_intersend_time == 0) 
 	{
@@ -174,6 +515,7 @@ TcpRemy::Reset (Ptr<TcpSocketState> tcb, Ptr<RttEstimator> rtt)
 	_memory.reset();
 	_cwnd = 0;
 	_pkts_acked = false;
+	_ack_record.kind = AckRecord::RESET;
 	update_cwnd_and_pacing(tcb);
 	tcb->m_initialCWnd = tcb->m_cWnd / tcb->m_segmentSize;
 }
@@ -215,6 +557,7 @@ TcpRemy::Init (Ptr<TcpSocketState> tcb)
 	tcb->m_pacing = true;
 	tcb->m_paceInitialWindow = true;
 	_cwnd = 0;
+	_ack_record.kind = AckRecord::INIT;
 	update_cwnd_and_pacing(tcb);
 	tcb->m_initialCWnd = tcb->m_cWnd / tcb->m_segmentSize;
 }
@@ -230,8 +573,13 @@ void
 TcpRemy::update_memory( const RemyPacket packet )
 {
 	NS_LOG_FUNCTION (this);
-	std::vector< RemyPacket > packets( 1, packet );
-	_memory.packets_received( packets );
+	_memory.packet_received( packet );
+	_ack_record.kind = AckRecord::ACK;
+	_ack_record.tick_sent = packet.tick_sent;
+	_ack_record.tick_received = packet.tick_received;
+	_ack_record.seq_no = packet.seq_no;
+	_ack_record.queue_stat = packet.queue_stat;
+	_ack_record.link_stat = packet.link_stat;
 }
 
 void TcpRemy::CongControl (Ptr<TcpSocketState> tcb, const TcpRateOps::TcpRateConnection &rc, const TcpRateOps::TcpRateSample &rs)
@@ -4,6 +4,11 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "ns3/tcp-congestion-ops.h"
 #include "ns3/tcp-socket-base.h"
@@ -13,9 +18,166 @@
 #include "ns3/memory.hh"
 #include "ns3/whiskertree.hh"
 #include "ns3/packet.hh"
+#include "ns3/acklog.hh"
 
 namespace ns3 {
 
+/**
+ * \brief Process-wide cache of parsed whisker trees.
+ *
+ * Each whisker file is opened and parsed once per process, no matter how
+ * many sockets or simulations use it. Trees are handed out read-only and
+ * stay alive as long as the registry or any socket still references them.
+ */
+class RemyWhiskerRegistry
+{
+public:
+  /**
+   * \brief Get the whisker tree stored in a file, loading it on first use.
+   * \param filename path to a serialized RemyBuffers::WhiskerTree
+   * \return the shared tree
+   */
+  static std::shared_ptr<const WhiskerTree> Get (const std::string &filename);
+
+  /**
+   * \brief Get the file a cached tree was loaded from.
+   * \param tree a tree returned by Get ()
+   * \return the canonical path of the file, or an empty string if the tree is not cached
+   */
+  static std::string GetFilename (const WhiskerTree *tree);
+
+  /**
+   * \brief Drop the registry's references to all cached trees.
+   *
+   * Trees still held by live sockets are freed once those sockets go away.
+   */
+  static void Clear (void);
+
+private:
+  /**
+   * \brief Parse a whisker tree from disk.
+   * \param filename path to a serialized RemyBuffers::WhiskerTree
+   * \return the parsed tree
+   */
+  static std::shared_ptr<const WhiskerTree> Load (const std::string &filename);
+
+  static std::mutex m_mutex; //!< Protects m_trees
+  static std::map<std::string, std::shared_ptr<const WhiskerTree> > m_trees; //!< Trees by canonical path
+};
+
+/**
+ * \brief Process-wide whisker usage statistics.
+ *
+ * Counts how often each leaf (Whisker::index ()) of each whisker tree is
+ * used, and optionally how often each flow used it. Every thread counts
+ * into its own array, so recording a use is a plain increment; Write ()
+ * merges the arrays and writes a single file with the totals so far.
+ *
+ * File format (native byte order):
+ *   char[8] "REMYUSE1"
+ *   u32 number of trees, then for each tree:
+ *     u32 name length, char[] whisker file, u32 number of leaves, u64 uses[leaves]
+ *   u32 number of flows, then for each flow:
+ *     u32 tree (index in the list above), u32 flow id, u64 uses[leaves of that tree]
+ */
+class RemyWhiskerUsage
+{
+public:
+  /**
+   * \brief Start collecting statistics.
+   * \param filename file written by Write ()
+   */
+  static void Enable (const std::string &filename);
+
+  /**
+   * \brief Count one use of a leaf by the calling thread.
+   * \param tree the tree
+   * \param leaf index of the leaf in the tree
+   */
+  static void Use (const std::shared_ptr<const WhiskerTree> &tree, uint32_t leaf);
+
+  /**
+   * \brief Record the uses of a finished flow.
+   * \param tree the tree the flow used
+   * \param flow flow id
+   * \param uses number of uses of each leaf
+   */
+  static void AddFlow (const std::shared_ptr<const WhiskerTree> &tree, uint32_t flow,
+                       const std::vector<uint64_t> &uses);
+
+  /**
+   * \brief Merge the counts of all threads and write them to the file given to Enable ().
+   *
+   * Also called at normal process exit; processes that leave through _exit ()
+   * (such as forked workers) must call it themselves.
+   */
+  static void Write (void);
+
+private:
+  /// Counts of one thread for one tree
+  struct Counters
+  {
+    std::shared_ptr<const WhiskerTree> tree; //!< The tree
+    std::vector<uint64_t> uses;              //!< Uses of each leaf
+  };
+
+  /// Counts of one flow
+  struct FlowCounters
+  {
+    std::shared_ptr<const WhiskerTree> tree; //!< The tree
+    uint32_t flow;                           //!< Flow id
+    std::vector<uint64_t> uses;              //!< Uses of each leaf
+  };
+
+  /**
+   * \brief Allocate the counters of the calling thread for a tree.
+   * \param tree the tree
+   * \return the counters, owned by m_counters
+   */
+  static Counters *NewCounters (const std::shared_ptr<const WhiskerTree> &tree);
+
+  static std::mutex m_mutex; //!< Protects the members below
+  static std::vector<std::unique_ptr<Counters> > m_counters; //!< Counters of every thread and tree
+  static std::vector<FlowCounters> m_flows; //!< Finished flows
+  static std::string m_filename; //!< Output file
+};
+
+/**
+ * \brief Process-wide log of the decisions of TcpRemy sockets.
+ *
+ * Every socket with a non-empty AckLogFile appends one AckRecord per
+ * decision (the memory input and the resulting window and intersend time)
+ * to the same AckLogWriter, so the log can be replayed offline through
+ * AckReplay and a whisker tree.
+ */
+class RemyAckLog
+{
+public:
+  /**
+   * \brief Start logging to a file, closing any previous log.
+   * \param filename the log file
+   */
+  static void Open (const std::string &filename);
+
+  /**
+   * \brief Append a record to the log, if one is open.
+   * \param record the record
+   */
+  static void Write (const AckRecord &record);
+
+  /**
+   * \brief Write the buffered records and close the log.
+   *
+   * Also called at normal process exit; processes that leave through _exit ()
+   * (such as forked workers) must call it themselves.
+   */
+  static void Close (void);
+
+private:
+  static std::string m_filename; //!< File of the open log
+  static std::unique_ptr<AckLogWriter> m_writer; //!< The open log
+};
+
 /**
  * RemyCC for NS3
  */
@@ -54,9 +216,64 @@ public:
   virtual void Reset (Ptr<TcpSocketState> tcb, Ptr<RttEstimator> rtt);
   virtual void NotifyIdle (bool is_idle);
 
+  /**
+   * \brief Select the whisker tree used by this socket.
+   * \param filename path to a serialized RemyBuffers::WhiskerTree
+   */
+  void SetWhiskerFile (const std::string &filename);
+
+  /**
+   * \brief Get the path of the whisker tree used by this socket.
+   * \return the whisker file path
+   */
+  std::string GetWhiskerFile (void) const;
+
+  /**
+   * \brief Set the number of leading signals compared against the tree.
+   * \param dims number of signals; 0 uses the dimensionality of the tree
+   */
+  void SetSignalDimensions (uint32_t dims);
+
+  /**
+   * \brief Get the configured number of signals compared against the tree.
+   * \return the number of signals; 0 means the tree's dimensionality
+   */
+  uint32_t GetSignalDimensions (void) const;
+
+  /**
+   * \brief Collect whisker usage statistics into a file (see RemyWhiskerUsage).
+   * \param filename output file; empty disables collection by this socket
+   */
+  void SetUsageStatsFile (const std::string &filename);
+
+  /**
+   * \brief Get the whisker usage statistics file.
+   * \return the output file; empty if this socket does not collect statistics
+   */
+  std::string GetUsageStatsFile (void) const;
+
+  /**
+   * \brief Log the decisions of this socket (see RemyAckLog).
+   * \param filename log file; empty disables logging by this socket
+   */
+  void SetAckLogFile (const std::string &filename);
+
+  /**
+   * \brief Get the decision log file.
+   * \return the log file; empty if this socket does not log its decisions
+   */
+  std::string GetAckLogFile (void) const;
+
 private:
 
-    const WhiskerTree * _whiskers;
+    std::string _whisker_file;
+    std::shared_ptr<const WhiskerTree> _whiskers;
+    uint32_t _signal_dims;
+    std::string _usage_file;
+    bool _usage_per_flow;
+    std::vector<uint64_t> _usage;
+    std::string _ack_log_file;
+    AckRecord _ack_record;
     Memory _memory;
     double _intersend_time;
     double _last_last_send_attempt;
@@ -68,6 +285,7 @@ private:
     bool _reset;
     bool _is_idle;
 
+    void update_datasize( void );
     void update_cwnd_and_pacing( Ptr<TcpSocketState> tcb );
     void update_memory( const RemyPacket packet );
 };
@@ -1310,16 +1310,15 @@ TcpSocketBase::DoForwardUp (Ptr<Packet> packet, const Address &fromAddress,
   packet->RemoveHeader (tcpHeader);
   SequenceNumber32 seq = tcpHeader.GetSequenceNumber ();
 
-  // Collect INT tags
-  IntPacketTag tag = IntPacketTag();
-  bool tagged = packet->RemovePacketTag(tag);
-  if (tagged) 
+  // Collect INT data
+  IntMetadata intData;
+  if (packet->RemoveIntMetadata (intData))
   {
-    NS_LOG_DEBUG("Packet is tagged (Q: " << tag.GetQueue() << " L: " << tag.GetLink() << ")");
-    m_tcb->m_lastIntQueue = tag.GetQueue();
-    m_tcb->m_lastIntLink = tag.GetLinkConverted();
-    m_intQueueToEcho = tag.GetQueue();
-    m_intLinkToEcho = tag.GetLink();
+    NS_LOG_DEBUG("Packet carries INT data (Q: " << intData.queue << " L: " << intData.link << ")");
+    m_tcb->m_lastIntQueue = intData.queue;
+    m_tcb->m_lastIntLink = intData.GetLinkConverted();
+    m_intQueueToEcho = intData.queue;
+    m_intLinkToEcho = intData.link;
   }
 
   // Record Timestamp in tcb
@@ -3015,12 +3014,12 @@ TcpSocketBase::AddSocketIntTags (const Ptr<Packet> &p) const
 {
   if (m_intEnabled)
   {
-    IntPacketTag intTag;
-    intTag.SetQueue (m_intQueueToEcho);
-    intTag.SetLink (m_intLinkToEcho);
-    intTag.SetLock(false); // This is the line to change if turning on/off backward path TODO: Parameterize this
-    p->AddPacketTag(intTag);
-    NS_LOG_DEBUG("Adding tag: (Q: " << intTag.GetQueue() << " L: " << intTag.GetLink() << ")");
+    IntMetadata intData;
+    intData.queue = m_intQueueToEcho;
+    intData.link = m_intLinkToEcho;
+    intData.lock = false; // This is the line to change if turning on/off backward path TODO: Parameterize this
+    p->SetIntMetadata (intData);
+    NS_LOG_DEBUG("Adding INT data: (Q: " << intData.queue << " L: " << intData.link << ")");
   }
 }
 
@@ -1235,7 +1235,7 @@ protected:
   void UpdatePacingRate (void);
 
   /**
-   * \brief Add INT Tags for the Socket
+   * \brief Add the socket's INT data to the packet's INT slot
    * \param p Packet
    */
   void AddSocketIntTags (const Ptr<Packet> &p) const;
@@ -14,6 +14,7 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <fstream>
 #include <vector>
 #include "ns3/boolean.h"
 #include "ns3/config.h"
@@ -42,6 +43,8 @@
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/ipv4-global-routing.h"
 #include "ns3/bridge-helper.h"
+#include "ns3/global-router-interface.h"
+#include "ns3/system-path.h"
 
 using namespace ns3;
 
@@ -1244,6 +1247,222 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 GlobalRouting route lookup test
+ *
+ * Checks that lookups pick the routes a scan of the route lists in table
+ * order would pick, across overlapping prefixes, equal-cost routes,
+ * output interfaces and route removal.
+ */
+class Ipv4GlobalRoutingLookupTestCase : public TestCase
+{
+public:
+  Ipv4GlobalRoutingLookupTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * \brief Check the gateway of the route to a destination.
+   * \param routing The routing protocol.
+   * \param dest The destination.
+   * \param oif The output interface, or 0.
+   * \param gateway The expected gateway, or "0.0.0.0" if there should be no route.
+   */
+  void CheckRoute (Ptr<Ipv4GlobalRouting> routing, std::string dest, Ptr<NetDevice> oif, std::string gateway);
+};
+
+Ipv4GlobalRoutingLookupTestCase::Ipv4GlobalRoutingLookupTestCase ()
+  : TestCase ("Global routing lookup across prefixes and equal-cost routes")
+{
+}
+
+void
+Ipv4GlobalRoutingLookupTestCase::CheckRoute (Ptr<Ipv4GlobalRouting> routing, std::string dest, Ptr<NetDevice> oif, std::string gateway)
+{
+  Ipv4Header header;
+  header.SetDestination (Ipv4Address (dest.c_str ()));
+  Socket::SocketErrno sockerr;
+  Ptr<Ipv4Route> route = routing->RouteOutput (Create<Packet> (), header, oif, sockerr);
+  if (Ipv4Address (gateway.c_str ()) == Ipv4Address::GetAny ())
+    {
+      NS_TEST_EXPECT_MSG_EQ (route, 0, "Unexpected route to " << dest);
+      NS_TEST_EXPECT_MSG_EQ (sockerr, Socket::ERROR_NOROUTETOHOST, "Wrong error for " << dest);
+      return;
+    }
+  NS_TEST_ASSERT_MSG_NE (route, 0, "No route to " << dest);
+  NS_TEST_EXPECT_MSG_EQ (route->GetGateway (), Ipv4Address (gateway.c_str ()), "Wrong gateway to " << dest);
+}
+
+void
+Ipv4GlobalRoutingLookupTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  Ipv4GlobalRoutingHelper globalRoutingHelper;
+  internet.SetRoutingHelper (globalRoutingHelper);
+  internet.Install (node);
+
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  std::vector<Ptr<SimpleNetDevice> > devices;
+  for (uint32_t i = 1; i <= 3; i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      node->AddDevice (device);
+      int32_t ifIndex = ipv4->AddInterface (device);
+      std::ostringstream address;
+      address << "10.0." << i << ".1";
+      ipv4->AddAddress (ifIndex, Ipv4InterfaceAddress (Ipv4Address (address.str ().c_str ()), Ipv4Mask ("/24")));
+      ipv4->SetUp (ifIndex);
+      devices.push_back (device);
+    }
+
+  Ptr<Ipv4GlobalRouting> routing = ipv4->GetRoutingProtocol ()->GetObject<Ipv4GlobalRouting> ();
+  NS_TEST_ASSERT_MSG_NE (routing, 0, "Error-- no Ipv4GlobalRouting object");
+  routing->AddHostRouteTo (Ipv4Address ("10.2.3.4"), Ipv4Address ("10.0.3.2"), 3);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.2.0.0"), Ipv4Mask ("/16"), Ipv4Address ("10.0.1.2"), 1);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.2.3.0"), Ipv4Mask ("/24"), Ipv4Address ("10.0.2.2"), 2);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.3.0.0"), Ipv4Mask ("/24"), Ipv4Address ("10.0.2.2"), 2);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.3.0.0"), Ipv4Mask ("/24"), Ipv4Address ("10.0.3.2"), 3);
+
+  CheckRoute (routing, "10.2.3.4", 0, "10.0.3.2");
+  CheckRoute (routing, "10.2.9.9", 0, "10.0.1.2");
+  // Both the /16 and the /24 match; the first in table order is taken
+  CheckRoute (routing, "10.2.3.5", 0, "10.0.1.2");
+  CheckRoute (routing, "10.2.3.5", devices[1], "10.0.2.2");
+  CheckRoute (routing, "10.3.0.7", 0, "10.0.2.2");
+  CheckRoute (routing, "10.3.0.7", devices[2], "10.0.3.2");
+  CheckRoute (routing, "10.4.0.1", 0, "0.0.0.0");
+
+  // Removing the host route falls back to the network routes
+  routing->RemoveRoute (0);
+  CheckRoute (routing, "10.2.3.4", 0, "10.0.1.2");
+  routing->AddNetworkRouteTo (Ipv4Address ("0.0.0.0"), Ipv4Mask ("/0"), Ipv4Address ("10.0.3.2"), 3);
+  CheckRoute (routing, "10.4.0.1", 0, "10.0.3.2");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 GlobalRouting route cache test
+ *
+ * Checks that the routing tables are saved to the GlobalRoutingCacheDir,
+ * loaded from there when the topology is computed again, and recomputed
+ * when the cache file is unusable.
+ */
+class Ipv4GlobalRoutingCacheTestCase : public TestCase
+{
+public:
+  Ipv4GlobalRoutingCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Print the global routing tables of some nodes.
+   * \param nodes the nodes
+   * \returns the routes, one per line
+   */
+  static std::string DumpRoutes (NodeContainer nodes);
+};
+
+Ipv4GlobalRoutingCacheTestCase::Ipv4GlobalRoutingCacheTestCase ()
+  : TestCase ("Global routing tables are cached per topology")
+{
+}
+
+std::string
+Ipv4GlobalRoutingCacheTestCase::DumpRoutes (NodeContainer nodes)
+{
+  std::ostringstream oss;
+  std::vector<Ipv4RoutingTableEntry> routes[3];
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      Ptr<Ipv4GlobalRouting> routing = nodes.Get (i)->GetObject<GlobalRouter> ()->GetRoutingProtocol ();
+      routing->GetRoutes (routes[0], routes[1], routes[2]);
+      for (uint32_t kind = 0; kind < 3; kind++)
+        {
+          for (const Ipv4RoutingTableEntry &route : routes[kind])
+            {
+              oss << i << " " << kind << " " << route << std::endl;
+            }
+        }
+    }
+  return oss.str ();
+}
+
+// (172.16.1.1/32)A<--10.1.1.0/30-->B<--10.1.1.4/30-->C<--10.1.1.8/30-->D
+void
+Ipv4GlobalRoutingCacheTestCase::DoRun (void)
+{
+  std::string cacheDir = CreateTempDirFilename ("global-routes");
+  Config::SetGlobal ("GlobalRoutingCacheDir", StringValue (cacheDir));
+
+  NodeContainer c;
+  c.Create (4);
+  InternetStackHelper internet;
+  internet.Install (c);
+
+  SimpleNetDeviceHelper devHelper;
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.1.0", "255.255.255.252");
+  for (uint32_t i = 0; i + 1 < c.GetN (); i++)
+    {
+      ipv4.Assign (devHelper.Install (NodeContainer (c.Get (i), c.Get (i + 1))));
+      ipv4.NewNetwork ();
+    }
+  Ptr<SimpleNetDevice> deviceA = CreateObject<SimpleNetDevice> ();
+  deviceA->SetAddress (Mac48Address::Allocate ());
+  c.Get (0)->AddDevice (deviceA);
+  Ptr<Ipv4> ipv4A = c.Get (0)->GetObject<Ipv4> ();
+  int32_t ifIndexA = ipv4A->AddInterface (deviceA);
+  ipv4A->AddAddress (ifIndexA, Ipv4InterfaceAddress (Ipv4Address ("172.16.1.1"), Ipv4Mask ("/32")));
+  ipv4A->SetUp (ifIndexA);
+
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+  std::string computed = DumpRoutes (c);
+  NS_TEST_ASSERT_MSG_NE (computed, "", "SPF installed no routes");
+  std::list<std::string> files = SystemPath::ReadFiles (cacheDir);
+  NS_TEST_ASSERT_MSG_EQ (files.size (), 1, "The routes were not saved");
+  std::string cacheFile = SystemPath::Append (cacheDir, files.front ());
+
+  // A cache file with a single route proves the tables come from the file
+  {
+    std::ofstream out (cacheFile.c_str ());
+    out << "ns3-global-routes 1" << std::endl
+        << "node " << c.Get (0)->GetId () << " 1 0 0" << std::endl
+        << "10.9.9.9 255.255.255.255 10.1.1.2 1" << std::endl;
+  }
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  Ptr<Ipv4GlobalRouting> routingA = c.Get (0)->GetObject<GlobalRouter> ()->GetRoutingProtocol ();
+  NS_TEST_ASSERT_MSG_EQ (routingA->GetNRoutes (), 1, "The routes were not loaded from the cache");
+  NS_TEST_ASSERT_MSG_EQ (routingA->GetRoute (0)->GetDest (), Ipv4Address ("10.9.9.9"), "Wrong route loaded");
+  NS_TEST_ASSERT_MSG_EQ (c.Get (1)->GetObject<GlobalRouter> ()->GetRoutingProtocol ()->GetNRoutes (), 0,
+                         "Routes installed for a node missing from the cache");
+
+  // A truncated file is ignored and replaced
+  {
+    std::ofstream out (cacheFile.c_str ());
+    out << "ns3-global-routes 1" << std::endl
+        << "node " << c.Get (0)->GetId () << " 2 0 0" << std::endl
+        << "10.9.9.9 255.255.255.255 10.1.1.2 1" << std::endl;
+  }
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_ASSERT_MSG_EQ (DumpRoutes (c), computed, "Routes not recomputed after a bad cache file");
+
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_ASSERT_MSG_EQ (DumpRoutes (c), computed, "Routes loaded from the cache differ from SPF");
+
+  Config::SetGlobal ("GlobalRoutingCacheDir", StringValue (""));
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -1267,6 +1486,8 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite ()
     AddTestCase (new TwoBridgeTest, TestCase::QUICK);
     AddTestCase (new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase (new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase (new Ipv4GlobalRoutingLookupTestCase, TestCase::QUICK);
+    AddTestCase (new Ipv4GlobalRoutingCacheTestCase, TestCase::QUICK);
   }
 
 static Ipv4GlobalRoutingTestSuite g_globalRoutingTestSuite; //!< Static variable for test initialization
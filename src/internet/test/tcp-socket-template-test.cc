@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/node-container.h"
+#include "ns3/simulator.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/nstime.h"
+#include "ns3/socket.h"
+#include "ns3/tcp-l4-protocol.h"
+#include "ns3/internet-stack-helper.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that TcpL4Protocol::SetSocketAttribute applies to the sockets
+ * of its node created afterwards, and only to them.
+ */
+class TcpSocketTemplateTestCase : public TestCase
+{
+public:
+  TcpSocketTemplateTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TcpSocketTemplateTestCase::TcpSocketTemplateTestCase ()
+  : TestCase ("Socket attributes set on TcpL4Protocol apply at creation")
+{
+}
+
+void
+TcpSocketTemplateTestCase::DoRun (void)
+{
+  NodeContainer nodes;
+  nodes.Create (2);
+  InternetStackHelper stack;
+  stack.Install (nodes);
+
+  Ptr<TcpL4Protocol> tcp = nodes.Get (0)->GetObject<TcpL4Protocol> ();
+  Ptr<TcpL4Protocol> other = nodes.Get (1)->GetObject<TcpL4Protocol> ();
+  Ptr<Socket> before = tcp->CreateSocket ();
+
+  tcp->SetSocketAttribute ("SndBufSize", UintegerValue (6000 * 512));
+  tcp->SetSocketAttribute ("Sack", BooleanValue (false));
+  tcp->SetSocketAttribute ("ClockGranularity", TimeValue (NanoSeconds (1)));
+  Ptr<Socket> after = tcp->CreateSocket ();
+  Ptr<Socket> otherNode = other->CreateSocket ();
+
+  UintegerValue sndBuf;
+  BooleanValue sack;
+  TimeValue granularity;
+  after->GetAttribute ("SndBufSize", sndBuf);
+  after->GetAttribute ("Sack", sack);
+  after->GetAttribute ("ClockGranularity", granularity);
+  NS_TEST_ASSERT_MSG_EQ (sndBuf.Get (), 6000 * 512, "Template not applied to a new socket");
+  NS_TEST_ASSERT_MSG_EQ (sack.Get (), false, "Template not applied to a new socket");
+  NS_TEST_ASSERT_MSG_EQ (granularity.Get (), NanoSeconds (1), "Template not applied to a new socket");
+
+  before->GetAttribute ("Sack", sack);
+  NS_TEST_ASSERT_MSG_EQ (sack.Get (), true, "Template changed an existing socket");
+  otherNode->GetAttribute ("Sack", sack);
+  NS_TEST_ASSERT_MSG_EQ (sack.Get (), true, "Template applied to a socket of another node");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief TcpL4Protocol socket template TestSuite
+ */
+class TcpSocketTemplateTestSuite : public TestSuite
+{
+public:
+  TcpSocketTemplateTestSuite ()
+    : TestSuite ("tcp-socket-template", UNIT)
+  {
+    AddTestCase (new TcpSocketTemplateTestCase, TestCase::QUICK);
+  }
+};
+
+static TcpSocketTemplateTestSuite g_tcpSocketTemplateTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,43 @@
+#ifndef INT_METADATA_H
+#define INT_METADATA_H
+
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup packet
+ *
+ * IntMetadata is the INT data carried in the fixed metadata slot of a
+ * Packet (see Packet::SetIntMetadata).
+ *
+ * Unlike IntPacketTag, the slot lives inside the Packet object, so
+ * devices and sockets read and write it without allocating or touching
+ * the packet tag list, and copies of the packet carry it by value. It is
+ * simulation-only and not counted in the packet size: devices that model
+ * INT on the wire pad the packet by the INT header size while it is on
+ * the link, and record it in \c padded so that the receiver removes it.
+ */
+struct IntMetadata
+{
+  static const uint32_t CONVERSION_FACTOR = 10000; //!< conversion factor for link utilization
+
+  uint32_t queue {0}; //!< queue data
+  uint32_t link {0};  //!< link data
+  bool lock {false};  //!< whether hops must leave the data unchanged
+  bool padded {false}; //!< whether the packet ends with an INT-sized placeholder
+
+  /**
+   * \brief Get the link data converted to the original value
+   *
+   * \returns the link data
+   */
+  double GetLinkConverted (void) const
+  {
+    return (double) link / CONVERSION_FACTOR;
+  }
+};
+
+} // namespace ns3
+
+#endif /* INT_METADATA_H */
@@ -34,6 +34,25 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("PacketTagList");
 
+namespace {
+
+/**
+ * Get the pool TagData nodes are allocated from.
+ *
+ * It is never destroyed, since tags may be freed during the
+ * destruction of static objects.
+ *
+ * \returns The tag pool.
+ */
+SizeClassPool &
+GetTagPool (void)
+{
+  static SizeClassPool *pool = new SizeClassPool ();
+  return *pool;
+}
+
+} // unnamed namespace
+
 PacketTagList::TagData *
 PacketTagList::CreateTagData (size_t dataSize)
 {
@@ -43,14 +62,28 @@ PacketTagList::CreateTagData (size_t dataSize)
                  << " exceeds maximum "
                  << std::numeric_limits<decltype(TagData::size)>::max () );
 
-  void * p = std::malloc (sizeof (TagData) + dataSize - 1);
-  // The matching frees are in RemoveAll and RemoveWriter
+  void * p = GetTagPool ().Allocate (sizeof (TagData) + dataSize - 1);
+  // The matching frees are in RemoveAll and RemoveWriter, through FreeTagData
 
   TagData * tag = new (p) TagData;
   tag->size = dataSize;
   return tag;
 }
 
+void
+PacketTagList::FreeTagData (TagData * tag)
+{
+  size_t size = sizeof (TagData) + tag->size - 1;
+  tag->~TagData ();
+  GetTagPool ().Deallocate (tag, size);
+}
+
+SizeClassPool::Stats
+PacketTagList::GetPoolStats (void)
+{
+  return GetTagPool ().GetStats ();
+}
+
 bool
 PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
 {
@@ -194,8 +227,7 @@ PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
   if (preMerge)
     {
       // found tid before first merge, so delete cur
-      cur->~TagData ();
-      std::free (cur);
+      FreeTagData (cur);
     }
   else
     {
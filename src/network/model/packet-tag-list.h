@@ -28,6 +28,7 @@
 #include <stdint.h>
 #include <ostream>
 #include "ns3/type-id.h"
+#include "ns3/size-class-pool.h"
 
 namespace ns3 {
 
@@ -242,6 +243,16 @@ public:
    */
   uint32_t Deserialize (const uint32_t* buffer, uint32_t size);
 
+  /**
+   * Get the statistics of the TagData allocator.
+   *
+   * TagData nodes come from a SizeClassPool, so adding and removing tags
+   * recycles memory instead of calling malloc and free.
+   *
+   * \returns The allocator statistics, summed over all threads.
+   */
+  static SizeClassPool::Stats GetPoolStats (void);
+
 private:
   /**
    * Allocate and construct a TagData struct, sizing the data area
@@ -252,6 +263,13 @@ private:
    */
   static
   TagData * CreateTagData (size_t dataSize);
+  /**
+   * Destroy a TagData struct and return its memory to the tag pool.
+   *
+   * \param [in] tag The TagData object, made by CreateTagData().
+   */
+  static
+  void FreeTagData (TagData * tag);
   
   /**
    * Typedef of method function pointer for copy-on-write operations
@@ -365,15 +383,13 @@ PacketTagList::RemoveAll (void)
         }
       if (prev != 0) 
         {
-          prev->~TagData ();
-          std::free (prev);
+          FreeTagData (prev);
         }
       prev = cur;
     }
   if (prev != 0) 
     {
-      prev->~TagData ();
-      std::free (prev);
+      FreeTagData (prev);
     }
   m_next = 0;
 }
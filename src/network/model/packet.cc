@@ -30,6 +30,43 @@ NS_LOG_COMPONENT_DEFINE ("Packet");
 
 uint32_t Packet::m_globalUid = 0;
 
+namespace {
+
+/**
+ * Get the pool packets are allocated from.
+ *
+ * It is never destroyed, since packets may be freed during the
+ * destruction of static objects.
+ *
+ * \returns The packet pool.
+ */
+SizeClassPool &
+GetPacketPool (void)
+{
+  static SizeClassPool *pool = new SizeClassPool ();
+  return *pool;
+}
+
+} // unnamed namespace
+
+void *
+Packet::operator new (std::size_t size)
+{
+  return GetPacketPool ().Allocate (size);
+}
+
+void
+Packet::operator delete (void *p, std::size_t size)
+{
+  GetPacketPool ().Deallocate (p, size);
+}
+
+SizeClassPool::Stats
+Packet::GetPoolStats (void)
+{
+  return GetPacketPool ().GetStats ();
+}
+
 TypeId 
 ByteTagIterator::Item::GetTypeId (void) const
 {
@@ -137,6 +174,7 @@ Packet::Packet ()
      * global UID
      */
     m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, 0),
+    m_hasIntMetadata (false),
     m_nixVector (0)
 {
   m_globalUid++;
@@ -146,7 +184,9 @@ Packet::Packet (const Packet &o)
   : m_buffer (o.m_buffer),
     m_byteTagList (o.m_byteTagList),
     m_packetTagList (o.m_packetTagList),
-    m_metadata (o.m_metadata)
+    m_metadata (o.m_metadata),
+    m_intMetadata (o.m_intMetadata),
+    m_hasIntMetadata (o.m_hasIntMetadata)
 {
   o.m_nixVector ? m_nixVector = o.m_nixVector->Copy ()
     : m_nixVector = 0;
@@ -163,6 +203,8 @@ Packet::operator = (const Packet &o)
   m_byteTagList = o.m_byteTagList;
   m_packetTagList = o.m_packetTagList;
   m_metadata = o.m_metadata;
+  m_intMetadata = o.m_intMetadata;
+  m_hasIntMetadata = o.m_hasIntMetadata;
   o.m_nixVector ? m_nixVector = o.m_nixVector->Copy () 
     : m_nixVector = 0;
   return *this;
@@ -179,6 +221,7 @@ Packet::Packet (uint32_t size)
      * global UID
      */
     m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_hasIntMetadata (false),
     m_nixVector (0)
 {
   m_globalUid++;
@@ -188,6 +231,7 @@ Packet::Packet (uint8_t const *buffer, uint32_t size, bool magic)
     m_byteTagList (),
     m_packetTagList (),
     m_metadata (0,0),
+    m_hasIntMetadata (false),
     m_nixVector (0)
 {
   NS_ASSERT (magic);
@@ -205,6 +249,7 @@ Packet::Packet (uint8_t const*buffer, uint32_t size)
      * global UID
      */
     m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_hasIntMetadata (false),
     m_nixVector (0)
 {
   m_globalUid++;
@@ -219,6 +264,7 @@ Packet::Packet (const Buffer &buffer,  const ByteTagList &byteTagList,
     m_byteTagList (byteTagList),
     m_packetTagList (packetTagList),
     m_metadata (metadata),
+    m_hasIntMetadata (false),
     m_nixVector (0)
 {
 }
@@ -237,6 +283,8 @@ Packet::CreateFragment (uint32_t start, uint32_t length) const
   // through Create because it is private.
   Ptr<Packet> ret = Ptr<Packet> (new Packet (buffer, byteTagList, m_packetTagList, metadata), false);
   ret->SetNixVector (GetNixVector ());
+  ret->m_intMetadata = m_intMetadata;
+  ret->m_hasIntMetadata = m_hasIntMetadata;
   return ret;
 }
 
@@ -987,6 +1035,34 @@ Packet::RemoveAllPacketTags (void)
   m_packetTagList.RemoveAll ();
 }
 
+void
+Packet::SetIntMetadata (const IntMetadata &metadata)
+{
+  NS_LOG_FUNCTION (this);
+  m_intMetadata = metadata;
+  m_hasIntMetadata = true;
+}
+
+bool
+Packet::PeekIntMetadata (IntMetadata &metadata) const
+{
+  NS_LOG_FUNCTION (this);
+  if (m_hasIntMetadata)
+    {
+      metadata = m_intMetadata;
+    }
+  return m_hasIntMetadata;
+}
+
+bool
+Packet::RemoveIntMetadata (IntMetadata &metadata)
+{
+  NS_LOG_FUNCTION (this);
+  bool found = PeekIntMetadata (metadata);
+  m_hasIntMetadata = false;
+  return found;
+}
+
 void 
 Packet::PrintPacketTags (std::ostream &os) const
 {
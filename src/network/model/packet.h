@@ -29,11 +29,13 @@
 #include "byte-tag-list.h"
 #include "packet-tag-list.h"
 #include "nix-vector.h"
+#include "int-metadata.h"
 #include "ns3/mac48-address.h"
 #include "ns3/callback.h"
 #include "ns3/assert.h"
 #include "ns3/ptr.h"
 #include "ns3/deprecated.h"
+#include "ns3/size-class-pool.h"
 
 namespace ns3 {
 
@@ -248,6 +250,29 @@ public:
    * \return the copied object
    */
   Packet &operator = (const Packet &o);
+  /**
+   * \brief Allocate a packet from a SizeClassPool.
+   *
+   * Packets are created and dropped at a high rate, so their memory is
+   * recycled through per-thread free lists instead of the global allocator.
+   *
+   * \param [in] size The size of the packet object.
+   * \returns The memory for the packet.
+   */
+  static void * operator new (std::size_t size);
+  /**
+   * \brief Return the memory of a packet to its SizeClassPool.
+   *
+   * \param [in] p The memory of the packet.
+   * \param [in] size The size of the packet object.
+   */
+  static void operator delete (void *p, std::size_t size);
+  /**
+   * \brief Get the statistics of the packet allocator.
+   *
+   * \returns The allocator statistics, summed over all threads.
+   */
+  static SizeClassPool::Stats GetPoolStats (void);
   /**
    * \brief Create a packet with a zero-filled payload.
    *
@@ -684,6 +709,31 @@ public:
    */
   PacketTagIterator GetPacketTagIterator (void) const;
 
+  /**
+   * \brief Store INT data in the metadata slot of this packet.
+   *
+   * \param metadata the INT data, replacing any data already stored
+   *
+   * The slot is part of the Packet object: it is O(1), never allocates
+   * and is not serialized. See IntMetadata.
+   */
+  void SetIntMetadata (const IntMetadata &metadata);
+  /**
+   * \brief Read the INT data in the metadata slot of this packet.
+   *
+   * \param metadata set to the stored INT data, if any
+   * \returns true if INT data is stored, false otherwise (metadata is
+   *          then left unchanged)
+   */
+  bool PeekIntMetadata (IntMetadata &metadata) const;
+  /**
+   * \brief Read and clear the INT data in the metadata slot of this packet.
+   *
+   * \param metadata set to the stored INT data, if any
+   * \returns true if INT data was stored, false otherwise
+   */
+  bool RemoveIntMetadata (IntMetadata &metadata);
+
   /**
    * \brief Set the packet nix-vector.
    *
@@ -787,6 +837,8 @@ private:
   ByteTagList m_byteTagList;      //!< the ByteTag list
   PacketTagList m_packetTagList;  //!< the packet's Tag list
   PacketMetadata m_metadata;      //!< the packet's metadata
+  IntMetadata m_intMetadata;      //!< the INT data slot
+  bool m_hasIntMetadata;          //!< whether the INT data slot is set
 
   /* Please see comments above about nix-vector */
   mutable Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
@@ -1150,6 +1150,103 @@ PacketTagListTest::DoRun (void)
 
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Packet INT metadata slot unit tests.
+ */
+class PacketIntMetadataTest : public TestCase
+{
+public:
+  PacketIntMetadataTest ();
+private:
+  void DoRun (void);
+};
+
+PacketIntMetadataTest::PacketIntMetadataTest ()
+  : TestCase ("PacketIntMetadataTest")
+{
+}
+
+void
+PacketIntMetadataTest::DoRun (void)
+{
+  Ptr<Packet> p = Create<Packet> (1000);
+  IntMetadata data;
+  data.link = 7;
+  NS_TEST_EXPECT_MSG_EQ (p->PeekIntMetadata (data), false, "new packet has no INT data");
+  NS_TEST_EXPECT_MSG_EQ (data.link, 7, "missing INT data leaves the argument unchanged");
+
+  data.queue = 3;
+  data.lock = true;
+  p->SetIntMetadata (data);
+  NS_TEST_EXPECT_MSG_EQ (p->GetSize (), 1000, "INT data takes no space in the packet");
+
+  Ptr<Packet> copy = p->Copy ();
+  Ptr<Packet> fragment = p->CreateFragment (0, 500);
+  IntMetadata read;
+  NS_TEST_EXPECT_MSG_EQ (copy->PeekIntMetadata (read), true, "copies carry the INT data");
+  NS_TEST_EXPECT_MSG_EQ (read.queue, 3, "copied queue");
+  NS_TEST_EXPECT_MSG_EQ (read.link, 7, "copied link");
+  NS_TEST_EXPECT_MSG_EQ (read.lock, true, "copied lock");
+  NS_TEST_EXPECT_MSG_EQ (fragment->PeekIntMetadata (read), true, "fragments carry the INT data");
+
+  NS_TEST_EXPECT_MSG_EQ (p->RemoveIntMetadata (read), true, "remove finds the INT data");
+  NS_TEST_EXPECT_MSG_EQ (p->PeekIntMetadata (read), false, "remove clears the INT data");
+  NS_TEST_EXPECT_MSG_EQ (copy->PeekIntMetadata (read), true, "copies are independent");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Packet and packet tag allocator unit tests.
+ */
+class PacketPoolTest : public TestCase
+{
+public:
+  PacketPoolTest ();
+private:
+  void DoRun (void);
+};
+
+PacketPoolTest::PacketPoolTest ()
+  : TestCase ("PacketPoolTest")
+{
+}
+
+void
+PacketPoolTest::DoRun (void)
+{
+  SizeClassPool::Stats packets = Packet::GetPoolStats ();
+  SizeClassPool::Stats tags = PacketTagList::GetPoolStats ();
+  {
+    Ptr<Packet> p = Create<Packet> (1000);
+    p->AddPacketTag (ATestTag<8> ());
+    Ptr<Packet> copy = p->Copy ();
+    copy->AddPacketTag (ATestTag<30> ());
+    NS_TEST_EXPECT_MSG_EQ (Packet::GetPoolStats ().live, packets.live + 2, "packets are not counted as live");
+    NS_TEST_EXPECT_MSG_EQ (PacketTagList::GetPoolStats ().live, tags.live + 2, "tags are not counted as live");
+  }
+  SizeClassPool::Stats freed = Packet::GetPoolStats ();
+  SizeClassPool::Stats freedTags = PacketTagList::GetPoolStats ();
+  NS_TEST_EXPECT_MSG_EQ (freed.live, packets.live, "packets were not returned to the pool");
+  NS_TEST_EXPECT_MSG_EQ (freedTags.live, tags.live, "tags were not returned to the pool");
+
+  // The same allocations again reuse the memory just freed
+  {
+    Ptr<Packet> p = Create<Packet> (1000);
+    p->AddPacketTag (ATestTag<8> ());
+    Ptr<Packet> copy = p->Copy ();
+    copy->AddPacketTag (ATestTag<30> ());
+  }
+  NS_TEST_EXPECT_MSG_EQ (Packet::GetPoolStats ().hits, freed.hits + 2, "freed packets were not reused");
+  NS_TEST_EXPECT_MSG_EQ (Packet::GetPoolStats ().misses, freed.misses, "fresh memory used despite free packets");
+  NS_TEST_EXPECT_MSG_EQ (PacketTagList::GetPoolStats ().hits, freedTags.hits + 2, "freed tags were not reused");
+  NS_TEST_EXPECT_MSG_EQ (PacketTagList::GetPoolStats ().misses, freedTags.misses, "fresh memory used despite free tags");
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -1167,6 +1264,8 @@ PacketTestSuite::PacketTestSuite ()
 {
   AddTestCase (new PacketTest, TestCase::QUICK);
   AddTestCase (new PacketTagListTest, TestCase::QUICK);
+  AddTestCase (new PacketIntMetadataTest, TestCase::QUICK);
+  AddTestCase (new PacketPoolTest, TestCase::QUICK);
 }
 
 static PacketTestSuite g_packetTestSuite; //!< Static variable for test initialization
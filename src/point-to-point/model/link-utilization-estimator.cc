@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "link-utilization-estimator.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LinkUtilizationEstimator");
+
+NS_OBJECT_ENSURE_REGISTERED (LinkUtilizationEstimator);
+
+TypeId
+LinkUtilizationEstimator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LinkUtilizationEstimator")
+    .SetParent<Object> ()
+    .SetGroupName ("PointToPoint")
+  ;
+  return tid;
+}
+
+LinkUtilizationEstimator::LinkUtilizationEstimator ()
+  : m_interval (Seconds (0))
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LinkUtilizationEstimator::~LinkUtilizationEstimator ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+LinkUtilizationEstimator::SetInterval (Time interval)
+{
+  NS_LOG_FUNCTION (this << interval.As (Time::S));
+  m_interval = interval;
+  Reset ();
+}
+
+Time
+LinkUtilizationEstimator::GetInterval (void) const
+{
+  return m_interval;
+}
+
+NS_OBJECT_ENSURE_REGISTERED (SlidingWindowUtilizationEstimator);
+
+TypeId
+SlidingWindowUtilizationEstimator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SlidingWindowUtilizationEstimator")
+    .SetParent<LinkUtilizationEstimator> ()
+    .SetGroupName ("PointToPoint")
+    .AddConstructor<SlidingWindowUtilizationEstimator> ()
+    .AddAttribute ("Buckets",
+                   "Number of byte counters the interval is split into.",
+                   UintegerValue (10),
+                   MakeUintegerAccessor (&SlidingWindowUtilizationEstimator::SetBuckets,
+                                         &SlidingWindowUtilizationEstimator::GetBuckets),
+                   MakeUintegerChecker<uint32_t> (1))
+  ;
+  return tid;
+}
+
+SlidingWindowUtilizationEstimator::SlidingWindowUtilizationEstimator ()
+  : m_counters (10, 0)
+{
+  NS_LOG_FUNCTION (this);
+  Reset ();
+}
+
+void
+SlidingWindowUtilizationEstimator::SetBuckets (uint32_t buckets)
+{
+  NS_LOG_FUNCTION (this << buckets);
+  m_counters.assign (buckets, 0);
+  Reset ();
+}
+
+uint32_t
+SlidingWindowUtilizationEstimator::GetBuckets (void) const
+{
+  return m_counters.size ();
+}
+
+void
+SlidingWindowUtilizationEstimator::Reset (void)
+{
+  std::fill (m_counters.begin (), m_counters.end (), 0);
+  m_sum = 0;
+  m_current = 0;
+  m_last = 0;
+  m_intervalMicroSeconds = m_interval.GetMicroSeconds ();
+  m_bucketMicroSeconds = m_intervalMicroSeconds / m_counters.size ();
+  NS_ABORT_MSG_IF (m_interval.IsStrictlyPositive () && m_bucketMicroSeconds == 0,
+                   "Interval " << m_interval.As (Time::US) << " is too short for "
+                   << m_counters.size () << " buckets of at least 1us");
+}
+
+void
+SlidingWindowUtilizationEstimator::Advance (void)
+{
+  int64_t now = Simulator::Now ().GetMicroSeconds ();
+  uint32_t bucket = (now / m_bucketMicroSeconds) % m_counters.size ();
+
+  // If the window has not moved for a whole interval, every bucket is stale
+  if (now - m_last > m_intervalMicroSeconds)
+    {
+      std::fill (m_counters.begin (), m_counters.end (), 0);
+      m_sum = 0;
+      m_current = bucket;
+    }
+
+  // Zero out any buckets between the current bucket and the bucket of now
+  while (m_current != bucket)
+    {
+      m_current = (m_current + 1) % m_counters.size ();
+      m_sum -= m_counters[m_current];
+      m_counters[m_current] = 0;
+    }
+  m_last = now;
+}
+
+void
+SlidingWindowUtilizationEstimator::AddBytes (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+  Advance ();
+  m_counters[m_current] += bytes;
+  m_sum += bytes;
+}
+
+double
+SlidingWindowUtilizationEstimator::GetRecentBytes (void)
+{
+  Advance ();
+  return m_sum;
+}
+
+NS_OBJECT_ENSURE_REGISTERED (EwmaUtilizationEstimator);
+
+TypeId
+EwmaUtilizationEstimator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::EwmaUtilizationEstimator")
+    .SetParent<LinkUtilizationEstimator> ()
+    .SetGroupName ("PointToPoint")
+    .AddConstructor<EwmaUtilizationEstimator> ()
+  ;
+  return tid;
+}
+
+EwmaUtilizationEstimator::EwmaUtilizationEstimator ()
+{
+  NS_LOG_FUNCTION (this);
+  Reset ();
+}
+
+void
+EwmaUtilizationEstimator::Reset (void)
+{
+  m_bytes = 0;
+  m_last = Seconds (0);
+}
+
+void
+EwmaUtilizationEstimator::Decay (void)
+{
+  Time now = Simulator::Now ();
+  if (now != m_last)
+    {
+      m_bytes *= std::exp (-(now - m_last).GetSeconds () / m_interval.GetSeconds ());
+      m_last = now;
+    }
+}
+
+void
+EwmaUtilizationEstimator::AddBytes (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+  Decay ();
+  m_bytes += bytes;
+}
+
+double
+EwmaUtilizationEstimator::GetRecentBytes (void)
+{
+  Decay ();
+  return m_bytes;
+}
+
+NS_OBJECT_ENSURE_REGISTERED (TokenWindowUtilizationEstimator);
+
+TypeId
+TokenWindowUtilizationEstimator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TokenWindowUtilizationEstimator")
+    .SetParent<LinkUtilizationEstimator> ()
+    .SetGroupName ("PointToPoint")
+    .AddConstructor<TokenWindowUtilizationEstimator> ()
+  ;
+  return tid;
+}
+
+TokenWindowUtilizationEstimator::TokenWindowUtilizationEstimator ()
+{
+  NS_LOG_FUNCTION (this);
+  Reset ();
+}
+
+void
+TokenWindowUtilizationEstimator::Reset (void)
+{
+  m_tokens.clear ();
+  m_sum = 0;
+}
+
+void
+TokenWindowUtilizationEstimator::Expire (void)
+{
+  Time start = Simulator::Now () - m_interval;
+  while (!m_tokens.empty () && m_tokens.front ().first <= start)
+    {
+      m_sum -= m_tokens.front ().second;
+      m_tokens.pop_front ();
+    }
+}
+
+void
+TokenWindowUtilizationEstimator::AddBytes (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << bytes);
+  Expire ();
+  m_tokens.push_back (std::make_pair (Simulator::Now (), bytes));
+  m_sum += bytes;
+}
+
+double
+TokenWindowUtilizationEstimator::GetRecentBytes (void)
+{
+  Expire ();
+  return m_sum;
+}
+
+} // namespace ns3
@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LINK_UTILIZATION_ESTIMATOR_H
+#define LINK_UTILIZATION_ESTIMATOR_H
+
+#include <deque>
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup point-to-point
+ *
+ * \brief Estimates how many bytes a device sent over the last interval
+ *
+ * PointToPointNetDevice feeds every transmitted packet to its estimator
+ * and derives the INT link metric (utilization or available capacity)
+ * from the estimate. Implementations trade signal fidelity against
+ * per-packet cost; all of them update and query in (amortized) constant
+ * time. The estimator is selected with the
+ * ns3::PointToPointNetDevice::UtilizationEstimator attribute.
+ */
+class LinkUtilizationEstimator : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  LinkUtilizationEstimator ();
+  virtual ~LinkUtilizationEstimator ();
+
+  /**
+   * \brief Set the interval over which bytes are counted and clear the estimate
+   * \param interval the collection interval
+   */
+  void SetInterval (Time interval);
+
+  /**
+   * \return the interval over which bytes are counted
+   */
+  Time GetInterval (void) const;
+
+  /**
+   * \brief Record bytes transmitted now
+   * \param bytes number of bytes on the wire
+   */
+  virtual void AddBytes (uint32_t bytes) = 0;
+
+  /**
+   * \return the estimated number of bytes transmitted over the last interval
+   */
+  virtual double GetRecentBytes (void) = 0;
+
+protected:
+  /**
+   * \brief Clear the estimate after the interval changed
+   */
+  virtual void Reset (void) = 0;
+
+  Time m_interval; //!< Collection interval
+};
+
+/**
+ * \ingroup point-to-point
+ *
+ * \brief Sliding window of byte counters
+ *
+ * The interval is split in a number of buckets; the estimate is the sum of
+ * the buckets, kept as a running sum. The window advances by whole buckets,
+ * so its resolution is the interval divided by the number of buckets.
+ */
+class SlidingWindowUtilizationEstimator : public LinkUtilizationEstimator
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  SlidingWindowUtilizationEstimator ();
+
+  virtual void AddBytes (uint32_t bytes);
+  virtual double GetRecentBytes (void);
+
+protected:
+  virtual void Reset (void);
+
+private:
+  /**
+   * \brief Move the window to the bucket of the current time
+   */
+  void Advance (void);
+
+  /**
+   * \brief Set the number of buckets
+   * \param buckets the number of buckets per interval
+   */
+  void SetBuckets (uint32_t buckets);
+
+  /**
+   * \return the number of buckets per interval
+   */
+  uint32_t GetBuckets (void) const;
+
+  std::vector<uint32_t> m_counters; //!< Byte counters, one per bucket
+  uint64_t m_sum;                   //!< Running sum of the counters
+  uint32_t m_current;               //!< Index of the current bucket
+  int64_t m_last;                   //!< Last time (us) the window moved
+  int64_t m_intervalMicroSeconds;   //!< Collection interval in us
+  int64_t m_bucketMicroSeconds;     //!< Width of a bucket in us
+};
+
+/**
+ * \ingroup point-to-point
+ *
+ * \brief Exponentially decayed byte count
+ *
+ * Bytes decay with a time constant equal to the interval, so the count
+ * estimates the bytes sent per interval with more weight on recent
+ * packets and without any quantization.
+ */
+class EwmaUtilizationEstimator : public LinkUtilizationEstimator
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  EwmaUtilizationEstimator ();
+
+  virtual void AddBytes (uint32_t bytes);
+  virtual double GetRecentBytes (void);
+
+protected:
+  virtual void Reset (void);
+
+private:
+  /**
+   * \brief Decay the count to the current time
+   */
+  void Decay (void);
+
+  double m_bytes; //!< Decayed byte count
+  Time m_last;    //!< Time of the last decay
+};
+
+/**
+ * \ingroup point-to-point
+ *
+ * \brief Exact count of the bytes sent in the last interval
+ *
+ * Keeps every transmission of the last interval, so the estimate is exact
+ * at the cost of memory proportional to the number of packets in flight
+ * on the wire during one interval.
+ */
+class TokenWindowUtilizationEstimator : public LinkUtilizationEstimator
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  TokenWindowUtilizationEstimator ();
+
+  virtual void AddBytes (uint32_t bytes);
+  virtual double GetRecentBytes (void);
+
+protected:
+  virtual void Reset (void);
+
+private:
+  /**
+   * \brief Drop the transmissions that left the window
+   */
+  void Expire (void);
+
+  std::deque<std::pair<Time, uint32_t> > m_tokens; //!< Transmissions in the window
+  uint64_t m_sum;                                  //!< Bytes in the window
+};
+
+} // namespace ns3
+
+#endif /* LINK_UTILIZATION_ESTIMATOR_H */
@@ -25,6 +25,7 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 #include "ns3/pointer.h"
+#include "ns3/object-factory.h"
 #include "point-to-point-net-device.h"
 #include "point-to-point-channel.h"
 #include "ppp-header.h"
@@ -35,6 +36,16 @@ NS_LOG_COMPONENT_DEFINE ("PointToPointNetDevice");
 
 NS_OBJECT_ENSURE_REGISTERED (PointToPointNetDevice);
 
+/**
+ * \return the number of bytes INT data takes on the wire
+ */
+static uint32_t
+IntHeaderSize (void)
+{
+  static const uint32_t size = IntHeader ().GetSerializedSize ();
+  return size;
+}
+
 TypeId 
 PointToPointNetDevice::GetTypeId (void)
 {
@@ -55,7 +66,8 @@ PointToPointNetDevice::GetTypeId (void)
     .AddAttribute ("DataRate", 
                    "The default data rate for point to point links",
                    DataRateValue (DataRate ("32768b/s")),
-                   MakeDataRateAccessor (&PointToPointNetDevice::m_bps),
+                   MakeDataRateAccessor (&PointToPointNetDevice::SetDataRate,
+                                         &PointToPointNetDevice::GetDataRate),
                    MakeDataRateChecker ())
     .AddAttribute ("ReceiveErrorModel", 
                    "The receiver error model used to simulate packet loss",
@@ -70,8 +82,15 @@ PointToPointNetDevice::GetTypeId (void)
     .AddAttribute ("ByteCounterInterval", 
                    "Collection interval for utilization metrics.",
                    TimeValue (MicroSeconds (10)),
-                   MakeTimeAccessor (&PointToPointNetDevice::m_byteCollectionInterval),
+                   MakeTimeAccessor (&PointToPointNetDevice::SetByteCounterInterval,
+                                     &PointToPointNetDevice::GetByteCounterInterval),
                    MakeTimeChecker ())
+    .AddAttribute ("UtilizationEstimator",
+                   "Type of LinkUtilizationEstimator behind the INT link metric.",
+                   TypeIdValue (SlidingWindowUtilizationEstimator::GetTypeId ()),
+                   MakeTypeIdAccessor (&PointToPointNetDevice::SetUtilizationEstimatorType,
+                                       &PointToPointNetDevice::GetUtilizationEstimatorType),
+                   MakeTypeIdChecker ())
     .AddAttribute ("IntEnabled", 
                    "Enable INT placed in the packet header.",
                    BooleanValue (false),
@@ -82,6 +101,14 @@ PointToPointNetDevice::GetTypeId (void)
                    BooleanValue (true),
                    MakeBooleanAccessor (&PointToPointNetDevice::m_linkIntUtil),
                    MakeBooleanChecker ())
+    .AddAttribute ("Ideal",
+                   "Model an ideal link: every packet is handed to the channel as soon as it "
+                   "is sent and arrives after the channel delay only, without queueing, "
+                   "serialization, INT stamping or transmit-complete events.  Meant for "
+                   "access links much faster than the rest of the path.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&PointToPointNetDevice::m_ideal),
+                   MakeBooleanChecker ())
 
     //
     // Transmit queueing discipline for the device which includes its own set
@@ -192,6 +219,7 @@ PointToPointNetDevice::PointToPointNetDevice ()
     m_txMachineState (READY),
     m_channel (0),
     m_linkUp (false),
+    m_ideal (false),
     m_currentPkt (0)
 {
   NS_LOG_FUNCTION (this);
@@ -230,6 +258,7 @@ PointToPointNetDevice::DoDispose ()
   m_receiveErrorModel = 0;
   m_currentPkt = 0;
   m_queue = 0;
+  m_utilizationEstimator = 0;
   NetDevice::DoDispose ();
 }
 
@@ -238,6 +267,13 @@ PointToPointNetDevice::SetDataRate (DataRate bps)
 {
   NS_LOG_FUNCTION (this);
   m_bps = bps;
+  UpdateIntConstants ();
+}
+
+DataRate
+PointToPointNetDevice::GetDataRate (void) const
+{
+  return m_bps;
 }
 
 void
@@ -248,35 +284,50 @@ PointToPointNetDevice::SetInterframeGap (Time t)
 }
 
 void
-PointToPointNetDevice::AddPacketToCounter(Ptr<Packet> p) {
-  NS_LOG_FUNCTION (this);
-  // Get the current simulation time and find its bucket
-  Time current_time = Simulator::Now();
-  unsigned int time_bucket = ((int) std::floor(current_time.GetMicroSeconds() / (m_byteCollectionInterval.GetMicroSeconds() / 10))) % 10;
-
-  // If there hasn't been a packet in the last recording interval, 0 everything
-  if (current_time.GetMicroSeconds() - m_lastCollectionTime.GetMicroSeconds() > m_byteCollectionInterval.GetMicroSeconds()) {
-    for (int i = 0; i < 10; i++) {
-      m_packetCounters[i] = 0;
+PointToPointNetDevice::SetByteCounterInterval (Time interval)
+{
+  NS_LOG_FUNCTION (this << interval.As (Time::S));
+  m_byteCollectionInterval = interval;
+  UpdateIntConstants ();
+  if (m_utilizationEstimator)
+    {
+      m_utilizationEstimator->SetInterval (interval);
     }
-    m_currentBucket = (time_bucket - 1);
-  }
+}
 
-  int gap = ((time_bucket + 10) - m_currentBucket) % 10; // Makes the case the same whether the tick has wrapped around or not
-  
-  // Zero out any buckets between the current bucket and the tick bucket 
-  while (gap > 0)
-  {
-    m_currentBucket += 1;
-    m_currentBucket = m_currentBucket % 10;
-    m_packetCounters[m_currentBucket] = 0;
-    gap = ((time_bucket + 10) - m_currentBucket) % 10;
-  }
+Time
+PointToPointNetDevice::GetByteCounterInterval (void) const
+{
+  return m_byteCollectionInterval;
+}
 
-  // Add the bucket to the counter
-  IntHeader dummyHeader = IntHeader();
-  m_packetCounters[m_currentBucket] += p->GetSize() + dummyHeader.GetSerializedSize();
-  m_lastCollectionTime = current_time;
+void
+PointToPointNetDevice::SetUtilizationEstimatorType (TypeId type)
+{
+  NS_LOG_FUNCTION (this << type);
+  ObjectFactory factory;
+  factory.SetTypeId (type);
+  m_utilizationEstimator = factory.Create<LinkUtilizationEstimator> ();
+  m_utilizationEstimator->SetInterval (m_byteCollectionInterval);
+}
+
+TypeId
+PointToPointNetDevice::GetUtilizationEstimatorType (void) const
+{
+  return m_utilizationEstimator ? m_utilizationEstimator->GetInstanceTypeId () : SlidingWindowUtilizationEstimator::GetTypeId ();
+}
+
+Ptr<LinkUtilizationEstimator>
+PointToPointNetDevice::GetUtilizationEstimator (void) const
+{
+  return m_utilizationEstimator;
+}
+
+void
+PointToPointNetDevice::UpdateIntConstants (void)
+{
+  m_intervalSeconds = m_byteCollectionInterval.GetSeconds ();
+  m_bitsPerInterval = m_bps.GetBitRate () * m_intervalSeconds;
 }
 
 bool
@@ -285,50 +336,49 @@ PointToPointNetDevice::TransmitStart (Ptr<Packet> p)
   NS_LOG_FUNCTION (this << p);
   NS_LOG_LOGIC ("UID is " << p->GetUid () << ")");
 
-  // Add INT header if it is enabled
+  // Stamp INT data if it is enabled
+  uint32_t wireSize = p->GetSize ();
   if (m_intEnabled)
   {
-    IntHeader dummyHeader = IntHeader();
-    uint32_t size = p->GetSize() + dummyHeader.GetSerializedSize();
-    AddPacketToCounter(p);
-
-    PppHeader ppp = PppHeader();
-    p->RemoveHeader(ppp); 
+    wireSize += IntHeaderSize ();
+    m_utilizationEstimator->AddBytes (wireSize);
 
-    // Get the current tag
-    IntPacketTag tag = IntPacketTag();
-
-    // Update link
-    uint32_t initialLink = m_linkIntUtil ? 0 : std::numeric_limits<uint32_t>::max();
-    tag.SetLink(initialLink);
-    p->RemovePacketTag(tag);
+    // Get the current data (untagged packets start from the initial link value)
+    IntMetadata intData;
+    intData.link = m_linkIntUtil ? 0 : std::numeric_limits<uint32_t>::max();
+    p->PeekIntMetadata (intData);
 
     // Update queue
-    int queue_len = tag.GetLock() ? tag.GetQueue() : std::max(m_queue->GetCurrentSize().GetValue(), tag.GetQueue());
+    if (!intData.lock)
+    {
+      intData.queue = std::max(m_queue->GetCurrentSize().GetValue(), intData.queue);
+    }
 
-    uint64_t recent_bytes = 0;
-    recent_bytes = std::accumulate(m_packetCounters, m_packetCounters + 10, recent_bytes);
-    
+    // Update link
+    double recent_bytes = m_utilizationEstimator->GetRecentBytes ();
     double link_metric;
-    if (tag.GetLock()) {
-      link_metric = (double) tag.GetLink();
+    if (intData.lock) {
+      link_metric = (double) intData.link;
     }
     else if (m_linkIntUtil) {
-      link_metric = std::max(((recent_bytes * 8) / (m_bps.GetBitRate() * m_byteCollectionInterval.GetSeconds())) * tag.GetConversionFactor(), (double) tag.GetLink()); 
+      link_metric = std::max(((recent_bytes * 8) / m_bitsPerInterval) * IntMetadata::CONVERSION_FACTOR, (double) intData.link);
     }
     else {
-      double ac = std::max(m_bps.GetBitRate() - ((recent_bytes * 8) / m_byteCollectionInterval.GetSeconds()), (double)0);
-      link_metric = std::min((ac / (size * 8 * pow(10,6))) * tag.GetConversionFactor(), (double)tag.GetLink()); // TODO: GET RID OF THESE CONSTANTS
+      double ac = std::max(m_bps.GetBitRate() - ((recent_bytes * 8) / m_intervalSeconds), (double)0);
+      link_metric = std::min((ac / (wireSize * 8 * 1e6)) * IntMetadata::CONVERSION_FACTOR, (double) intData.link);
+    }
+    intData.link = (uint32_t) link_metric;
+
+    // The data travels in the packet's INT slot. A zero-filled placeholder
+    // of the INT header size keeps the packet as large as on the wire, so
+    // traces, pcap and the channel see the same sizes as with a real header.
+    NS_LOG_DEBUG("Send INT data: q=" << intData.queue << "; l=" << intData.link);
+    if (!intData.padded)
+    {
+      p->AddPaddingAtEnd (IntHeaderSize ());
+      intData.padded = true;
     }
-        
-    IntHeader intHeader = IntHeader();
-    intHeader.SetQueue((uint32_t) queue_len);
-    intHeader.SetLink((uint32_t) link_metric);
-    intHeader.SetLock(tag.GetLock());
-    NS_LOG_DEBUG("Send INT Header: q=" << intHeader.GetQueue() << "; l=" << intHeader.GetLink());
-    p->AddHeader(intHeader);
-
-    p->AddHeader(ppp);
+    p->SetIntMetadata (intData);
   }
 
   //
@@ -341,7 +391,7 @@ PointToPointNetDevice::TransmitStart (Ptr<Packet> p)
   m_currentPkt = p;
   m_phyTxBeginTrace (m_currentPkt);
 
-  Time txTime = m_bps.CalculateBytesTxTime (p->GetSize ());
+  Time txTime = m_bps.CalculateBytesTxTime (wireSize);
   Time txCompleteTime = txTime + m_tInterframeGap;
   // NS_LOG_DEBUG("TX time is " << txCompleteTime);
 
@@ -455,6 +505,15 @@ PointToPointNetDevice::Receive (Ptr<Packet> packet)
 
       NS_LOG_DEBUG("Received packet of size (with ppp header): " << packet->GetSize());
 
+      // Strip off the INT placeholder; the data itself stays in the packet's INT slot
+      IntMetadata intData;
+      if (packet->PeekIntMetadata (intData) && intData.padded)
+      {
+        packet->RemoveAtEnd (IntHeaderSize ());
+        intData.padded = false;
+        packet->SetIntMetadata (intData);
+      }
+
       //
       // Strip off the point-to-point protocol header and forward this packet
       // up the protocol stack.  Since this is a simple point-to-point link,
@@ -463,22 +522,6 @@ PointToPointNetDevice::Receive (Ptr<Packet> packet)
       //
       ProcessHeader (packet, protocol);
 
-      // Strip off INT header and store data
-      if (m_intEnabled)
-      {
-        IntHeader intHeader = IntHeader();
-        packet->RemoveHeader(intHeader);
-        uint32_t queue_int = intHeader.GetQueue();
-        uint32_t link_int = intHeader.GetLink();
-        bool int_lock = intHeader.GetLock();
-        NS_LOG_DEBUG("Receive Header: q=" << queue_int << "; l=" << link_int );
-        
-        IntPacketTag tag = IntPacketTag();
-        tag.SetQueue(queue_int);
-        tag.SetLink(link_int);
-        tag.SetLock(int_lock);
-        packet->AddPacketTag(tag);
-      }
       NS_LOG_DEBUG("Received packet of size: " << packet->GetSize());
 
       if (!m_promiscCallback.IsNull ())
@@ -645,6 +688,24 @@ PointToPointNetDevice::Send (
 
   m_macTxTrace (packet);
 
+  //
+  // An ideal link is never busy, so the packet skips the queue and the
+  // transmit state machine; only the propagation delay remains.
+  //
+  if (m_ideal)
+    {
+      m_snifferTrace (packet);
+      m_promiscSnifferTrace (packet);
+      m_phyTxBeginTrace (packet);
+      bool result = m_channel->TransmitStart (packet, this, Time (0));
+      if (result == false)
+        {
+          m_phyTxDropTrace (packet);
+        }
+      m_phyTxEndTrace (packet);
+      return result;
+    }
+
   //
   // We should enqueue and dequeue the packet to hit the tracing hooks.
   //
@@ -34,6 +34,7 @@
 #include "ns3/mac48-address.h"
 #include "ns3/int-packet-tag.h"
 #include "ns3/int-header.h"
+#include "ns3/link-utilization-estimator.h"
 
 namespace ns3 {
 
@@ -98,6 +99,11 @@ public:
    */
   void SetDataRate (DataRate bps);
 
+  /**
+   * \return the data rate at which this object operates
+   */
+  DataRate GetDataRate (void) const;
+
   /**
    * Set the interframe gap used to separate packets.  The interframe gap
    * defines the minimum space required between packets sent by this device.
@@ -106,6 +112,36 @@ public:
    */
   void SetInterframeGap (Time t);
 
+  /**
+   * Set the interval over which transmitted bytes are counted for the INT
+   * link metric.
+   *
+   * \param interval the collection interval
+   */
+  void SetByteCounterInterval (Time interval);
+
+  /**
+   * \return the interval over which transmitted bytes are counted
+   */
+  Time GetByteCounterInterval (void) const;
+
+  /**
+   * Replace the link utilization estimator with a new one of the given type.
+   *
+   * \param type a TypeId derived from LinkUtilizationEstimator
+   */
+  void SetUtilizationEstimatorType (TypeId type);
+
+  /**
+   * \return the type of the estimator behind the INT link metric
+   */
+  TypeId GetUtilizationEstimatorType (void) const;
+
+  /**
+   * \return the estimator behind the INT link metric
+   */
+  Ptr<LinkUtilizationEstimator> GetUtilizationEstimator (void) const;
+
   /**
    * Attach the device to a channel.
    *
@@ -287,10 +323,10 @@ private:
   void NotifyLinkUp (void);
 
   /**
-   * \brief Add a packet to the byte counters
-   *
+   * \brief Recompute the INT constants derived from the data rate and
+   * the byte counter interval
    */
-  void AddPacketToCounter (Ptr<Packet> p);
+  void UpdateIntConstants (void);
 
   /**
    * Enumeration of the states of the transmit machine of the net device.
@@ -457,14 +493,15 @@ private:
 
   // Utilization tracking variables
   Time m_byteCollectionInterval; //!< Time interval for utilization measurements
-  uint32_t m_packetCounters[10] = { 0 }; //!< Packet counters in 10 buckets
-  Time m_lastCollectionTime = Seconds(0); //!< Last time a counter was updated
-  unsigned int m_currentBucket = 0; //<! Current bucket index
+  Ptr<LinkUtilizationEstimator> m_utilizationEstimator; //!< Bytes sent over the last interval
+  double m_intervalSeconds = 0; //!< Collection interval in s
+  double m_bitsPerInterval = 0; //!< Bits the link can send in a collection interval
 
   bool m_pktWasDequeued = false;
 
   bool m_intEnabled; 
   bool m_linkIntUtil;
+  bool m_ideal; //!< Hand packets to the channel at once, without serialization (see "Ideal")
 
   /**
    * \brief The Maximum Transmission Unit
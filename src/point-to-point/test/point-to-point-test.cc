@@ -24,6 +24,13 @@
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/point-to-point-channel.h"
 #include "ns3/net-device-queue-interface.h"
+#include "ns3/link-utilization-estimator.h"
+#include "ns3/int-header.h"
+#include "ns3/ppp-header.h"
+#include "ns3/boolean.h"
+#include "ns3/data-rate.h"
+
+#include <cmath>
 
 #include <string>
 
@@ -130,6 +137,297 @@ PointToPointTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \brief Test class for the link utilization estimators
+ *
+ * It records two transmissions and checks the estimate of every
+ * estimator as they leave the interval.
+ */
+class LinkUtilizationEstimatorTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  LinkUtilizationEstimatorTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+
+private:
+  /**
+   * \brief Check the estimate of an estimator
+   *
+   * \param estimator the estimator
+   * \param expected the expected number of bytes
+   */
+  void CheckBytes (Ptr<LinkUtilizationEstimator> estimator, double expected);
+};
+
+LinkUtilizationEstimatorTest::LinkUtilizationEstimatorTest ()
+  : TestCase ("LinkUtilizationEstimator")
+{
+}
+
+void
+LinkUtilizationEstimatorTest::CheckBytes (Ptr<LinkUtilizationEstimator> estimator, double expected)
+{
+  NS_TEST_EXPECT_MSG_EQ_TOL (estimator->GetRecentBytes (), expected, 1e-6,
+                             estimator->GetInstanceTypeId ().GetName () << " at " << Simulator::Now ().As (Time::US));
+}
+
+void
+LinkUtilizationEstimatorTest::DoRun (void)
+{
+  Ptr<LinkUtilizationEstimator> window = CreateObject<SlidingWindowUtilizationEstimator> ();
+  Ptr<LinkUtilizationEstimator> ewma = CreateObject<EwmaUtilizationEstimator> ();
+  Ptr<LinkUtilizationEstimator> tokens = CreateObject<TokenWindowUtilizationEstimator> ();
+  Ptr<LinkUtilizationEstimator> estimators[] = { window, ewma, tokens };
+
+  // 1000 bytes at 5us and 500 bytes at 55us, over a 100us interval
+  for (Ptr<LinkUtilizationEstimator> estimator : estimators)
+    {
+      estimator->SetInterval (MicroSeconds (100));
+      Simulator::Schedule (MicroSeconds (5), &LinkUtilizationEstimator::AddBytes, estimator, 1000);
+      Simulator::Schedule (MicroSeconds (55), &LinkUtilizationEstimator::AddBytes, estimator, 500);
+    }
+
+  // The window moves in 10us buckets, so the first packet leaves it at 100us
+  Simulator::Schedule (MicroSeconds (56), &LinkUtilizationEstimatorTest::CheckBytes, this, window, 1500);
+  Simulator::Schedule (MicroSeconds (100), &LinkUtilizationEstimatorTest::CheckBytes, this, window, 500);
+  Simulator::Schedule (MicroSeconds (300), &LinkUtilizationEstimatorTest::CheckBytes, this, window, 0);
+
+  double decayed = 1000 * std::exp (-0.5) + 500;
+  Simulator::Schedule (MicroSeconds (55), &LinkUtilizationEstimatorTest::CheckBytes, this, ewma, decayed);
+  Simulator::Schedule (MicroSeconds (155), &LinkUtilizationEstimatorTest::CheckBytes, this, ewma, decayed * std::exp (-1.0));
+
+  Simulator::Schedule (MicroSeconds (104), &LinkUtilizationEstimatorTest::CheckBytes, this, tokens, 1500);
+  Simulator::Schedule (MicroSeconds (105), &LinkUtilizationEstimatorTest::CheckBytes, this, tokens, 500);
+  Simulator::Schedule (MicroSeconds (155), &LinkUtilizationEstimatorTest::CheckBytes, this, tokens, 0);
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \brief Test class for ideal point-to-point links
+ *
+ * It sends a burst of packets over a slow link in ideal mode and checks
+ * that all of them arrive after the channel delay only.
+ */
+class PointToPointIdealTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  PointToPointIdealTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+
+private:
+  std::vector<Time> m_arrivals; //!< arrival time of each packet
+  /**
+   * \brief Callback function which records the arrival time
+   *
+   * \param dev The receiving device.
+   * \param pkt The received packet.
+   * \param mode The protocol mode used.
+   * \param sender The sender address.
+   *
+   * \return A boolean indicating packet handled properly.
+   */
+  bool RxPacket (Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address &sender);
+  /**
+   * \brief Send a burst of packets
+   *
+   * \param device NetDevice to send to.
+   * \param count Number of packets.
+   */
+  void SendBurst (Ptr<PointToPointNetDevice> device, uint32_t count);
+};
+
+PointToPointIdealTest::PointToPointIdealTest ()
+  : TestCase ("PointToPointIdeal")
+{
+}
+
+bool
+PointToPointIdealTest::RxPacket (Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address &sender)
+{
+  m_arrivals.push_back (Simulator::Now ());
+  return true;
+}
+
+void
+PointToPointIdealTest::SendBurst (Ptr<PointToPointNetDevice> device, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (device->Send (Create<Packet> (1000), device->GetBroadcast (), 0x800), true,
+                             "An ideal link accepts every packet");
+    }
+}
+
+void
+PointToPointIdealTest::DoRun (void)
+{
+  Ptr<Node> a = CreateObject<Node> ();
+  Ptr<Node> b = CreateObject<Node> ();
+  Ptr<PointToPointNetDevice> devA = CreateObject<PointToPointNetDevice> ();
+  Ptr<PointToPointNetDevice> devB = CreateObject<PointToPointNetDevice> ();
+  Ptr<PointToPointChannel> channel = CreateObject<PointToPointChannel> ();
+  channel->SetAttribute ("Delay", TimeValue (MilliSeconds (2)));
+
+  // At 8kbps, each packet would take about a second to serialize
+  devA->SetAttribute ("Ideal", BooleanValue (true));
+  devA->SetDataRate (DataRate ("8kbps"));
+  devA->Attach (channel);
+  devA->SetAddress (Mac48Address::Allocate ());
+  devA->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+  devB->Attach (channel);
+  devB->SetAddress (Mac48Address::Allocate ());
+  devB->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+
+  a->AddDevice (devA);
+  b->AddDevice (devB);
+
+  devB->SetReceiveCallback (MakeCallback (&PointToPointIdealTest::RxPacket, this));
+  Simulator::Schedule (Seconds (1.0), &PointToPointIdealTest::SendBurst, this, devA, 3);
+
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_arrivals.size (), 3, "Every packet of the burst arrives");
+  for (Time arrival : m_arrivals)
+    {
+      NS_TEST_EXPECT_MSG_EQ (arrival, Seconds (1.0) + MilliSeconds (2), "Packets arrive after the channel delay only");
+    }
+  NS_TEST_EXPECT_MSG_EQ (devA->GetQueue ()->GetNPackets (), 0, "An ideal link does not queue");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \brief Test class for the size of packets carrying INT data
+ *
+ * It sends one packet over a link with INT enabled and checks that the
+ * device traces see the INT header on the wire, as the sizes traced when
+ * INT was serialized as a header, while the packet handed up does not.
+ */
+class PointToPointIntSizeTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  PointToPointIntSizeTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+
+private:
+  uint32_t m_txSize;                //!< size seen by the PhyTxBegin trace
+  uint32_t m_macRxSize;             //!< size seen by the MacRx trace
+  Ptr<const Packet> m_recvdPacket;  //!< received packet
+  /**
+   * \brief Record the size of a packet starting transmission
+   *
+   * \param pkt The packet.
+   */
+  void PhyTxBegin (Ptr<const Packet> pkt);
+  /**
+   * \brief Record the size of a received packet
+   *
+   * \param pkt The packet.
+   */
+  void MacRx (Ptr<const Packet> pkt);
+  /**
+   * \brief Callback function which sets the recvdPacket parameter
+   *
+   * \param dev The receiving device.
+   * \param pkt The received packet.
+   * \param mode The protocol mode used.
+   * \param sender The sender address.
+   *
+   * \return A boolean indicating packet handled properly.
+   */
+  bool RxPacket (Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address &sender);
+};
+
+PointToPointIntSizeTest::PointToPointIntSizeTest ()
+  : TestCase ("PointToPointIntSize"),
+    m_txSize (0),
+    m_macRxSize (0)
+{
+}
+
+void
+PointToPointIntSizeTest::PhyTxBegin (Ptr<const Packet> pkt)
+{
+  m_txSize = pkt->GetSize ();
+}
+
+void
+PointToPointIntSizeTest::MacRx (Ptr<const Packet> pkt)
+{
+  m_macRxSize = pkt->GetSize ();
+}
+
+bool
+PointToPointIntSizeTest::RxPacket (Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address &sender)
+{
+  m_recvdPacket = pkt;
+  return true;
+}
+
+void
+PointToPointIntSizeTest::DoRun (void)
+{
+  Ptr<Node> a = CreateObject<Node> ();
+  Ptr<Node> b = CreateObject<Node> ();
+  Ptr<PointToPointNetDevice> devA = CreateObject<PointToPointNetDevice> ();
+  Ptr<PointToPointNetDevice> devB = CreateObject<PointToPointNetDevice> ();
+  Ptr<PointToPointChannel> channel = CreateObject<PointToPointChannel> ();
+
+  devA->SetAttribute ("IntEnabled", BooleanValue (true));
+  devA->Attach (channel);
+  devA->SetAddress (Mac48Address::Allocate ());
+  devA->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+  devB->SetAttribute ("IntEnabled", BooleanValue (true));
+  devB->Attach (channel);
+  devB->SetAddress (Mac48Address::Allocate ());
+  devB->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+
+  a->AddDevice (devA);
+  b->AddDevice (devB);
+
+  devA->TraceConnectWithoutContext ("PhyTxBegin", MakeCallback (&PointToPointIntSizeTest::PhyTxBegin, this));
+  devB->TraceConnectWithoutContext ("MacRx", MakeCallback (&PointToPointIntSizeTest::MacRx, this));
+  devB->SetReceiveCallback (MakeCallback (&PointToPointIntSizeTest::RxPacket, this));
+  Simulator::Schedule (Seconds (1.0), &PointToPointNetDevice::Send, devA,
+                       Create<Packet> (100), devA->GetBroadcast (), 0x800);
+
+  Simulator::Run ();
+
+  uint32_t wireSize = 100 + PppHeader ().GetSerializedSize () + IntHeader ().GetSerializedSize ();
+  NS_TEST_EXPECT_MSG_EQ (m_txSize, wireSize, "PhyTxBegin sees the INT header");
+  NS_TEST_EXPECT_MSG_EQ (m_macRxSize, wireSize, "MacRx sees the INT header");
+  NS_TEST_ASSERT_MSG_NE (m_recvdPacket, 0, "The packet arrives");
+  NS_TEST_EXPECT_MSG_EQ (m_recvdPacket->GetSize (), 100, "The packet handed up has no INT header");
+  IntMetadata intData;
+  NS_TEST_EXPECT_MSG_EQ (m_recvdPacket->PeekIntMetadata (intData), true, "The packet carries INT data");
+  NS_TEST_EXPECT_MSG_EQ (intData.padded, false, "The INT placeholder is removed");
+
+  Simulator::Destroy ();
+}
+
 /**
  * \brief TestSuite for PointToPoint module
  */
@@ -146,6 +444,9 @@ PointToPointTestSuite::PointToPointTestSuite ()
   : TestSuite ("devices-point-to-point", UNIT)
 {
   AddTestCase (new PointToPointTest, TestCase::QUICK);
+  AddTestCase (new LinkUtilizationEstimatorTest, TestCase::QUICK);
+  AddTestCase (new PointToPointIdealTest, TestCase::QUICK);
+  AddTestCase (new PointToPointIntSizeTest, TestCase::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/applications-module.h"
+
+using namespace ns3;
+
+/**
+ * \file
+ * \ingroup system-tests-perf
+ *
+ * Measure the packet rate of a saturated dumbbell with INT enabled on
+ * every point-to-point device.  Run it with and without --int to see
+ * the per-packet cost of INT stamping.
+ */
+
+/** Number of packets that started transmission on any device. */
+static uint64_t g_txPackets = 0;
+
+/**
+ * Count a packet transmission.
+ * \param p the packet
+ */
+static void
+CountTx (Ptr<const Packet> p)
+{
+  g_txPackets++;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t flows = 8;
+  double simTime = 10.0;
+  bool intEnabled = true;
+  bool linkUtil = true;
+  std::string bottleneckRate = "100Mbps";
+  std::string estimator = "ns3::SlidingWindowUtilizationEstimator";
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("flows", "Number of bulk TCP flows across the bottleneck", flows);
+  cmd.AddValue ("time", "Simulated time in seconds", simTime);
+  cmd.AddValue ("int", "Enable INT on every device", intEnabled);
+  cmd.AddValue ("linkutil", "INT link metric is utilization (available capacity if false)", linkUtil);
+  cmd.AddValue ("rate", "Bottleneck data rate", bottleneckRate);
+  cmd.AddValue ("estimator", "LinkUtilizationEstimator behind the link metric", estimator);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::PointToPointNetDevice::IntEnabled", BooleanValue (intEnabled));
+  Config::SetDefault ("ns3::PointToPointNetDevice::LinkMetricUtil", BooleanValue (linkUtil));
+  Config::SetDefault ("ns3::PointToPointNetDevice::UtilizationEstimator", StringValue (estimator));
+  Config::SetDefault ("ns3::TcpSocket::SegmentSize", UintegerValue (1448));
+
+  PointToPointHelper leaf;
+  leaf.SetDeviceAttribute ("DataRate", StringValue ("1Gbps"));
+  leaf.SetChannelAttribute ("Delay", StringValue ("1ms"));
+  PointToPointHelper bottleneck;
+  bottleneck.SetDeviceAttribute ("DataRate", StringValue (bottleneckRate));
+  bottleneck.SetChannelAttribute ("Delay", StringValue ("10ms"));
+
+  PointToPointDumbbellHelper dumbbell (flows, leaf, flows, leaf, bottleneck);
+  InternetStackHelper stack;
+  dumbbell.InstallStack (stack);
+  dumbbell.AssignIpv4Addresses (Ipv4AddressHelper ("10.1.0.0", "255.255.255.0"),
+                                Ipv4AddressHelper ("10.2.0.0", "255.255.255.0"),
+                                Ipv4AddressHelper ("10.3.0.0", "255.255.255.0"));
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+
+  uint16_t port = 9000;
+  ApplicationContainer apps;
+  for (uint32_t i = 0; i < flows; ++i)
+    {
+      Address sinkAddress (InetSocketAddress (dumbbell.GetRightIpv4Address (i), port));
+      PacketSinkHelper sink ("ns3::TcpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), port));
+      apps.Add (sink.Install (dumbbell.GetRight (i)));
+      BulkSendHelper source ("ns3::TcpSocketFactory", sinkAddress);
+      apps.Add (source.Install (dumbbell.GetLeft (i)));
+    }
+  apps.Start (Seconds (0.0));
+
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::PointToPointNetDevice/PhyTxBegin",
+                                 MakeCallback (&CountTx));
+
+  Simulator::Stop (Seconds (simTime));
+  auto start = std::chrono::steady_clock::now ();
+  Simulator::Run ();
+  auto end = std::chrono::steady_clock::now ();
+  Simulator::Destroy ();
+
+  double elapsed = std::chrono::duration<double> (end - start).count ();
+  std::cout << "INT " << (intEnabled ? "enabled" : "disabled")
+            << " (" << estimator << "), " << flows << " flows, " << simTime << " s simulated" << std::endl;
+  std::cout << "Packets transmitted: " << g_txPackets << std::endl;
+  std::cout << "Wall clock (s): " << elapsed << std::endl;
+  std::cout << "Packets/s: " << g_txPackets / elapsed << std::endl;
+  SizeClassPool::Stats packets = Packet::GetPoolStats ();
+  SizeClassPool::Stats tags = PacketTagList::GetPoolStats ();
+  std::cout << "Packet allocations: " << packets.hits + packets.misses
+            << " (" << packets.misses << " not recycled)" << std::endl;
+  std::cout << "Packet tag allocations: " << tags.hits + tags.misses
+            << " (" << tags.misses << " not recycled)" << std::endl;
+  return 0;
+}
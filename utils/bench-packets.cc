@@ -26,6 +26,7 @@
 #include "ns3/system-wall-clock-ms.h"
 #include "ns3/packet.h"
 #include "ns3/packet-metadata.h"
+#include "ns3/packet-tag-list.h"
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -328,6 +329,38 @@ benchByteTags (uint32_t n)
     }
 }
 
+static void
+benchSegments (uint32_t n)
+{
+  // The per-segment pattern of a TCP dumbbell: the sender keeps the
+  // segment for retransmission and sends a copy tagged with a flow id,
+  // a socket priority and INT data; the device copies it again for the
+  // queue and the receiver strips it.
+  BenchHeader<20> tcp;
+  BenchHeader<20> ipv4;
+  BenchTag<4> flowId;
+  BenchTag<1> priority;
+  BenchTag<9> intData;
+
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<Packet> segment = Create<Packet> (1448);
+      Ptr<Packet> p = segment->Copy ();
+      p->AddHeader (tcp);
+      p->AddPacketTag (priority);
+      p->AddHeader (ipv4);
+      p->AddPacketTag (flowId);
+      p->AddPacketTag (intData);
+
+      Ptr<Packet> queued = p->Copy ();
+      queued->RemovePacketTag (intData);
+      queued->RemovePacketTag (priority);
+      queued->RemoveHeader (ipv4);
+      queued->RemoveHeader (tcp);
+      queued->RemovePacketTag (flowId);
+    }
+}
+
 static uint64_t
 runBenchOneIteration (void (*bench) (uint32_t), uint32_t n)
 {
@@ -342,6 +375,8 @@ runBenchOneIteration (void (*bench) (uint32_t), uint32_t n)
 static void
 runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char const *name)
 {
+  SizeClassPool::Stats packets = Packet::GetPoolStats ();
+  SizeClassPool::Stats tags = PacketTagList::GetPoolStats ();
   uint64_t minDelay = std::numeric_limits<uint64_t>::max();
   for (uint32_t i = 0; i < minIterations; i++)
     {
@@ -355,6 +390,19 @@ runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char con
             << " (" << minDelay << " ms elapsed)\t"
             << name
             << std::endl;
+
+  // Per packet allocations of Packet objects and tag nodes, and how many
+  // of them reached the global allocator
+  SizeClassPool::Stats packetsEnd = Packet::GetPoolStats ();
+  SizeClassPool::Stats tagsEnd = PacketTagList::GetPoolStats ();
+  double total = static_cast<double> (n) * minIterations;
+  std::cout << "\tpackets: "
+            << (packetsEnd.hits + packetsEnd.misses - packets.hits - packets.misses) / total
+            << " allocs, " << (packetsEnd.misses - packets.misses) / total << " not recycled"
+            << "; tags: "
+            << (tagsEnd.hits + tagsEnd.misses - tags.hits - tags.misses) / total
+            << " allocs, " << (tagsEnd.misses - tags.misses) / total << " not recycled"
+            << std::endl;
 }
 
 int main (int argc, char *argv[])
@@ -385,6 +433,7 @@ int main (int argc, char *argv[])
   runBench (&benchD, n, minIterations, "Intermixed add/remove headers and tags");
   runBench (&benchFragment, n, minIterations, "Fragmentation and concatenation");
   runBench (&benchByteTags, n, minIterations, "Benchmark byte tags");
+  runBench (&benchSegments, n, minIterations, "TCP segments with packet tags and copies");
 
   return 0;
 }
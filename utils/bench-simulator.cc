@@ -145,16 +145,64 @@ Bench::Cb (void)
 }
 
 
+/**
+ * Relative event times of a pacing-heavy TCP workload: pacing timers
+ * around the packet interval of a 1 Gb/s flow, TransmitComplete events
+ * at the serialization time of a full-size packet on 10 Gb/s links, and
+ * channel deliveries at a few distinct propagation delays.
+ *
+ * \param count the number of event times
+ * \return the event times, in ns
+ */
+std::vector<double>
+GetTcpMix (uint32_t count)
+{
+  const double pacing = 12000;         // 1500 B at 1 Gb/s
+  const double serialization = 1200;   // 1500 B at 10 Gb/s
+  const double propagation[] = { 1000, 10000, 50000 };
+
+  Ptr<UniformRandomVariable> u = CreateObject<UniformRandomVariable> ();
+  u->SetStream (1);
+  std::vector<double> nsValues;
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      double kind = u->GetValue ();
+      if (kind < 0.5)
+        {
+          nsValues.push_back (pacing * u->GetValue (0.9, 1.1));
+        }
+      else if (kind < 0.8)
+        {
+          nsValues.push_back (serialization);
+        }
+      else
+        {
+          nsValues.push_back (propagation[u->GetInteger (0, 2)]);
+        }
+    }
+  return nsValues;
+}
+
 Ptr<RandomVariableStream>
-GetRandomStream (std::string filename)
+GetRandomStream (std::string filename, bool mix)
 {
   Ptr<RandomVariableStream> stream = 0;
 
-  if (filename == "")
+  if (mix)
+    {
+      LOGME ("using the TCP pacing event mix");
+      std::vector<double> nsValues = GetTcpMix (1000000);
+      Ptr<DeterministicRandomVariable> drv = CreateObject<DeterministicRandomVariable> ();
+      drv->SetValueArray (&nsValues[0], nsValues.size ());
+      stream = drv;
+    }
+  else if (filename == "")
     {
       LOGME ("using default exponential distribution");
       Ptr<ExponentialRandomVariable> erv = CreateObject<ExponentialRandomVariable> ();
       erv->SetAttribute ("Mean", DoubleValue (100));
+      // Every scheduler compared sees the same event times
+      erv->SetStream (1);
       stream = erv;
     }
   else
@@ -205,14 +253,17 @@ int main (int argc, char *argv[])
 
   bool schedCal           = false;
   bool schedHeap          = false;
+  bool schedLadder        = false;
   bool schedList          = false;
   bool schedMap           = true;
   bool schedPriorityQueue = false;
+  bool compare            = false;
 
   uint32_t pop   =  100000;
   uint32_t total = 1000000;
   uint32_t runs  =       1;
   std::string filename = "";
+  bool mix = false;
   bool calRev = false;
 
   CommandLine cmd (__FILE__);
@@ -220,26 +271,33 @@ int main (int argc, char *argv[])
              "\n"
              "Event intervals are taken from one of:\n"
              "  an exponential distribution, with mean 100 ns,\n"
+             "  a mix of TCP pacing timers, transmissions and propagation\n"
+             "    delays, given by the --mix argument,\n"
              "  an ascii file, given by the --file=\"<filename>\" argument,\n"
              "  or standard input, by the argument --file=\"-\"\n"
              "In the case of either --file form, the input is expected\n"
-             "to be ascii, giving the relative event times in ns.");
+             "to be ascii, giving the relative event times in ns.\n"
+             "With --compare, every scheduler is run on the same event times.");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
   cmd.AddValue ("calrev", "reverse ordering in the CalendarScheduler", calRev);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
+  cmd.AddValue ("ladder", "use LadderScheduler",          schedLadder);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
   cmd.AddValue ("pri",   "use PriorityQueue",             schedPriorityQueue);
+  cmd.AddValue ("compare", "run every scheduler in turn", compare);
   cmd.AddValue ("debug", "enable debugging output",       g_debug);
   cmd.AddValue ("pop",   "event population size (default 1E5)",         pop);
   cmd.AddValue ("total", "total number of events to run (default 1E6)", total);
   cmd.AddValue ("runs",  "number of runs (default 1)",    runs);
   cmd.AddValue ("file",  "file of relative event times",  filename);
+  cmd.AddValue ("mix",   "use the TCP pacing event mix",  mix);
   cmd.AddValue ("prec",  "printed output precision",      g_fwidth);
   cmd.Parse (argc, argv);
   g_me = cmd.GetName () + ": ";
   g_fwidth += 6;  // 5 extra chars in '2.000002e+07 ': . e+0 _
 
+  std::vector<ObjectFactory> factories;
   ObjectFactory factory ("ns3::MapScheduler");
   if (schedCal)
     {
@@ -250,6 +308,10 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::HeapScheduler");
     }
+  if (schedLadder)
+    {
+      factory.SetTypeId ("ns3::LadderScheduler");
+    }
   if (schedList)
     {
       factory.SetTypeId ("ns3::ListScheduler");
@@ -258,64 +320,88 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::PriorityQueueScheduler");
     }
-      
-  Simulator::SetScheduler (factory);
+  if (compare)
+    {
+      // The ListScheduler is left out: it is linear in the population
+      const char *types[] = { "ns3::MapScheduler", "ns3::HeapScheduler",
+                              "ns3::PriorityQueueScheduler", "ns3::CalendarScheduler",
+                              "ns3::LadderScheduler" };
+      for (const char *type : types)
+        {
+          factories.push_back (ObjectFactory (type));
+        }
+      factories[3].Set ("Reverse", BooleanValue (calRev));
+    }
+  else
+    {
+      factories.push_back (factory);
+    }
 
   LOGME (std::setprecision (g_fwidth - 6));
   DEB ("debugging is ON");
 
-  std::string order;
-  if (schedCal)
-    {
-      order = ": insertion order: " + std::string (calRev ? "reverse" : "normal");
-    }
-  LOGME ("scheduler: " << factory.GetTypeId ().GetName () << order);
   LOGME ("population: " << pop);
   LOGME ("total events: " << total);
   LOGME ("runs: " << runs);
 
-  Bench *bench = new Bench (pop, total);
-  bench->SetRandomStream (GetRandomStream (filename));
-
-  // table header
-  LOG ("");
-  LOG (std::left << std::setw (g_fwidth) << "Run #" <<
-       std::left << std::setw (3 * g_fwidth) << "Initialization:" <<
-       std::left << std::setw (3 * g_fwidth) << "Simulation:");
-  LOG (std::left << std::setw (g_fwidth) << "" <<
-       std::left << std::setw (g_fwidth) << "Time (s)" <<
-       std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
-       std::left << std::setw (g_fwidth) << "Per (s/ev)" <<
-       std::left << std::setw (g_fwidth) << "Time (s)" <<
-       std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
-       std::left << std::setw (g_fwidth) << "Per (s/ev)" );
-  LOG (std::setfill ('-') <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::setfill (' ')
-       );
-
-  // prime
-  DEB ("priming");
-  std::cout << std::left << std::setw (g_fwidth) << "(prime)";
-  bench->RunBench ();
-
-  bench->SetPopulation (pop);
-  bench->SetTotal (total);
-  for (uint32_t i = 0; i < runs; i++)
+  for (const ObjectFactory &f : factories)
     {
-      std::cout << std::setw (g_fwidth) << i;
+      Simulator::SetScheduler (f);
 
+      std::string order;
+      if (f.GetTypeId ().GetName () == "ns3::CalendarScheduler")
+        {
+          order = ": insertion order: " + std::string (calRev ? "reverse" : "normal");
+        }
+      LOG ("");
+      LOGME ("scheduler: " << f.GetTypeId ().GetName () << order);
+
+      Bench *bench = new Bench (pop, total);
+      bench->SetRandomStream (GetRandomStream (filename, mix));
+
+      // table header
+      LOG ("");
+      LOG (std::left << std::setw (g_fwidth) << "Run #" <<
+           std::left << std::setw (3 * g_fwidth) << "Initialization:" <<
+           std::left << std::setw (3 * g_fwidth) << "Simulation:");
+      LOG (std::left << std::setw (g_fwidth) << "" <<
+           std::left << std::setw (g_fwidth) << "Time (s)" <<
+           std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
+           std::left << std::setw (g_fwidth) << "Per (s/ev)" <<
+           std::left << std::setw (g_fwidth) << "Time (s)" <<
+           std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
+           std::left << std::setw (g_fwidth) << "Per (s/ev)" );
+      LOG (std::setfill ('-') <<
+           std::right << std::setw (g_fwidth) << " " <<
+           std::right << std::setw (g_fwidth) << " " <<
+           std::right << std::setw (g_fwidth) << " " <<
+           std::right << std::setw (g_fwidth) << " " <<
+           std::right << std::setw (g_fwidth) << " " <<
+           std::right << std::setw (g_fwidth) << " " <<
+           std::right << std::setw (g_fwidth) << " " <<
+           std::setfill (' ')
+           );
+
+      // prime
+      DEB ("priming");
+      std::cout << std::left << std::setw (g_fwidth) << "(prime)";
       bench->RunBench ();
-    }
 
-  LOG ("");
-  Simulator::Destroy ();
-  delete bench;
+      bench->SetPopulation (pop);
+      bench->SetTotal (total);
+      for (uint32_t i = 0; i < runs; i++)
+        {
+          std::cout << std::setw (g_fwidth) << i;
+
+          bench->RunBench ();
+        }
+
+      EventImpl::PoolStats pool = EventImpl::GetPoolStats ();
+      LOGME ("event pool: " << pool.hits << " hits, " << pool.misses << " misses, " <<
+             pool.bytes << " bytes in chunks");
+      LOG ("");
+      Simulator::Destroy ();
+      delete bench;
+    }
   return 0;
 }
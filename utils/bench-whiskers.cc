@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program compares the recursive WhiskerTree lookup with the compiled
+// (flattened) lookup on a real whisker tree. Query points are drawn uniformly
+// from the domain of uniformly chosen leaves, so every whisker is exercised.
+// Sample usage:  ./ns3 run 'bench-whiskers --whiskers=/path/to/tree --n=1000000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/tcp-remy.h"
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/// Keeps the lookup loops from being optimized away
+static volatile uintptr_t g_sink;
+
+/**
+ * Collect the leaves of a whisker tree.
+ * \param tree the tree to walk
+ * \param leaves the leaves found so far
+ */
+static void
+CollectLeaves (const WhiskerTree &tree, std::vector<const Whisker *> &leaves)
+{
+  if (tree.is_leaf ())
+    {
+      leaves.push_back (tree.leaf ());
+      return;
+    }
+  for (const auto &child : tree.children ())
+    {
+      CollectLeaves (child, leaves);
+    }
+}
+
+int main (int argc, char *argv[])
+{
+  std::string whiskers;
+  uint32_t n = 1000000;
+  uint32_t dims = 0;
+  uint32_t seed = 1;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("whiskers", "serialized whisker tree to benchmark", whiskers);
+  cmd.AddValue ("n", "number of lookups", n);
+  cmd.AddValue ("dims", "number of signal dimensions compared per lookup (0 uses the tree's)", dims);
+  cmd.AddValue ("seed", "seed for the query points", seed);
+  cmd.Parse (argc, argv);
+
+  if (whiskers.empty ())
+    {
+      std::cerr << "--whiskers is required" << std::endl;
+      return 1;
+    }
+
+  std::shared_ptr<const WhiskerTree> tree = RemyWhiskerRegistry::Get (whiskers);
+  if (dims == 0)
+    {
+      dims = tree->datasize ();
+    }
+
+  std::vector<const Whisker *> leaves;
+  CollectLeaves (*tree, leaves);
+
+  std::mt19937 prng (seed);
+  std::uniform_int_distribution<size_t> pickLeaf (0, leaves.size () - 1);
+  std::vector<Memory> queries;
+  queries.reserve (n);
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      const MemoryRange &domain = leaves[pickLeaf (prng)]->domain ();
+      std::vector<Memory::DataType> point (Memory::MAX_DATASIZE);
+      for (uint32_t j = 0; j < Memory::MAX_DATASIZE; ++j)
+        {
+          std::uniform_real_distribution<Memory::DataType> axis (domain.lower ().field (j),
+                                                                 domain.upper ().field (j));
+          point[j] = axis (prng);
+        }
+      queries.emplace_back (point);
+      queries.back ().set_datasize (dims);
+    }
+
+  std::cout << "whiskers=" << tree->total_whiskers () << " lookups=" << n << " dims=" << dims << std::endl;
+
+  SystemWallClockMs time;
+  uintptr_t sink = 0;
+
+  time.Start ();
+  for (const auto &q : queries)
+    {
+      sink += reinterpret_cast<uintptr_t> (tree->whisker (q));
+    }
+  double recursive = time.End () / 1000.0;
+
+  time.Start ();
+  for (const auto &q : queries)
+    {
+      sink -= reinterpret_cast<uintptr_t> (tree->compiled_whisker (q));
+    }
+  double compiled = time.End () / 1000.0;
+
+  uint32_t mismatches = 0;
+  for (const auto &q : queries)
+    {
+      mismatches += tree->whisker (q) != tree->compiled_whisker (q);
+    }
+
+  std::cout << std::setw (12) << "recursive" << std::setw (12) << recursive << "s"
+            << std::setw (14) << (n / recursive) << " lookups/s" << std::endl;
+  std::cout << std::setw (12) << "compiled" << std::setw (12) << compiled << "s"
+            << std::setw (14) << (n / compiled) << " lookups/s" << std::endl;
+  std::cout << "mismatches=" << mismatches << std::endl;
+  g_sink = sink;
+
+  return mismatches == 0 ? 0 : 1;
+}